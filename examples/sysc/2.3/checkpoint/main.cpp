@@ -0,0 +1,186 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Checkpoint and restore of a simulation.
+
+  A producer feeds a FIFO on each rising clock edge, a consumer adds the
+  samples up in a signal and an accumulator keeps its own state, which it
+  saves through checkpoint_state(). An alarm event is notified during
+  elaboration. The first run saves a checkpoint halfway and continues to
+  the end, the second run restores the checkpoint and simulates the
+  second half only. Both runs end in the same state.
+
+  A fresh process would elaborate the model for the second run, here a
+  second simulation context stands in for it.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+#include <cstdio>
+
+SC_MODULE(accumulator)
+{
+    sc_in<bool>       clk;
+    sc_fifo_in<int>   samples;
+    sc_signal<int>    total;
+    sc_event          alarm;
+
+    int               edges;
+    sc_uint<8>        checksum;
+    sc_time           last_alarm;
+
+    SC_CTOR(accumulator)
+      : clk( "clk" ), samples( "samples" ), total( "total", 0 ),
+        alarm( "alarm" ), edges( 0 ), checksum( 0 ), last_alarm()
+    {
+        SC_METHOD(count);
+        sensitive << clk.pos();
+        dont_initialize();
+
+        SC_METHOD(consume);
+        sensitive << samples.data_written();
+        dont_initialize();
+
+        SC_METHOD(ring);
+        sensitive << alarm;
+        dont_initialize();
+
+        alarm.notify( 75, SC_NS );
+    }
+
+    void count()
+    {
+        ++edges;
+        checksum = checksum * 3 + edges;
+    }
+
+    void consume()
+    {
+        int sample;
+        while( samples.nb_read( sample ) )
+            total.write( total.read() + sample );
+    }
+
+    void ring()
+    {
+        last_alarm = sc_time_stamp();
+    }
+
+    void checkpoint_state( sc_checkpoint_archive& ar )
+    {
+        ar.io( edges );
+        ar.io( checksum );
+        ar.io( last_alarm );
+    }
+};
+
+SC_MODULE(producer)
+{
+    sc_in<bool>      clk;
+    sc_fifo_out<int> out;
+
+    int              next;
+
+    SC_CTOR(producer)
+      : clk( "clk" ), out( "out" ), next( 1 )
+    {
+        SC_THREAD(run);
+        sensitive << clk.pos();
+    }
+
+    // restarts after a restore, with the state of the checkpoint; it waits
+    // statically, since a dynamic wait is not saved
+    void run()
+    {
+        for( ;; ) {
+            wait();
+            out.write( next );
+            out.write( next * 10 );
+            next += 1;
+        }
+    }
+
+    void checkpoint_state( sc_checkpoint_archive& ar )
+    {
+        ar.io( next );
+    }
+};
+
+SC_MODULE(top)
+{
+    sc_clock      clk;
+    sc_fifo<int>  fifo;
+    producer      prod;
+    accumulator   acc;
+
+    SC_CTOR(top)
+      : clk( "clk", 10, SC_NS ), fifo( "fifo", 4 ), prod( "prod" ),
+        acc( "acc" )
+    {
+        prod.clk( clk );
+        prod.out( fifo );
+        acc.clk( clk );
+        acc.samples( fifo );
+    }
+
+    void report( const char* run )
+    {
+        cout << run << ": time " << sc_time_stamp()
+             << ", clock " << clk.read()
+             << ", edges " << acc.edges
+             << ", checksum " << acc.checksum
+             << ", total " << acc.total.read()
+             << ", next sample " << prod.next
+             << ", alarm at " << acc.last_alarm << endl;
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    const char* file_name = "checkpoint.dat";
+
+    {
+        top t( "top" );
+        sc_start( 52, SC_NS );
+        t.report( "first run" );
+        sc_checkpoint_save( file_name );
+        sc_start( 48, SC_NS );
+        t.report( "first run" );
+    }
+
+    sc_simcontext* first_context = sc_curr_simcontext;
+    sc_curr_simcontext = new sc_simcontext;
+    {
+        top t( "top" );
+        sc_checkpoint_restore( file_name );
+        sc_start( SC_ZERO_TIME );
+        cout << "restored: " << sc_checkpoint_restored() << endl;
+        t.report( "second run" );
+        sc_start( 48, SC_NS );
+        t.report( "second run" );
+    }
+    delete sc_curr_simcontext;
+    sc_curr_simcontext = first_context;
+
+    std::remove( file_name );
+    return 0;
+}
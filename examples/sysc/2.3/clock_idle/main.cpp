@@ -0,0 +1,89 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Clock edges skipped while nobody waits for them.
+
+  A processor model is clocked by a 10 ns clock. Between interrupts, it
+  waits for the interrupt event only, so the clock skips its edges and the
+  simulation time advances from one interrupt to the next. After each
+  interrupt, the processor returns to its static sensitivity for a few
+  cycles, which restarts the clock in phase. The trace of the processor is
+  the same as without idle skipping; only the number of delta cycles drops.
+  Pass "noskip" on the command line to run with idle skipping disabled.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <cstring>
+
+SC_MODULE(cpu)
+{
+    sc_in<bool> clk;
+    sc_event    irq;
+
+    SC_CTOR(cpu)
+    {
+        SC_THREAD(run);
+        sensitive << clk.pos();
+        dont_initialize();
+
+        SC_THREAD(timer);
+    }
+
+    void run()
+    {
+        for( int n = 0; ; ++n ) {
+            for( int i = 0; i < 3; ++i )
+                wait();
+            cout << sc_time_stamp() << ": ran 3 cycles" << endl;
+            if( n == 4 ) break;
+
+            wait( irq );
+            cout << sc_time_stamp() << ": interrupt, clk = "
+                 << clk.read() << endl;
+        }
+    }
+
+    void timer()
+    {
+        // interrupts on a clock edge, before it and inside a cycle
+        const int delay_ns[] = { 100000, 99997, 250006, 1000000 };
+        for( int i = 0; i < 4; ++i ) {
+            wait( delay_ns[i], SC_NS );
+            irq.notify();
+        }
+    }
+};
+
+int sc_main( int argc, char* argv[] )
+{
+    sc_clock clk( "clk", 10, SC_NS );
+    clk.set_idle_skipping( !( argc > 1 && !std::strcmp( argv[1], "noskip" ) ) );
+
+    cpu cpu0( "cpu0" );
+    cpu0.clk( clk );
+
+    sc_start( 2, SC_MS );
+
+    cout << sc_time_stamp() << ": clk = " << clk.read() << endl;
+    cout << "delta cycles: " << sc_delta_count() << endl;
+    return 0;
+}
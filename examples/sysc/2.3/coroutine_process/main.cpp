@@ -0,0 +1,152 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Stackless coroutine processes.
+
+  A producer coroutine with a synchronous reset writes a counter to a
+  signal, waiting for several clock edges between writes. A consumer
+  coroutine waits for the data with a timeout. A spawned coroutine waits
+  for events and terminates by returning, another one is reset and killed
+  via its process handle by a third one.
+
+  Requires SystemC and the example to be compiled for C++20.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+SC_MODULE(producer)
+{
+    sc_in<bool>      clk;
+    sc_in<bool>      rst;
+    sc_out<int>      out;
+
+    SC_CTOR(producer)
+    {
+        SC_COROUTINE(run);
+        sensitive << clk.pos();
+        reset_signal_is( rst, true );
+    }
+
+    sc_coroutine run()
+    {
+        int count = 0;
+        out.write( 0 );
+        cout << sc_time_stamp() << ": " << name() << " reset" << endl;
+        co_await co_wait();
+        for ( ;; )
+        {
+            out.write( ++count );
+            co_await co_wait( 5 );
+        }
+    }
+};
+
+SC_MODULE(consumer)
+{
+    sc_in<int>       in;
+
+    SC_CTOR(consumer)
+    {
+        SC_COROUTINE(run);
+        dont_initialize();
+        sensitive << in;
+    }
+
+    sc_coroutine run()
+    {
+        for ( ;; )
+        {
+            co_await co_wait( sc_time( 35, SC_NS ), in.value_changed_event() );
+            cout << sc_time_stamp() << ": " << name() << " ";
+            if ( in.event() )
+                cout << "received " << in.read() << endl;
+            else
+                cout << "timed out" << endl;
+        }
+    }
+};
+
+sc_event go;
+sc_event done;
+
+sc_coroutine once()
+{
+    co_await co_wait( go );
+    cout << sc_time_stamp() << ": once got go" << endl;
+    co_await co_wait( go & done );
+    cout << sc_time_stamp() << ": once got go and done" << endl;
+}
+
+sc_coroutine ticker()
+{
+    cout << sc_time_stamp() << ": ticker starts" << endl;
+    for ( int i = 0; ; ++i )
+    {
+        co_await co_wait( 20, SC_NS );
+        cout << sc_time_stamp() << ": ticker " << i << endl;
+    }
+}
+
+sc_process_handle ticker_h;
+
+sc_coroutine control()
+{
+    co_await co_wait( 135, SC_NS );
+    ticker_h.reset();
+    co_await co_wait( 100, SC_NS );
+    ticker_h.kill();
+    cout << sc_time_stamp() << ": ticker terminated "
+         << ticker_h.terminated() << endl;
+}
+
+int sc_main( int, char*[] )
+{
+    sc_clock         clk( "clk", 10, SC_NS );
+    sc_signal<bool>  rst( "rst" );
+    sc_signal<int>   data( "data" );
+
+    producer         prod( "producer" );
+    consumer         cons( "consumer" );
+    prod.clk( clk );
+    prod.rst( rst );
+    prod.out( data );
+    cons.in( data );
+
+    sc_process_handle once_h = sc_spawn_coroutine( &once, "once" );
+    ticker_h = sc_spawn_coroutine( &ticker, "ticker" );
+    sc_spawn_coroutine( &control, "control" );
+
+    sc_start( 100, SC_NS );
+    go.notify();
+    done.notify( 5, SC_NS );
+    sc_start( 10, SC_NS );
+    go.notify();
+    sc_start( 10, SC_NS );
+    cout << sc_time_stamp() << ": once terminated " << once_h.terminated()
+         << endl;
+
+    rst = true;
+    sc_start( 20, SC_NS );
+    rst = false;
+    sc_start( 150, SC_NS );
+    return 0;
+}
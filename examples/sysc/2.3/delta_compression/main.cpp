@@ -0,0 +1,210 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Delta cycle compression of combinational method chains.
+
+  Two instances of the same network of combinational methods, a chain of
+  incrementers followed by a doubler and an adder joining both paths
+  again, are driven by a thread. The signals of the second instance are
+  updated within the delta cycle of their writes, so each input settles
+  within one delta cycle instead of one per stage, with the same results.
+  The adder runs twice per input in the first instance, once for each of
+  its inputs. In the second instance it only runs twice for the first
+  input, until the doubler is known to be ranked before it. The signal of
+  the second instance read by a thread stays uncompressed, and since the
+  intermediate sum is overwritten within the same delta cycle there, the
+  thread only sees the final sums.
+
+  A two stage register, whose methods are sensitive to a clock and not to
+  the signal between the stages, shifts the same values with and without
+  compression, regardless of the order of its methods. Its first stage
+  stops being compressed as soon as the second one reads it.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+SC_MODULE(incrementer)
+{
+    sc_in<int>  in;
+    sc_out<int> out;
+
+    SC_CTOR(incrementer)
+      : in( "in" ), out( "out" )
+    {
+        SC_METHOD(run);
+        sensitive << in;
+        dont_initialize();
+    }
+
+    void run()
+        { out.write( in.read() + 1 ); }
+};
+
+SC_MODULE(network)
+{
+    sc_in<int>                 in;
+    sc_vector<sc_signal<int> > chain;
+    sc_signal<int>             doubled;
+    sc_signal<int>             sum;
+    sc_signal<int>             last;
+    sc_vector<incrementer>     stages;
+
+    sc_dt::uint64              start_delta;
+    int                        sums;
+    int                        watched;
+
+    SC_CTOR(network)
+      : in( "in" ), chain( "chain", 8 ), doubled( "doubled" ), sum( "sum" ),
+        last( "last" ), stages( "stages", 8 ), start_delta( 0 ), sums( 0 ),
+        watched( 0 )
+    {
+        stages[0].in( in );
+        stages[0].out( chain[0] );
+        for ( int i = 1; i < 8; ++i )
+        {
+            stages[i].in( chain[i - 1] );
+            stages[i].out( chain[i] );
+        }
+
+        SC_METHOD(double_last);
+        sensitive << chain[7];
+        dont_initialize();
+
+        SC_METHOD(add);
+        sensitive << chain[7] << doubled;
+        dont_initialize();
+
+        SC_METHOD(report);
+        sensitive << sum;
+        dont_initialize();
+
+        SC_THREAD(watch);
+        sensitive << last;
+    }
+
+    void double_last()
+        { doubled.write( 2 * chain[7].read() ); }
+
+    void add()
+    {
+        ++sums;
+        sum.write( chain[7].read() + doubled.read() );
+    }
+
+    void report()
+    {
+        cout << name() << ": sum " << sum.read() << " after "
+             << sc_delta_count() - start_delta << " delta cycles" << endl;
+        last.write( sum.read() );
+    }
+
+    void watch()
+    {
+        for ( ;; )
+        {
+            wait();
+            ++watched;
+        }
+    }
+};
+
+SC_MODULE(registers)
+{
+    sc_in<bool>    clk;
+    sc_signal<int> q1;
+    sc_signal<int> q2;
+    int            n;
+
+    SC_CTOR(registers)
+      : clk( "clk" ), q1( "q1" ), q2( "q2" ), n( 0 )
+    {
+        SC_METHOD(r2);
+        sensitive << clk.pos();
+        dont_initialize();
+
+        SC_METHOD(r1);
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+
+    void r1()
+        { q1.write( ++n ); }
+
+    void r2()
+        { q2.write( q1.read() ); }
+};
+
+SC_MODULE(top)
+{
+    sc_clock       clk;
+    sc_signal<int> stimulus;
+    network        plain;
+    network        compressed;
+    registers      plain_regs;
+    registers      compressed_regs;
+
+    SC_CTOR(top)
+      : clk( "clk", 10, SC_NS ), stimulus( "stimulus" ), plain( "plain" ),
+        compressed( "compressed" ), plain_regs( "plain_regs" ),
+        compressed_regs( "compressed_regs" )
+    {
+        plain.in( stimulus );
+        compressed.in( stimulus );
+        compressed.set_delta_compression();
+        plain_regs.clk( clk );
+        compressed_regs.clk( clk );
+        compressed_regs.set_delta_compression();
+
+        SC_THREAD(drive);
+    }
+
+    void drive()
+    {
+        for ( int i = 1; i <= 3; ++i )
+        {
+            plain.start_delta = compressed.start_delta = sc_delta_count();
+            stimulus.write( 10 * i );
+            wait( 10, SC_NS );
+        }
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    top t( "top" );
+    sc_start( 35, SC_NS );
+
+    cout << "compressed: chain " << t.compressed.chain[0].delta_compression()
+         << ", sum " << t.compressed.sum.delta_compression()
+         << ", last " << t.compressed.last.delta_compression()
+         << ", plain chain " << t.plain.chain[0].delta_compression()
+         << ", stimulus " << t.stimulus.delta_compression() << endl;
+    cout << "watched: " << t.plain.watched << " and "
+         << t.compressed.watched << endl;
+    cout << "sums evaluated: " << t.plain.sums << " and "
+         << t.compressed.sums << endl;
+    cout << "registers: q2 " << t.plain_regs.q2.read() << " and "
+         << t.compressed_regs.q2.read() << ", compressed q1 "
+         << t.compressed_regs.q1.delta_compression() << ", q2 "
+         << t.compressed_regs.q2.delta_compression() << endl;
+    return 0;
+}
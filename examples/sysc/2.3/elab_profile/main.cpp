@@ -0,0 +1,130 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Profile of the elaboration, by module type and phase.
+
+  A system of processing elements, each with a memory, is profiled during
+  its elaboration; a monitor is added in before_end_of_elaboration. Since
+  the times vary from run to run, the example prints the phases and the
+  module types with their counts, and checks that the memory allocated by
+  the memories is charged to them and not to the enclosing modules. Set
+  SC_ELAB_PROFILE=1 (or json) in the environment to see the full report.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <sstream>
+
+SC_MODULE(memory)
+{
+    sc_in<bool>       req;
+    std::vector<char> storage;
+
+    SC_CTOR(memory)
+      : req( "req" ), storage( 64 * 1024 )
+    {
+        SC_METHOD(access);
+        sensitive << req;
+        dont_initialize();
+    }
+
+    void access() {}
+};
+
+SC_MODULE(processing_element)
+{
+    sc_signal<bool> req;
+    memory          mem;
+
+    SC_CTOR(processing_element)
+      : req( "req" ), mem( "mem" )
+    {
+        mem.req( req );
+        SC_THREAD(run);
+    }
+
+    void run() { req.write( true ); }
+};
+
+SC_MODULE(monitor)
+{
+    SC_CTOR(monitor) {}
+};
+
+SC_MODULE(system_top)
+{
+    sc_vector<processing_element> pes;
+    monitor*                      mon;
+
+    SC_CTOR(system_top)
+      : pes( "pe", 8 ), mon( 0 )
+    {}
+
+    void before_end_of_elaboration()
+        { mon = new monitor( "mon" ); }
+
+    ~system_top()
+        { delete mon; }
+};
+
+int sc_main( int, char*[] )
+{
+    sc_elab_profiler& profiler = sc_get_elab_profiler();
+    profiler.enable();
+
+    system_top top( "top" );
+    sc_start( SC_ZERO_TIME );
+
+    std::vector<sc_elab_profiler::entry> phases = profiler.phases();
+    cout << "phases:" << endl;
+    for( std::size_t i = 0; i < phases.size(); ++i )
+        cout << "  " << phases[i].name << ": " << phases[i].count << endl;
+
+    std::vector<sc_elab_profiler::entry> types = profiler.module_types();
+    std::map<std::string, sc_elab_profiler::entry> by_name;
+    bool times_valid = true;
+    for( std::size_t i = 0; i < types.size(); ++i ) {
+        by_name[types[i].name] = types[i];
+        times_valid = times_valid && types[i].time >= 0.0;
+        if( i > 0 )
+            times_valid = times_valid && types[i-1].time >= types[i].time;
+    }
+    cout << "module types:" << endl;
+    std::map<std::string, sc_elab_profiler::entry>::iterator it;
+    for( it = by_name.begin(); it != by_name.end(); ++it )
+        cout << "  " << it->first << ": " << it->second.count << endl;
+    cout << "times sorted: " << ( times_valid ? "yes" : "no" ) << endl;
+
+    const sc_elab_profiler::int64 storage = 8 * 64 * 1024;
+    bool heap_ok = !sc_elab_profiler::heap_measured()
+        || ( by_name["memory"].bytes >= storage
+             && by_name["processing_element"].bytes < storage / 2 );
+    cout << "memory charged to memory: " << ( heap_ok ? "yes" : "no" )
+         << endl;
+
+    std::ostringstream json;
+    profiler.print_json( json );
+    bool json_ok = json.str().find( "\"module_types\": [" ) != std::string::npos
+                && json.str().find( "{ \"name\": \"monitor\", \"modules\": 1" )
+                   != std::string::npos;
+    cout << "json: " << ( json_ok ? "ok" : json.str() ) << endl;
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Waiting for event expressions and persistent event lists.
+
+  A producer notifies one of several events per delta cycle. A thread
+  waits for event expressions, which are built on its stack, and a
+  method waits for expressions through next_trigger() for a while. Two
+  more threads and a method wait over and over for persistent event
+  lists, which stay registered with their events between the waits. The
+  example checks that the waits in the steady state do not allocate
+  from the kernel pool, and that a persistent list survives the
+  destruction of one of its events and the termination of its process.
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include "systemc.h"
+
+SC_MODULE(top)
+{
+    static const int rounds = 1000;
+
+    sc_event          a, b, c, d, e, f;
+    sc_event*         g_p;
+    sc_event_or_list  any;      // persistent, waited for by the thread.
+    sc_event_or_list  wide;     // persistent, more events than stored inline.
+    sc_event_or_list  wakeup;   // persistent, waited for by the method.
+
+    int expr_wakeups, timed_wakeups, timeouts;
+    int method_wakeups, persistent_wakeups, wide_wakeups, wakeup_wakeups;
+    sc_kernel_pool::uint64 expr_allocations, persistent_allocations;
+
+    SC_CTOR(top)
+      : a( "a" ), b( "b" ), c( "c" ), d( "d" ), e( "e" ), f( "f" ),
+        g_p( new sc_event( "g" ) ),
+        expr_wakeups( 0 ), timed_wakeups( 0 ), timeouts( 0 ),
+        method_wakeups( 0 ), persistent_wakeups( 0 ), wide_wakeups( 0 ),
+        wakeup_wakeups( 0 ), expr_allocations( 0 ), persistent_allocations( 0 )
+    {
+        any |= a;
+        any |= b;
+        any |= c;
+        any.set_persistent();
+
+        wide |= a;
+        wide |= b;
+        wide |= c;
+        wide |= d;
+        wide |= e;
+        wide |= f;
+        wide |= *g_p;
+        wide.set_persistent();
+
+        wakeup = d | e;
+        wakeup.set_persistent();
+
+        SC_THREAD(producer);
+        SC_THREAD(expr_waiter);
+        SC_THREAD(persistent_waiter);
+        SC_THREAD(wide_waiter);
+        SC_METHOD(expr_method);
+        SC_METHOD(persistent_method);
+    }
+
+    void producer()
+    {
+        sc_event* events[] = { &a, &b, &c, &d, &e, &f };
+        for( int i = 0; i < 2 * rounds; ++i ) {
+            events[i % 6]->notify( SC_ZERO_TIME );
+            wait( SC_ZERO_TIME );
+            wait( SC_ZERO_TIME );
+        }
+        delete g_p; // still bound through wide
+        g_p = 0;
+        for( int i = 0; i < 6; ++i ) {
+            events[i]->notify( SC_ZERO_TIME );
+            wait( SC_ZERO_TIME );
+            wait( SC_ZERO_TIME );
+        }
+    }
+
+    void expr_waiter()
+    {
+        sc_kernel_pool& pool = sc_get_kernel_pool();
+        for( int i = 0; i < rounds; ++i ) {
+            if( i == 200 )
+                expr_allocations = pool.allocations();
+            wait( a | b | c );
+            ++expr_wakeups;
+        }
+        expr_allocations = pool.allocations() - expr_allocations;
+
+        for( int i = 0; i < 10; ++i ) {
+            wait( sc_time( 1, SC_NS ), d | e );
+            if( d.triggered() || e.triggered() )
+                ++timed_wakeups;
+            else
+                ++timeouts;
+        }
+    }
+
+    void persistent_waiter()
+    {
+        sc_kernel_pool& pool = sc_get_kernel_pool();
+        for( int i = 0; i < rounds / 2; ++i ) {
+            if( i == 200 )
+                persistent_allocations = pool.allocations();
+            wait( any );
+            ++persistent_wakeups;
+            if( i % 100 == 0 )
+                wait( d ); // wait for something else in between
+        }
+        persistent_allocations = pool.allocations() - persistent_allocations;
+    }
+
+    void wide_waiter()
+    {
+        for( ;; ) {
+            wait( wide );
+            ++wide_wakeups;
+        }
+    }
+
+    void expr_method()
+    {
+        // each next_trigger() moves the expression to a list of the pool
+        if( ++method_wakeups < 50 )
+            next_trigger( b | c | f );
+    }
+
+    void persistent_method()
+    {
+        ++wakeup_wakeups;
+        next_trigger( wakeup );
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    top t( "top" );
+    sc_start();
+
+    cout << "expression wakeups: " << t.expr_wakeups
+         << ", allocations: " << t.expr_allocations << endl;
+    cout << "timed expression wakeups: " << t.timed_wakeups
+         << ", timeouts: " << t.timeouts << endl;
+    cout << "method wakeups: " << t.method_wakeups << endl;
+    cout << "persistent list wakeups: " << t.persistent_wakeups
+         << ", allocations: " << t.persistent_allocations << endl;
+    cout << "wide persistent list size: " << t.wide.size()
+         << ", wakeups: " << t.wide_wakeups << endl;
+    cout << "persistent method wakeups: " << t.wakeup_wakeups << endl;
+    cout << "simulation ended at " << sc_time_stamp() << endl;
+    return 0;
+}
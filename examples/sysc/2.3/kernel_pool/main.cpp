@@ -0,0 +1,106 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Kernel objects allocated from the pool of the simulation
+              context.
+
+  A dispatcher spawns a short-lived worker per job, each of which waits
+  for a timed notification or a timeout on an event list and notifies
+  the dispatcher when done. After a warm-up, the pool serves the events,
+  timed notifications, event lists and processes of the steady state from
+  its free lists without adding blocks. Since the block counts depend on
+  the platform, the example prints whether the counters behave as
+  expected rather than the counters themselves.
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include "systemc.h"
+
+SC_MODULE(dispatcher)
+{
+    sc_event done;
+    int      jobs_done;
+
+    SC_CTOR(dispatcher)
+      : done( "done" ), jobs_done( 0 )
+    {
+        SC_THREAD(run);
+    }
+
+    void worker( int job )
+    {
+        sc_event* ready_p = new sc_event;
+        ready_p->notify( job % 3 + 1, SC_NS );
+        wait( sc_time( 5, SC_NS ), *ready_p | done );
+        delete ready_p;
+        ++jobs_done;
+        done.notify( SC_ZERO_TIME );
+    }
+
+    void batch( int first, int count )
+    {
+        for( int i = first; i < first + count; ++i ) {
+            sc_spawn( sc_bind( &dispatcher::worker, this, i ) );
+        }
+        while( jobs_done < first + count )
+            wait( done );
+        wait( 10, SC_NS ); // let the workers terminate
+    }
+
+    void run()
+    {
+        sc_kernel_pool& pool = sc_get_kernel_pool();
+
+        batch( 0, 100 );  // warm-up
+
+        sc_kernel_pool::uint64 blocks = pool.blocks();
+        sc_kernel_pool::uint64 recycled = pool.recycled();
+        sc_kernel_pool::uint64 live = pool.live();
+
+        for( int i = 1; i <= 20; ++i )
+            batch( i * 100, 100 );
+
+        cout << "jobs done: " << jobs_done << endl;
+        cout << "blocks added in steady state: "
+             << ( pool.blocks() == blocks ? "no" : "yes" ) << endl;
+        cout << "cells recycled: "
+             << ( pool.recycled() - recycled >= 2000 * 4 ? "yes" : "no" )
+             << endl;
+        cout << "cells live as after warm-up: "
+             << ( pool.live() == live ? "yes" : "no" ) << endl;
+        cout << "passed to the heap: " << pool.heap_allocations() << endl;
+
+        sc_event* event_p = new ( std::nothrow ) sc_event;
+        cout << "nothrow event from the pool: "
+             << ( event_p && pool.live() == live + 1 ? "yes" : "no" ) << endl;
+        delete event_p;
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    dispatcher d( "d" );
+    sc_start();
+
+    cout << "simulation ended at " << sc_time_stamp() << endl;
+    return 0;
+}
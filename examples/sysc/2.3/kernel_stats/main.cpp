@@ -0,0 +1,120 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Performance counters of the simulation kernel.
+
+  A producer thread writes a signal every 10 ns, which two consumer
+  methods sum up; it also notifies and cancels a watchdog event. The
+  counters of the kernel are compared with the expected values, which
+  golden_stats.log records for a library built with ENABLE_KERNEL_STATS.
+  Otherwise the counters stay zero, as golden.log records. Set
+  SC_KERNEL_STATS=1 in the environment to see the full statistics at the
+  end of the simulation.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+SC_MODULE(producer)
+{
+    sc_out<int> out;
+    sc_event    watchdog;
+
+    SC_CTOR(producer)
+    {
+        SC_THREAD(run);
+    }
+
+    void run()
+    {
+        for( int i = 1; i <= 10; ++i ) {
+            out.write( i );
+            watchdog.notify( 100, SC_NS );
+            if( i % 2 == 0 )
+                watchdog.cancel();
+            wait( 10, SC_NS );
+        }
+    }
+};
+
+SC_MODULE(consumer)
+{
+    sc_in<int> in;
+    int        sum;
+
+    SC_CTOR(consumer)
+      : sum( 0 )
+    {
+        SC_METHOD(add);
+        sensitive << in;
+        dont_initialize();
+    }
+
+    void add()
+        { sum += in.read(); }
+};
+
+typedef sc_kernel_stats::uint64 uint64;
+
+static void check( const char* name, uint64 value, uint64 expected )
+{
+    cout << name << ": ";
+    if( value == expected )
+        cout << "ok" << endl;
+    else
+        cout << value << ", expected " << expected << endl;
+}
+
+int sc_main( int, char*[] )
+{
+    sc_signal<int> sig( "sig" );
+    producer       prod( "prod" );
+    consumer       cons0( "cons0" );
+    consumer       cons1( "cons1" );
+
+    prod.out( sig );
+    cons0.in( sig );
+    cons1.in( sig );
+
+    sc_start();
+
+    cout << "sums: " << cons0.sum << " " << cons1.sum << endl;
+    cout << "kernel stats: "
+         << ( sc_kernel_stats::enabled() ? "enabled" : "disabled" ) << endl;
+
+    const sc_kernel_stats& stats = sc_get_kernel_stats();
+    check( "delta cycles", stats.delta_cycles(), sc_delta_count() );
+    check( "time steps", stats.time_steps(), 10 );
+    check( "method runs", stats.method_runs(), 20 );
+    check( "thread runs", stats.thread_runs(), 11 );
+    check( "methods per delta", stats.max_methods_per_delta(), 2 );
+    check( "threads per delta", stats.max_threads_per_delta(), 1 );
+    check( "context switches", stats.context_switches(), 22 );
+    check( "channel updates", stats.channel_updates(), 10 );
+    check( "timed notifications", stats.timed_notifications(), 20 );
+    check( "cancellations", stats.cancellations(), 5 );
+
+    std::vector<sc_kernel_stats::process_info> procs = stats.processes();
+    for( std::size_t i = 0; i < procs.size(); ++i )
+        if( procs[i].name == "cons0.add" )
+            check( "runs of cons0.add", procs[i].runs, 10 );
+    return 0;
+}
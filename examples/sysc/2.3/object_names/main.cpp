@@ -0,0 +1,153 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Naming and finding objects and events.
+
+  A platform of clusters of cores, each with a signal, an event and a
+  process, is elaborated and every object and event is found again by its
+  hierarchical name. Clashing names, illegal characters, external names and
+  the reuse of the name of a deleted object are exercised as well. The
+  warnings about renamed objects are counted instead of displayed.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <sstream>
+
+SC_MODULE(core)
+{
+    sc_signal<bool> irq;
+    sc_event        done;
+
+    SC_CTOR(core)
+      : irq( "irq" ), done( "done" )
+    {
+        SC_METHOD(run);
+        sensitive << irq;
+        dont_initialize();
+    }
+
+    void run() {}
+};
+
+SC_MODULE(cluster)
+{
+    sc_vector<core> cores;
+
+    cluster( sc_module_name nm, int cores_n )
+      : sc_module( nm ), cores( "core", cores_n )
+    {}
+};
+
+SC_MODULE(top)
+{
+    sc_vector<cluster> clusters;
+
+    static cluster* create_cluster( const char* nm, std::size_t )
+        { return new cluster( nm, 25 ); }
+
+    SC_CTOR(top)
+      : clusters( "cluster" )
+    {
+        clusters.init( 40, &top::create_cluster );
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    sc_report_handler::set_actions( SC_WARNING, SC_DO_NOTHING );
+
+    top t( "top" );
+
+    // find every core, signal, event and process by name
+
+    int found = 0;
+    int expected = 0;
+    for( int c = 0; c < 40; ++c ) {
+        for( int i = 0; i < 25; ++i ) {
+            std::ostringstream nm;
+            nm << "top.cluster_" << c << ".core_" << i;
+            std::string core_name = nm.str();
+            core* core_p = &t.clusters[c].cores[i];
+            expected += 4;
+            found += sc_find_object( core_name.c_str() ) == core_p;
+            found += sc_find_object( ( core_name + ".irq" ).c_str() )
+                     == &core_p->irq;
+            found += sc_find_object( ( core_name + ".run" ).c_str() ) != 0;
+            found += sc_find_event( ( core_name + ".done" ).c_str() )
+                     == &core_p->done;
+        }
+    }
+    cout << "found " << found << " of " << expected << endl;
+    cout << "top.cluster_3.core_7.irq: "
+         << t.clusters[3].cores[7].irq.name() << " ("
+         << t.clusters[3].cores[7].irq.basename() << ")" << endl;
+    cout << "top.cluster_3.core_7.done: "
+         << t.clusters[3].cores[7].done.name() << " ("
+         << t.clusters[3].cores[7].done.basename() << ")" << endl;
+    cout << "top.cluster_40: "
+         << ( sc_find_object( "top.cluster_40" ) ? "found" : "not found" )
+         << endl;
+    cout << "top.cluster_3.core_7.irq as event: "
+         << ( sc_find_event( "top.cluster_3.core_7.irq" ) ? "found"
+                                                          : "not found" )
+         << endl;
+
+    // clashing names and illegal characters are replaced
+
+    sc_signal<int>* a_p = new sc_signal<int>( "spare" );
+    sc_signal<int>* b_p = new sc_signal<int>( "spare" );
+    sc_signal<int>  c( "has space" );
+    cout << "spare, spare, has space: " << a_p->name() << ", "
+         << b_p->name() << ", " << c.name() << endl;
+    cout << "warnings: " << sc_report_handler::get_count( SC_WARNING )
+         << endl;
+
+    // external names
+
+    cout << "register top.cluster_0.debug: "
+         << sc_register_hierarchical_name( &t.clusters[0], "debug" ) << endl;
+    cout << "exists top.cluster_0.debug: "
+         << sc_hierarchical_name_exists( "top.cluster_0.debug" ) << endl;
+    cout << "exists top.cluster_0.core_3: "
+         << sc_hierarchical_name_exists( &t.clusters[0], "core_3" ) << endl;
+    cout << "register top.cluster_0.core_3: "
+         << sc_register_hierarchical_name( &t.clusters[0], "core_3" )
+         << endl;
+    cout << "unregister top.cluster_0.debug: "
+         << sc_unregister_hierarchical_name( "top.cluster_0.debug" ) << endl;
+    cout << "exists top.cluster_0.debug: "
+         << sc_hierarchical_name_exists( &t.clusters[0], "debug" ) << endl;
+
+    // the name of a deleted object can be used again
+
+    delete a_p;
+    cout << "spare after delete: "
+         << ( sc_find_object( "spare" ) ? "found" : "not found" ) << endl;
+    sc_signal<int> d( "spare" );
+    cout << "spare again: " << d.name() << ", "
+         << ( sc_find_object( "spare" ) == &d ? "found" : "not found" )
+         << endl;
+    delete b_p;
+
+    sc_start( 1, SC_NS );
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Evaluation of parallel-safe SC_METHODs on host threads.
+
+  A ring of lanes is clocked by a common clock. Each lane is an SC_METHOD
+  marked parallel_safe(), which reads its neighbour's output signal,
+  writes its own output, notifies an event and issues reports. Monitors
+  use dynamic sensitivity via next_trigger(). Each lane also keeps a bank
+  of signals, enough of them for the update phase to use the worker pool.
+  The output is the same for any number of worker threads, e.g.
+  SC_PARALLEL_WORKERS=1 or 8.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+static const int lanes_n = 8;
+static const int bank_n = 200;
+
+SC_MODULE(lane)
+{
+    sc_in<bool>      clk;
+    sc_in<unsigned>  in;
+    sc_out<unsigned> out;
+
+    sc_event         pulse;
+    sc_signal<unsigned> bank[bank_n];
+
+    SC_HAS_PROCESS(lane);
+
+    lane( sc_module_name name, unsigned seed )
+      : sc_module( name ), m_state( seed )
+    {
+        SC_METHOD(step);
+        sensitive << clk.pos();
+        dont_initialize();
+        parallel_safe();
+    }
+
+    void step()
+    {
+        unsigned sum = 0;
+        for ( int j = 0; j < bank_n; ++j )
+            sum ^= bank[j].read();
+
+        unsigned v = ( in.read() + m_state + sum ) | 1u;
+        for ( int i = 0; i < 10000; ++i ) {
+            v ^= v << 13;
+            v ^= v >> 17;
+            v ^= v << 5;
+        }
+        m_state = v;
+        out.write( v );
+        for ( int j = 0; j < bank_n; ++j )
+            bank[j].write( v * ( j + 1 ) );
+
+        if ( (v & 3) == 0 ) {
+            pulse.notify( SC_ZERO_TIME );
+            SC_REPORT_INFO( "/parallel/lane", name() );
+        }
+    }
+
+    unsigned m_state;
+};
+
+SC_MODULE(monitor)
+{
+    sc_event* pulse_p;
+
+    SC_CTOR(monitor)
+      : pulse_p( 0 ), m_count( 0 )
+    {
+        SC_METHOD(observe);
+        parallel_safe();
+    }
+
+    void observe()
+    {
+        if ( sc_delta_count() != 0 )
+            ++m_count;
+        next_trigger( *pulse_p );
+    }
+
+    int m_count;
+};
+
+SC_MODULE(checker)
+{
+    sc_in<bool>      clk;
+    sc_in<unsigned>  lane_out[lanes_n];
+
+    SC_CTOR(checker)
+    {
+        SC_METHOD(check);
+        sensitive << clk.neg();
+        dont_initialize();
+    }
+
+    void check()
+    {
+        unsigned sum = 0;
+        for ( int i = 0; i < lanes_n; ++i )
+            sum ^= lane_out[i].read();
+        cout << sc_time_stamp() << ": checksum " << hex << sum << dec << endl;
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    sc_set_parallel_workers( 4 );
+
+    sc_clock         clk( "clk", 10, SC_NS );
+    sc_signal<unsigned> ring[lanes_n];
+    lane*            lanes[lanes_n];
+    monitor*         monitors[lanes_n];
+    checker          check( "check" );
+
+    check.clk( clk );
+    for ( int i = 0; i < lanes_n; ++i )
+    {
+        lanes[i] = new lane( sc_gen_unique_name( "lane" ), 2654435761u * i );
+        lanes[i]->clk( clk );
+        lanes[i]->in( ring[ (i + lanes_n - 1) % lanes_n ] );
+        lanes[i]->out( ring[i] );
+        monitors[i] = new monitor( sc_gen_unique_name( "monitor" ) );
+        monitors[i]->pulse_p = &lanes[i]->pulse;
+        check.lane_out[i]( ring[i] );
+    }
+
+    sc_start( 100, SC_NS );
+
+    for ( int i = 0; i < lanes_n; ++i )
+    {
+        cout << monitors[i]->name() << ": " << monitors[i]->m_count
+             << " pulses" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Resolution of ports bound to ports.
+
+  A signal reaches a process through a long chain of ports bound to ports,
+  and a multiport collects the signals of several parent multiports, one
+  of which is left unbound. A row of sinks is bound to a vector of signals
+  with batch_bind. The processes are sensitive to the signals through the
+  chained ports.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+typedef sc_port<sc_signal_in_if<int>, 0, SC_ZERO_OR_MORE_BOUND> multi_in;
+
+SC_MODULE(sink)
+{
+    sc_in<int> in;
+    int        changes;
+
+    SC_CTOR(sink)
+      : in( "in" ), changes( 0 )
+    {
+        SC_METHOD(count);
+        sensitive << in;
+        dont_initialize();
+    }
+
+    void count() { ++changes; }
+};
+
+SC_MODULE(collector)
+{
+    multi_in in;
+    int      changes;
+
+    SC_CTOR(collector)
+      : in( "in" ), changes( 0 )
+    {
+        SC_METHOD(count);
+        sensitive << in;
+        dont_initialize();
+    }
+
+    void count() { ++changes; }
+};
+
+SC_MODULE(top)
+{
+    static const int chain_length = 5000;
+    static const int sinks_n = 8;
+
+    sc_signal<int>             sig;
+    sc_vector< sc_in<int> >    chain;
+    sink                       end;
+
+    sc_vector< sc_signal<int> > bus;
+    multi_in                    left, right, spare;
+    collector                   coll;
+
+    sc_vector< sc_signal<int> > wires;
+    sc_vector<sink>             sinks;
+
+    SC_CTOR(top)
+      : sig( "sig" ), chain( "chain", chain_length ), end( "end" ),
+        bus( "bus", 4 ), left( "left" ), right( "right" ), spare( "spare" ),
+        coll( "coll" ), wires( "wire", sinks_n ), sinks( "sink", sinks_n )
+    {
+        // the first port of the chain is the farthest from the signal, so
+        // completing its binding resolves the whole chain
+
+        end.in( chain[0] );
+        for( int i = 0; i < chain_length - 1; ++i )
+            chain[i]( chain[i + 1] );
+        chain[chain_length - 1]( sig );
+
+        left( bus[0] );
+        left( bus[1] );
+        right( bus[2] );
+        right( bus[3] );
+        coll.in( left );
+        coll.in( spare );
+        coll.in( right );
+
+        sc_assemble_vector( sinks, &sink::in ).batch_bind( wires );
+
+        SC_THREAD(stimulus);
+    }
+
+    void stimulus()
+    {
+        for( int i = 1; i <= 3; ++i ) {
+            sig.write( i );
+            for( int j = 0; j < 4; ++j )
+                bus[j].write( i * 10 + j );
+            for( int j = 0; j < sinks_n; ++j )
+                if( j % 2 || i == 1 )
+                    wires[j].write( i );
+            wait( 1, SC_NS );
+        }
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    top t( "top" );
+    sc_start();
+
+    cout << "end of chain bound to "
+         << dynamic_cast<sc_object*>( t.end.in[0] )->name() << endl;
+    cout << "end of chain changes: " << t.end.changes << endl;
+
+    cout << "collector interfaces: " << t.coll.in.size() << endl;
+    for( int i = 0; i < t.coll.in.size(); ++i )
+        cout << "  " << dynamic_cast<sc_object*>( t.coll.in[i] )->name()
+             << " = " << t.coll.in[i]->read() << endl;
+    cout << "collector changes: " << t.coll.changes << endl;
+
+    cout << "sink changes:";
+    for( int i = 0; i < top::sinks_n; ++i )
+        cout << " " << t.sinks[i].changes;
+    cout << endl;
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Host time of the processes, by process and module.
+
+  A generator thread drives a pipeline of two filter stages with method
+  processes, and each stage spawns a short lived checker thread for the
+  odd samples. The simulation is profiled with every second activation
+  of each process name timed, so the checkers of a stage, which share
+  their name, are sampled together. Since the times vary from run to run, the
+  example prints the activations of the processes and modules and the
+  stacks of the folded profile without their times, with blanks for the
+  semicolons. Set SC_PROCESS_PROFILE=<file> in the environment to write
+  the folded profile of any simulation to a file.
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include "systemc.h"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+SC_MODULE(stage)
+{
+    sc_in<int>      in;
+    sc_out<int>     out;
+
+    int             checked;
+
+    SC_CTOR(stage)
+      : in( "in" ), out( "out" ), checked( 0 )
+    {
+        SC_METHOD(filter);
+        sensitive << in;
+        dont_initialize();
+    }
+
+    void filter()
+    {
+        int value = in.read();
+        out.write( value * 3 + 1 );
+        if ( value % 2 )
+            sc_spawn( sc_bind( &stage::check, this ), "check" );
+    }
+
+    void check()
+    {
+        ++checked;
+    }
+};
+
+SC_MODULE(pipeline)
+{
+    sc_signal<int>  source, middle, sink;
+    stage           first, second;
+
+    SC_CTOR(pipeline)
+      : source( "source" ), middle( "middle" ), sink( "sink" ),
+        first( "first" ), second( "second" )
+    {
+        first.in( source );
+        first.out( middle );
+        second.in( middle );
+        second.out( sink );
+
+        SC_THREAD(generate);
+    }
+
+    void generate()
+    {
+        for ( int i = 1; i <= 10; ++i )
+        {
+            source.write( i );
+            wait( 10, SC_NS );
+        }
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    pipeline top( "top" );
+
+    sc_process_profiler& profiler = sc_get_process_profiler();
+    profiler.enable( true, 2 );
+    sc_start();
+
+    std::map<std::string, sc_process_profiler::entry> by_name;
+    std::vector<sc_process_profiler::entry> entries = profiler.processes();
+    for ( std::size_t i = 0; i < entries.size(); ++i )
+        by_name[ entries[i].name ] = entries[i];
+    cout << "processes:" << endl;
+    std::map<std::string, sc_process_profiler::entry>::const_iterator it;
+    for ( it = by_name.begin(); it != by_name.end(); ++it )
+        cout << "  " << it->first << ": " << it->second.runs
+             << " runs, " << it->second.sampled << " timed" << endl;
+
+    by_name.clear();
+    entries = profiler.modules();
+    for ( std::size_t i = 0; i < entries.size(); ++i )
+        by_name[ entries[i].name ] = entries[i];
+    cout << "modules:" << endl;
+    for ( it = by_name.begin(); it != by_name.end(); ++it )
+        cout << "  " << it->first << ": " << it->second.runs
+             << " runs, " << it->second.sampled << " timed" << endl;
+
+    std::stringstream folded;
+    profiler.print_folded( folded );
+    std::map<std::string, bool> stacks;
+    std::string line;
+    while ( std::getline( folded, line ) )
+    {
+        std::string::size_type pos = line.rfind( ' ' );
+        std::string time = line.substr( pos + 1 );
+        std::string stack = line.substr( 0, pos );
+        std::replace( stack.begin(), stack.end(), ';', ' ' );
+        stacks[ stack ] =
+            !time.empty() && time.find_first_not_of( "0123456789" )
+                             == std::string::npos;
+    }
+    cout << "folded stacks:" << endl;
+    std::map<std::string, bool>::const_iterator st;
+    for ( st = stacks.begin(); st != stacks.end(); ++st )
+        cout << "  " << st->first << ( st->second ? "" : " (no time)" )
+             << endl;
+
+    cout << "checked: " << top.first.checked << " and "
+         << top.second.checked << endl;
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Reports filtered by their verbosity, and many message types.
+
+  A process issues a debug report per cycle, which the default verbosity
+  filters before its message is even composed. A report used within an
+  expression evaluates its verbosity once. Then a few hundred message
+  types are registered and counted, one of them is configured to be
+  silent, and the message types are released again.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <sstream>
+
+static int composed = 0;
+
+static const char* describe( int cycle )
+{
+    static std::string text;
+    ++composed;
+    text = "cycle " + sc_time_stamp().to_string();
+    (void) cycle;
+    return text.c_str();
+}
+
+SC_MODULE(core)
+{
+    SC_CTOR(core)
+    {
+        SC_THREAD(run);
+    }
+
+    void run()
+    {
+        for( int cycle = 0; cycle < 100000; ++cycle ) {
+            SC_REPORT_INFO_VERB( "/demo/core", describe( cycle ), SC_DEBUG );
+            wait( 1, SC_NS );
+        }
+        SC_REPORT_INFO_VERB( "/demo/core", describe( -1 ), SC_LOW );
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    core c( "core" );
+    sc_start();
+    cout << "composed " << composed << " message(s)" << endl;
+
+    int evaluated = 0;
+    bool shown = true;
+    shown ? SC_REPORT_INFO_VERB( "/demo/core", "within an expression",
+                                 ( ++evaluated, SC_LOW ) )
+          : (void) 0;
+    cout << "verbosity evaluated " << evaluated << " time(s)" << endl;
+
+    // many message types
+
+    std::vector<std::string> types;
+    for( int i = 0; i < 300; ++i ) {
+        std::ostringstream type;
+        type << "/demo/type_" << i;
+        types.push_back( type.str() );
+    }
+    sc_report_handler::set_actions( SC_WARNING, SC_DO_NOTHING );
+    for( int i = 0; i < 300; ++i )
+        for( int j = 0; j <= i % 3; ++j )
+            SC_REPORT_WARNING( types[i].c_str(), "counted" );
+
+    int total = 0;
+    for( int i = 0; i < 300; ++i )
+        total += sc_report_handler::get_count( types[i].c_str() );
+    cout << "counted " << total << " warning(s)" << endl;
+
+    sc_report_handler::set_actions( SC_WARNING, SC_DEFAULT_WARNING_ACTIONS );
+    sc_report_handler::set_actions( "/demo/type_7", SC_DO_NOTHING );
+    SC_REPORT_INFO( "/demo/type_7", "silent" );
+    SC_REPORT_INFO( "/demo/type_8", "displayed" );
+    cout << "/demo/type_7: " << sc_report_handler::get_count( "/demo/type_7" )
+         << " report(s)" << endl;
+
+    // the released message types start over
+
+    sc_report_handler::release();
+    cout << "/demo/type_7 after release: "
+         << sc_report_handler::get_count( "/demo/type_7" ) << " report(s)"
+         << endl;
+    SC_REPORT_INFO( "/demo/type_7", "displayed again" );
+    return 0;
+}
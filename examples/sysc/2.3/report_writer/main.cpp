@@ -0,0 +1,120 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Reports displayed and logged on a host thread.
+
+  A process traces each transfer to the display and to a log file through
+  the report writer, whose small buffer wraps around many times. The last
+  transfer fails with an error, which is only logged and thrown; the
+  writer flushes the buffer before the error is thrown, so the error is
+  in the log file when it is caught.
+
+  Then a report almost as large as the buffer is logged to another log
+  file, after a short one, so it only fits once the buffer runs empty.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+SC_MODULE(dma)
+{
+    SC_CTOR(dma)
+    {
+        SC_THREAD(run);
+    }
+
+    void run()
+    {
+        for( int i = 0; i < 500; ++i ) {
+            wait( 10, SC_NS );
+            std::ostringstream msg;
+            msg << "transfer " << i << " of " << ( i % 7 + 1 ) * 64
+                << " bytes";
+            if( i % 100 == 0 )
+                SC_REPORT_INFO( "/demo/dma", msg.str().c_str() );
+            else
+                SC_REPORT_INFO_VERB( "/demo/dma/trace", msg.str().c_str(),
+                                     SC_MEDIUM );
+        }
+        SC_REPORT_ERROR( "/demo/dma", "bus error" );
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    const char* log_name = "report_writer.log";
+
+    sc_report_handler::set_log_file_name( log_name );
+    sc_report_handler::set_actions( "/demo/dma/trace", SC_LOG );
+    sc_report_handler::set_actions( SC_INFO, SC_DISPLAY | SC_LOG );
+    sc_report_handler::set_actions( SC_ERROR, SC_LOG | SC_THROW );
+    sc_report_writer::start( 4096 );
+
+    dma d( "dma" );
+    try {
+        sc_start();
+    }
+    catch( const sc_report& rep ) {
+        cout << "\ncaught " << rep.get_msg() << " @ " << rep.get_time()
+             << endl;
+    }
+    sc_report_close_default_log();
+
+    std::ifstream log( log_name );
+    std::string line;
+    int lines = 0;
+    bool error_logged = false;
+    while( std::getline( log, line ) ) {
+        ++lines;
+        if( line.find( "Error: /demo/dma: bus error" ) != std::string::npos )
+            error_logged = true;
+    }
+    cout << log_name << ": " << lines << " lines, error logged: "
+         << ( error_logged ? "yes" : "no" ) << endl;
+
+    const char* long_log_name = "report_writer_long.log";
+    const std::string long_msg( 3800, 'x' );
+
+    sc_report_handler::set_log_file_name( long_log_name );
+    sc_report_handler::set_actions( "/demo/long", SC_LOG );
+    SC_REPORT_INFO( "/demo/long", "short" );
+    SC_REPORT_INFO( "/demo/long", long_msg.c_str() );
+    sc_report_close_default_log();
+
+    std::ifstream long_log( long_log_name );
+    lines = 0;
+    bool long_logged = false;
+    while( std::getline( long_log, line ) ) {
+        ++lines;
+        if( line.find( long_msg ) != std::string::npos )
+            long_logged = true;
+    }
+    cout << long_log_name << ": " << lines << " lines, long report logged: "
+         << ( long_logged ? "yes" : "no" ) << endl;
+
+    sc_report_writer::stop();
+    std::remove( log_name );
+    std::remove( long_log_name );
+    return 0;
+}
@@ -0,0 +1,323 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Indexed waveform (SIW) tracing.
+
+  The signals of a counter are traced into a VCD file and into a SIW file
+  with small blocks. After the simulation, a minimal reader looks up the
+  values of the signals at a few times in the SIW file, using the index to
+  find the block and the section sizes of the block to find the signal,
+  without decoding the other blocks and signals. With zlib, the sections
+  are compressed, and the reader inflates the one it looks up. The values
+  are checked against the counter, and both files are removed.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#if defined(SC_HAVE_ZLIB)
+#  include <zlib.h>
+#endif
+
+SC_MODULE(counter)
+{
+    sc_in<bool>             clk;
+
+    sc_signal<int>          count;
+    sc_signal<bool>         odd;
+    sc_signal<sc_uint<12> > scaled;
+    sc_signal<double>       ratio;
+
+    SC_CTOR(counter)
+      : clk( "clk" ), count( "count" ), odd( "odd" ), scaled( "scaled" ),
+        ratio( "ratio" )
+    {
+        SC_METHOD(step);
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+
+    void step()
+    {
+        int next = count.read() + 1;
+        count.write( next );
+        odd.write( next % 2 != 0 );
+        scaled.write( 3 * next );
+        ratio.write( next / 4.0 );
+    }
+};
+
+SC_MODULE(top)
+{
+    sc_clock clk;
+    counter  cnt;
+
+    SC_CTOR(top)
+      : clk( "clk", 10, SC_NS ), cnt( "cnt" )
+    {
+        cnt.clk( clk );
+    }
+};
+
+void trace_all( sc_trace_file* tf, const top& t )
+{
+    tf->set_time_unit( 1, SC_NS );
+    sc_trace( tf, t.clk, "clk" );
+    sc_trace( tf, t.cnt.count, "cnt.count" );
+    sc_trace( tf, t.cnt.odd, "cnt.odd" );
+    sc_trace( tf, t.cnt.scaled, "cnt.scaled" );
+    sc_trace( tf, t.cnt.ratio, "cnt.ratio" );
+}
+
+// ----------------------------------------------------------------------------
+//  A minimal reader of SIW files, see sysc/tracing/sc_siw_trace.h
+// ----------------------------------------------------------------------------
+
+struct siw_bytes
+{
+    std::vector<unsigned char> data;
+    std::size_t                pos;
+
+    siw_bytes()
+      : pos( 0 )
+    {}
+
+    sc_dt::uint64 varint()
+    {
+        sc_dt::uint64 v = 0;
+        for ( int shift = 0; ; shift += 7 )
+        {
+            unsigned char byte = data[pos++];
+            v |= static_cast<sc_dt::uint64>( byte & 0x7f ) << shift;
+            if ( !( byte & 0x80 ) )
+                return v;
+        }
+    }
+
+    sc_dt::uint64 offset()
+    {
+        sc_dt::uint64 v = 0;
+        for ( int i = 0; i < 8; ++i )
+            v |= static_cast<sc_dt::uint64>( data[pos++] ) << ( 8 * i );
+        return v;
+    }
+
+    std::string string()
+    {
+        std::size_t n = static_cast<std::size_t>( varint() );
+        std::string s( data.begin() + pos, data.begin() + pos + n );
+        pos += n;
+        return s;
+    }
+};
+
+struct siw_reader : siw_bytes
+{
+    bool                       compressed;
+    std::vector<std::string>   names;
+    std::vector<int>           kinds;
+    std::vector<int>           widths;
+    std::vector<sc_dt::uint64> starts;   // of the blocks.
+    std::vector<sc_dt::uint64> offsets;  // of the blocks.
+
+    explicit siw_reader( const char* file_name )
+      : compressed( false )
+    {
+        std::ifstream is( file_name, std::ios::binary );
+        data.assign( std::istreambuf_iterator<char>( is ),
+                     std::istreambuf_iterator<char>() );
+        if ( data.size() < 16 ||
+             std::string( data.begin(), data.begin() + 4 ) != "SIW\1" ||
+             std::string( data.end() - 4, data.end() ) != "SIWX" )
+        {
+            data.clear();
+            return;
+        }
+
+        pos = 4;
+        varint();                     // time unit
+        compressed = varint() != 0;
+        string();                     // date
+        string();                     // version
+        sc_dt::uint64 n = varint();
+        for ( sc_dt::uint64 i = 0; i < n; ++i )
+        {
+            names.push_back( string() );
+            kinds.push_back( data[pos++] );
+            widths.push_back( static_cast<int>( varint() ) );
+        }
+
+        pos = data.size() - 12;
+        pos = static_cast<std::size_t>( offset() );
+        if ( data[pos++] != 'I' )
+            return;
+        n = varint();
+        for ( sc_dt::uint64 i = 0; i < n; ++i )
+        {
+            starts.push_back( varint() );
+            varint();                 // end
+            offsets.push_back( offset() );
+        }
+    }
+
+    std::string value( int signal, siw_bytes& s )
+    {
+        if ( kinds[signal] == 1 )
+            return s.string();
+        if ( widths[signal] == 1 )
+            return std::string( 1, static_cast<char>( s.data[s.pos++] ) );
+        std::size_t n = static_cast<std::size_t>( s.varint() );
+        std::string bits;
+        for ( std::size_t i = 0; i < n; ++i )
+            bits += "01xz"[ ( s.data[s.pos + i / 4] >> ( 2 * ( i % 4 ) ) ) & 3 ];
+        s.pos += ( n + 3 ) / 4;
+        return bits;
+    }
+
+    // the section at pos, inflated if compressed
+    bool section( std::size_t size, siw_bytes& s )
+    {
+        std::size_t end = pos + size;
+        if ( compressed )
+        {
+            std::size_t n = static_cast<std::size_t>( varint() );
+            if ( end - pos != n )
+            {
+#if defined(SC_HAVE_ZLIB)
+                s.data.resize( n );
+                uLongf length = static_cast<uLongf>( n );
+                return uncompress( &s.data[0], &length, &data[pos],
+                                   static_cast<uLong>( end - pos ) ) == Z_OK &&
+                       length == n;
+#else
+                return false;
+#endif
+            }
+        }
+        s.data.assign( data.begin() + pos, data.begin() + end );
+        return true;
+    }
+
+    int find( const std::string& name ) const
+    {
+        for ( std::size_t i = 0; i < names.size(); ++i )
+            if ( names[i] == name )
+                return static_cast<int>( i );
+        return -1;
+    }
+
+    // the value of a signal at a time, with the block found in the index
+    std::string value_at( int signal, sc_dt::uint64 time )
+    {
+        std::size_t b =
+            std::upper_bound( starts.begin(), starts.end(), time )
+            - starts.begin();
+        if ( b == 0 )
+            return "";
+        pos = static_cast<std::size_t>( offsets[b - 1] ) + 1;
+        sc_dt::uint64 t = varint();   // start
+        varint();                     // end
+        sc_dt::uint64 n = varint();
+        std::size_t skip = 0, size = 0;
+        for ( sc_dt::uint64 i = 0; i < n; ++i )
+        {
+            std::size_t length = static_cast<std::size_t>( varint() );
+            if ( static_cast<int>( i ) < signal )
+                skip += length;
+            else if ( static_cast<int>( i ) == signal )
+                size = length;
+        }
+        pos += skip;
+        siw_bytes s;
+        if ( !section( size, s ) )
+            return "";
+        std::string v = value( signal, s );
+        while ( s.pos < s.data.size() )
+        {
+            t += s.varint();
+            if ( t > time )
+                break;
+            v = value( signal, s );
+        }
+        return v;
+    }
+};
+
+int to_int( const std::string& bits )
+{
+    int v = 0;
+    for ( std::size_t i = 0; i < bits.size(); ++i )
+        v = 2 * v + ( bits[i] == '1' );
+    return v;
+}
+
+int sc_main( int, char*[] )
+{
+    top t( "top" );
+
+    sc_trace_file* vcd = sc_create_vcd_trace_file( "counter" );
+    trace_all( vcd, t );
+    sc_trace_file* siw = sc_create_siw_trace_file( "counter", 512 );
+    trace_all( siw, t );
+
+    sc_start( 1000, SC_NS );
+
+    sc_close_vcd_trace_file( vcd );
+    sc_close_siw_trace_file( siw );
+
+    std::ifstream vcd_is( "counter.vcd", std::ios::binary | std::ios::ate );
+    std::streamoff vcd_size = vcd_is.tellg();
+    vcd_is.close();
+
+    siw_reader reader( "counter.siw" );
+    std::remove( "counter.vcd" );
+    std::remove( "counter.siw" );
+
+    cout << "signals:";
+    for ( std::size_t i = 0; i < reader.names.size(); ++i )
+        cout << " " << reader.names[i] << "/" << reader.widths[i];
+    cout << endl;
+    cout << "blocks: " << reader.starts.size() << endl;
+    cout << "smaller than VCD: "
+         << ( static_cast<std::streamoff>( reader.data.size() ) < vcd_size
+              ? "yes" : "no" ) << endl;
+
+    int count = reader.find( "cnt.count" );
+    int odd = reader.find( "cnt.odd" );
+    int scaled = reader.find( "cnt.scaled" );
+    int ratio = reader.find( "cnt.ratio" );
+    sc_dt::uint64 times[] = { 5, 125, 480, 495, 500, 777, 999 };
+    for ( int i = 0; i < 7; ++i )
+    {
+        int c = to_int( reader.value_at( count, times[i] ) );
+        int expected = static_cast<int>( times[i] / 10 ) + 1;
+        cout << times[i] << " ns: count " << c
+             << ", odd " << reader.value_at( odd, times[i] )
+             << ", scaled " << to_int( reader.value_at( scaled, times[i] ) )
+             << ", ratio " << reader.value_at( ratio, times[i] )
+             << ( c == expected ? "" : " (wrong)" ) << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Two processor clusters in synchronization domains.
+
+  Each cluster executes one instruction per nanosecond of its local time
+  on a host thread of its own. Cluster 0 sends a status word to cluster 1
+  every microsecond; cluster 1 forwards a digest of each word to a monitor
+  process in the kernel, which acknowledges it back to cluster 0. All
+  messages travel through sync channels, whose latency is at least one
+  quantum, so the trace does not depend on the scheduling of the host
+  threads.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+typedef sc_dt::uint64 word;
+
+class cluster
+: public sc_sync_domain
+{
+public:
+
+    sc_sync_channel<word>* in;
+    sc_sync_channel<word>* out;
+    word                   state;
+    int                    received;
+
+    cluster( sc_module_name name_, word seed, int period )
+      : sc_sync_domain( name_ ),
+        in( 0 ), out( 0 ), state( seed ), received( 0 ),
+        m_instruction_time( 1, SC_NS ), m_period( period ), m_count( 0 )
+      {}
+
+protected:
+
+    virtual void advance( const sc_time& from, const sc_time& to )
+    {
+        for( sc_time t = from; t < to; t += m_instruction_time )
+        {
+            word value;
+            while( in->nb_read( value, t ) ) {
+                ++received;
+                state ^= value;
+                if( m_period == 0 )
+                    out->write( digest( value ), t );
+            }
+            execute();
+            if( m_period != 0 && ++m_count == m_period ) {
+                m_count = 0;
+                out->write( state, t );
+            }
+        }
+    }
+
+private:
+
+    // some work standing in for an instruction
+    void execute()
+    {
+        for( int i = 0; i < 64; ++i )
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+
+    static word digest( word value )
+        { return ( value >> 32 ) ^ ( value & 0xffffffffULL ); }
+
+    sc_time m_instruction_time;
+    int     m_period; // instructions between status words, 0 to forward.
+    int     m_count;
+};
+
+SC_MODULE(monitor)
+{
+    sc_sync_channel<word>* in;
+    sc_sync_channel<word>* out;
+    int                    seen;
+
+    SC_HAS_PROCESS(monitor);
+
+    monitor( sc_module_name name_, sc_sync_channel<word>& in_,
+             sc_sync_channel<word>& out_ )
+      : sc_module( name_ ), in( &in_ ), out( &out_ ), seen( 0 )
+    {
+        SC_METHOD(receive);
+        sensitive << in->data_written_event();
+        dont_initialize();
+    }
+
+    void receive()
+    {
+        word value;
+        while( in->nb_read( value ) ) {
+            ++seen;
+            cout << sc_time_stamp() << ": digest " << hex << value << dec
+                 << endl;
+            out->write( value );
+        }
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    sc_sync_domain::set_quantum( sc_time( 100, SC_NS ) );
+
+    sc_sync_channel<word> to_cluster1( "to_cluster1", sc_time( 250, SC_NS ) );
+    sc_sync_channel<word> to_monitor( "to_monitor" );
+    sc_sync_channel<word> to_cluster0( "to_cluster0" );
+
+    cluster cluster0( "cluster0", 1, 1000 );
+    cluster cluster1( "cluster1", 2, 0 );
+    monitor mon( "monitor", to_monitor, to_cluster0 );
+
+    cluster0.in  = &to_cluster0;
+    cluster0.out = &to_cluster1;
+    cluster1.in  = &to_cluster1;
+    cluster1.out = &to_monitor;
+
+    sc_start( 5, SC_US );
+    cout << sc_time_stamp() << ": paused" << endl;
+    sc_start( 3, SC_US );
+
+    cout << "cluster0: " << cluster0.received << " acknowledgements, state "
+         << hex << cluster0.state << dec << endl;
+    cout << "cluster1: " << cluster1.received << " status words, state "
+         << hex << cluster1.state << dec << endl;
+    cout << "monitor:  " << mon.seen << " digests" << endl;
+    return 0;
+}
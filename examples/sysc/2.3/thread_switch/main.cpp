@@ -0,0 +1,86 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Cost of a thread process context switch.
+
+  Two SC_THREADs pass a token back and forth through immediate event
+  notifications, so every wait() is a yield from one thread process to
+  the other. The time per yield is reported; build the library with
+  ENABLE_PTHREADS or ENABLE_FAST_CONTEXT_SWITCH to compare the coroutine
+  packages. The number of round trips may be given on the command line.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+#include <cstdlib>
+#include <ctime>
+
+SC_MODULE(ping_pong)
+{
+    sc_event ping_ev;
+    sc_event pong_ev;
+    int      rounds;
+    int      pongs;
+
+    SC_CTOR(ping_pong)
+      : rounds( 0 ), pongs( 0 )
+    {
+        SC_THREAD(ping);
+        SC_THREAD(pong);
+    }
+
+    void ping()
+    {
+        wait( SC_ZERO_TIME ); // let pong wait for the first token
+        for( int i = 0; i < rounds; ++i ) {
+            ping_ev.notify();
+            wait( pong_ev );
+        }
+    }
+
+    void pong()
+    {
+        for( ;; ) {
+            wait( ping_ev );
+            ++pongs;
+            pong_ev.notify();
+        }
+    }
+};
+
+int sc_main( int argc, char* argv[] )
+{
+    ping_pong top( "top" );
+    top.rounds = ( argc > 1 ) ? std::atoi( argv[1] ) : 500000;
+
+    std::clock_t start = std::clock();
+    sc_start();
+    std::clock_t stop = std::clock();
+
+    // two yields per round trip
+    const double yields = 2.0 * top.pongs;
+    const double ns = 1e9 * double( stop - start ) / CLOCKS_PER_SEC;
+
+    cout << top.pongs << " round trips, " << yields << " yields, "
+         << ( yields > 0 ? ns / yields : 0.0 ) << " ns/yield" << endl;
+
+    return ( top.pongs == top.rounds ) ? 0 : 1;
+}
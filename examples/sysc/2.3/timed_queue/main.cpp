@@ -0,0 +1,127 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Timed notifications in a calendar queue.
+
+  A large number of timers notify their events at pseudo-random times in
+  the future. When firing, a timer also moves, cancels or re-notifies the
+  pending notification of another timer. Every timer fires on its own
+  residue class of nanoseconds, so no two timers fire at the same time
+  and the output does not depend on the timed queue implementation.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+static const int timers_n = 1000;
+
+static unsigned random_state = 1;
+
+static unsigned next_random()
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+SC_MODULE(timer)
+{
+    int       id;
+    timer**   timers;      // all timers, for cross notifications.
+
+    sc_event  ev;
+    unsigned  fired;
+    unsigned  checksum;
+
+    SC_CTOR(timer)
+      : id( 0 ), timers( 0 ), fired( 0 ), checksum( 0 )
+    {
+        SC_METHOD(fire);
+        sensitive << ev;
+        dont_initialize();
+    }
+
+    // notify the event of timer k at a time of its residue class
+    void schedule( int k, unsigned distance )
+    {
+        int offset = ( k - id + timers_n ) % timers_n;
+        timers[k]->ev.notify( ( offset + timers_n * ( distance % 50 + 1 ) ),
+                              SC_NS );
+    }
+
+    void fire()
+    {
+        sc_dt::uint64 now = sc_time_stamp().value() / 1000;
+        sc_assert( now % timers_n == static_cast<unsigned>( id ) );
+        ++fired;
+        checksum = checksum * 31 + static_cast<unsigned>( now );
+
+        schedule( id, next_random() );
+
+        int k = next_random() % timers_n;
+        switch( next_random() % 3 )
+        {
+          case 0: // earlier or ignored
+            schedule( k, next_random() );
+            break;
+          case 1: // cancel and re-notify
+            timers[k]->ev.cancel();
+            schedule( k, next_random() );
+            break;
+          default: // nothing
+            break;
+        }
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    sc_set_timed_queue( SC_TIMED_QUEUE_CALENDAR );
+
+    timer* timers[timers_n];
+    for ( int i = 0; i < timers_n; ++i )
+    {
+        timers[i] = new timer( sc_gen_unique_name( "timer" ) );
+        timers[i]->id = i;
+        timers[i]->timers = timers;
+    }
+    for ( int i = 0; i < timers_n; ++i )
+        timers[i]->ev.notify( timers_n + i, SC_NS );
+
+    sc_start( 500, SC_US );
+
+    unsigned fired = 0;
+    unsigned checksum = 0;
+    for ( int i = 0; i < timers_n; ++i )
+    {
+        fired += timers[i]->fired;
+        checksum ^= timers[i]->checksum;
+    }
+    cout << sc_time_stamp() << ": " << fired << " notifications, checksum "
+         << hex << checksum << dec << endl;
+    for ( int i = 0; i < timers_n; i += timers_n / 4 )
+        cout << timers[i]->name() << ": " << timers[i]->fired << endl;
+
+    for ( int i = 0; i < timers_n; ++i )
+        delete timers[i];
+    return 0;
+}
@@ -0,0 +1,178 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Values of wide and vector types in VCD files.
+
+  Signals of bit vector, logic vector, big integer and limited integer
+  types, narrow and wider than a word, are driven with a few patterns and
+  traced into a VCD file. After the simulation, the value changes of the
+  file are printed, and checked against the values expected from
+  to_string(), with the leading bits stripped as VCD allows. The file is
+  removed.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+SC_MODULE(driver)
+{
+    sc_signal<sc_bv<70> >        bv;
+    sc_signal<sc_lv<37> >        lv;
+    sc_signal<sc_biguint<100> >  big_u;
+    sc_signal<sc_bigint<65> >    big_s;
+    sc_signal<sc_uint<13> >      small_u;
+    sc_signal<sc_int<64> >       small_s;
+
+    // the expected value lines of each step, by signal name
+    std::vector< std::map<std::string, std::string> > expected;
+
+    SC_CTOR(driver)
+      : bv( "bv" ), lv( "lv" ), big_u( "big_u" ), big_s( "big_s" ),
+        small_u( "small_u" ), small_s( "small_s" )
+    {
+        SC_THREAD(run);
+    }
+
+    template <class T>
+    void drive( sc_signal<T>& sig, const T& value )
+    {
+        sig.write( value );
+        sc_lv_base bits( value.length() );
+        bits = value;
+        if ( !( value == sig.read() ) )
+            expected.back()[sig.basename()] = strip( bits.to_string() );
+    }
+
+    // the leading zeros as stripped in VCD files
+    static std::string strip( const std::string& bits )
+    {
+        std::size_t i = bits.find_first_not_of( '0' );
+        if ( i == std::string::npos )
+            return "0";
+        if ( i == 0 )
+            return bits;
+        return bits[i] == '1' ? bits.substr( i ) : bits.substr( i - 1 );
+    }
+
+    void run()
+    {
+        const char* logic = "01ZX";
+        for ( int k = 0; k < 6; ++k )
+        {
+            wait( 10, SC_NS );
+            expected.push_back( std::map<std::string, std::string>() );
+
+            sc_bv<70> b;
+            for ( int i = 0; i < 70; ++i )
+                b[i] = ( i * ( k + 1 ) ) % 7 < k;
+            drive( bv, b );
+
+            sc_lv<37> l;
+            for ( int i = 0; i < 37; ++i )
+                l[i] = sc_logic( logic[ ( i / 9 + k ) % 4 ] );
+            drive( lv, l );
+
+            sc_biguint<100> u = k * 12345;
+            u <<= 15 * k;
+            drive( big_u, u );
+
+            sc_bigint<65> s = 987654321;
+            s <<= 7 * k;
+            drive( big_s, k % 2 ? sc_bigint<65>( -s ) : s );
+
+            drive( small_u, sc_uint<13>( 1000 * k ) );
+            drive( small_s, sc_int<64>( k % 2 ? -123456789 * k : k ) );
+        }
+    }
+};
+
+// check the value changes of a VCD file against the expected ones, and
+// remove it
+void check( const char* file_name, const driver& d )
+{
+    std::ifstream is( file_name );
+    std::map<std::string, std::string> names;
+    std::string line;
+    int step = -1, errors = 0;
+
+    // the expected changes, until they are found
+    for ( std::size_t i = 0; i < d.expected.size(); ++i )
+        errors += static_cast<int>( d.expected[i].size() );
+
+    while ( std::getline( is, line ) )
+    {
+        std::istringstream ls( line );
+        std::string word, id;
+        if ( !( ls >> word ) )
+            continue;
+        if ( word == "$var" )
+        {
+            std::string type, width, name;
+            ls >> type >> width >> id >> name;
+            names[id] = name;
+        }
+        else if ( word[0] == '#' )
+        {
+            step = std::atoi( word.c_str() + 1 ) / 10 - 1;
+            cout << "\n  " << word;
+        }
+        else if ( word[0] == 'b' && ls >> id && step >= 0 )
+        {
+            const std::string& name = names[id];
+            std::map<std::string, std::string>::const_iterator it =
+                d.expected[step].find( name );
+            bool ok = it != d.expected[step].end() &&
+                      it->second == word.substr( 1 );
+            cout << " " << name << "=" << word.substr( 1 )
+                 << ( ok ? "" : " (wrong)" );
+            errors += ok ? -1 : 1;
+        }
+    }
+    cout << endl << "errors: " << errors << endl;
+    is.close();
+    std::remove( file_name );
+}
+
+int sc_main( int, char*[] )
+{
+    driver d( "d" );
+
+    sc_trace_file* tf = sc_create_vcd_trace_file( "format" );
+    tf->set_time_unit( 1, SC_NS );
+    sc_trace( tf, d.bv, "bv" );
+    sc_trace( tf, d.lv, "lv" );
+    sc_trace( tf, d.big_u, "big_u" );
+    sc_trace( tf, d.big_s, "big_s" );
+    sc_trace( tf, d.small_u, "small_u" );
+    sc_trace( tf, d.small_s, "small_s" );
+
+    sc_start( 100, SC_NS );
+    sc_close_vcd_trace_file( tf );
+
+    cout << "format.vcd:";
+    check( "format.vcd", d );
+    return 0;
+}
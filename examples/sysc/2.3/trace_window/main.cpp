@@ -0,0 +1,181 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Time windowed, name filtered and ring buffer tracing.
+
+  The signals of a counter are traced into two VCD files. The first one
+  starts disabled, enables the traces matching "cnt.c*" at 40 ns, all of
+  them at 120 ns, and disables the traces matching "cnt.*" at 160 ns. The
+  second one keeps the value changes of the last 30 ns in memory, and
+  writes them after an error report at 125 ns, which is neither displayed
+  nor thrown, and after an explicit trigger at 185 ns. The time steps and
+  value changes of both files are printed after the simulation, with the
+  names of the traces, and the files are removed.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+#include <fstream>
+#include <map>
+#include <sstream>
+
+SC_MODULE(counter)
+{
+    sc_in<bool>           clk;
+
+    sc_signal<int>        count;
+    sc_signal<bool>       odd;
+    sc_signal<double>     ratio;
+    sc_signal<sc_uint<4> > state;
+
+    SC_CTOR(counter)
+      : clk( "clk" ), count( "count" ), odd( "odd" ), ratio( "ratio" ),
+        state( "state" )
+    {
+        SC_METHOD(step);
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+
+    void step()
+    {
+        int next = count.read() + 1;
+        count.write( next );
+        odd.write( next % 2 != 0 );
+        ratio.write( next / 2.0 );
+        state.write( next % 16 );
+    }
+};
+
+SC_MODULE(top)
+{
+    sc_clock       clk;
+    counter        cnt;
+    sc_trace_file* ring;
+
+    SC_CTOR(top)
+      : clk( "clk", 10, SC_NS ), cnt( "cnt" ), ring( 0 )
+    {
+        cnt.clk( clk );
+
+        SC_THREAD(check);
+    }
+
+    void check()
+    {
+        wait( 125, SC_NS );
+        SC_REPORT_ERROR( "/demo/counter", "count out of range" );
+        wait( 60, SC_NS );
+        sc_trace_trigger( ring );
+    }
+};
+
+void trace_all( sc_trace_file* tf, const top& t )
+{
+    tf->set_time_unit( 1, SC_NS );
+    sc_trace( tf, t.clk, "clk" );
+    sc_trace( tf, t.cnt.count, "cnt.count" );
+    sc_trace( tf, t.cnt.odd, "cnt.odd" );
+    sc_trace( tf, t.cnt.ratio, "cnt.ratio" );
+    sc_trace( tf, t.cnt.state, "cnt.state" );
+}
+
+// print the time steps and value changes of a VCD file, and remove it
+void print( const char* file_name )
+{
+    std::ifstream is( file_name );
+    std::map<std::string, std::string> names;
+    std::vector<std::string> scopes;
+    bool header = true, comment = false;
+    std::string line;
+
+    cout << file_name << ":";
+    while ( std::getline( is, line ) )
+    {
+        std::istringstream ls( line );
+        std::string word, id;
+        if ( !( ls >> word ) )
+            continue;
+        if ( comment || word == "$comment" )
+        {
+            comment = ( word != "$end" );
+        }
+        else if ( header )
+        {
+            if ( word == "$scope" && ls >> id >> id )
+                scopes.push_back( id );
+            else if ( word == "$upscope" )
+                scopes.pop_back();
+            else if ( word == "$var" )
+            {
+                std::string type, width, name;
+                ls >> type >> width >> id >> name;
+                for ( std::size_t i = scopes.size(); i > 1; --i )
+                    name = scopes[i - 1] + "." + name;
+                names[id] = name;
+            }
+            else if ( word == "$enddefinitions" )
+                header = false;
+        }
+        else if ( word[0] == '#' )
+            cout << "\n  " << word;
+        else if ( word == "$dumpvars" || word == "$dumpall" )
+            cout << " " << word;
+        else if ( word[0] == 'b' || word[0] == 'r' )
+        {
+            ls >> id;
+            cout << " " << names[id] << "=" << word.substr( 1 );
+        }
+        else if ( word[0] != '$' )
+            cout << " " << names[word.substr( 1 )] << "=" << word[0];
+    }
+    cout << endl;
+    is.close();
+    std::remove( file_name );
+}
+
+int sc_main( int, char*[] )
+{
+    sc_report_handler::set_actions( "/demo/counter", SC_DO_NOTHING );
+
+    top t( "top" );
+
+    sc_trace_file* window = sc_create_vcd_trace_file( "window" );
+    trace_all( window, t );
+    sc_trace_enable( window, false );
+    sc_trace_enable( window, true, sc_time( 40, SC_NS ), "cnt.c*" );
+    sc_trace_enable( window, true, sc_time( 120, SC_NS ) );
+    sc_trace_enable( window, false, sc_time( 160, SC_NS ), "cnt.*" );
+
+    t.ring = sc_create_vcd_trace_file( "ring" );
+    trace_all( t.ring, t );
+    sc_trace_ring_buffer( t.ring, sc_time( 30, SC_NS ) );
+
+    sc_start( 200, SC_NS );
+
+    sc_close_vcd_trace_file( window );
+    sc_close_vcd_trace_file( t.ring );
+
+    print( "window.vcd" );
+    print( "ring.vcd" );
+    return 0;
+}
@@ -0,0 +1,207 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Trace files written on a host thread.
+
+  The signals of a counter are traced into VCD and WIF files, written
+  either by a host thread from tiny output blocks, so that the simulation
+  often waits for the writer, or right away on the simulation thread.
+  A comment is written before the tracing starts. The files of both kinds
+  are compared after the simulation, except for their dates, and removed.
+
+  With zlib, another VCD file written by a host thread is compressed there,
+  and read back through zlib for the comparison.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+#include <fstream>
+#include <sstream>
+
+#if defined(SC_HAVE_ZLIB)
+#  include <zlib.h>
+#endif
+
+SC_MODULE(counter)
+{
+    sc_in<bool>             clk;
+
+    sc_signal<int>          count;
+    sc_signal<bool>         odd;
+    sc_signal<sc_bv<40> >   pattern;
+    sc_signal<double>       ratio;
+
+    SC_CTOR(counter)
+      : clk( "clk" ), count( "count" ), odd( "odd" ), pattern( "pattern" ),
+        ratio( "ratio" )
+    {
+        SC_METHOD(step);
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+
+    void step()
+    {
+        int next = count.read() + 1;
+        count.write( next );
+        odd.write( next % 2 != 0 );
+        sc_bv<40> bits;
+        bits.range( 39, 20 ) = next;
+        bits.range( 19, 0 ) = ~next;
+        pattern.write( bits );
+        ratio.write( next / 3.0 );
+    }
+};
+
+SC_MODULE(top)
+{
+    sc_clock clk;
+    counter  cnt;
+
+    SC_CTOR(top)
+      : clk( "clk", 10, SC_NS ), cnt( "cnt" )
+    {
+        cnt.clk( clk );
+    }
+};
+
+void trace_all( sc_trace_file* tf, const top& t )
+{
+    tf->set_time_unit( 1, SC_NS );
+    sc_write_comment( tf, "traced signals of the counter" );
+    sc_trace( tf, t.clk, "clk" );
+    sc_trace( tf, t.cnt.count, "cnt.count" );
+    sc_trace( tf, t.cnt.odd, "cnt.odd" );
+    sc_trace( tf, t.cnt.pattern, "cnt.pattern" );
+    sc_trace( tf, t.cnt.ratio, "cnt.ratio" );
+}
+
+// the text of a file, uncompressed if its name ends in .gz, or nothing if
+// it is not compressed then
+std::string read_file( const std::string& file_name )
+{
+    std::string s;
+    std::size_t n = file_name.size();
+    if ( n > 3 && file_name.compare( n - 3, 3, ".gz" ) == 0 )
+    {
+#if defined(SC_HAVE_ZLIB)
+        gzFile file = gzopen( file_name.c_str(), "rb" );
+        if ( !file )
+            return s;
+        char buffer[4096];
+        int read_n;
+        while ( ( read_n = gzread( file, buffer, sizeof(buffer) ) ) > 0 )
+            s.append( buffer, read_n );
+        if ( gzdirect( file ) )
+            s.clear();
+        gzclose( file );
+#endif
+        return s;
+    }
+    std::ifstream is( file_name.c_str() );
+    std::ostringstream os;
+    os << is.rdbuf();
+    return os.str();
+}
+
+// the lines of a file, except those with its date, and the number of lines
+std::string contents( const char* file_name, int& lines )
+{
+    std::istringstream is( read_file( file_name ) );
+    std::string s, line;
+    bool date = false;
+    lines = 0;
+    while ( std::getline( is, line ) )
+    {
+        ++lines;
+        if ( line == "$date" )
+            date = true;
+        else if ( line == "$end" )
+            date = false;
+        if ( !date && line.find( "produced on date" ) == std::string::npos )
+            s += line + '\n';
+    }
+    return s;
+}
+
+// compare a file with the one written directly, and remove it
+void compare( const char* kind, const char* threaded, const char* direct )
+{
+    int threaded_lines, direct_lines;
+    std::string threaded_text = contents( threaded, threaded_lines );
+    std::string direct_text = contents( direct, direct_lines );
+    std::remove( threaded );
+
+    cout << kind << ": " << threaded_lines << " and " << direct_lines
+         << " lines, "
+         << ( threaded_lines > 0 && threaded_text == direct_text
+              ? "identical" : "different" ) << endl;
+}
+
+int sc_main( int, char*[] )
+{
+    top t( "top" );
+
+    // tiny blocks, to let the simulation wait for the writer
+    sc_trace_file* vcd_threaded = sc_create_vcd_trace_file( "threaded" );
+    sc_trace_output_buffer( vcd_threaded, 64, 2 );
+    trace_all( vcd_threaded, t );
+
+    sc_trace_file* vcd_direct = sc_create_vcd_trace_file( "direct" );
+    sc_trace_output_buffer( vcd_direct, 1 << 12, 0 );
+    trace_all( vcd_direct, t );
+
+    // compressed on the writer thread, if zlib is there to read it back
+    sc_trace_file* vcd_compressed = sc_create_vcd_trace_file( "compressed" );
+    sc_trace_output_buffer( vcd_compressed, 64, 2 );
+#if defined(SC_HAVE_ZLIB)
+    sc_trace_output_compressed( vcd_compressed );
+    const char* compressed_name = "compressed.vcd.gz";
+#else
+    const char* compressed_name = "compressed.vcd";
+#endif
+    trace_all( vcd_compressed, t );
+
+    sc_trace_file* wif_threaded = sc_create_wif_trace_file( "threaded" );
+    sc_trace_output_buffer( wif_threaded, 64, 2 );
+    trace_all( wif_threaded, t );
+
+    sc_trace_file* wif_direct = sc_create_wif_trace_file( "direct" );
+    sc_trace_output_buffer( wif_direct, 1 << 12, 0 );
+    trace_all( wif_direct, t );
+
+    sc_start( 2000, SC_NS );
+
+    sc_close_vcd_trace_file( vcd_threaded );
+    sc_close_vcd_trace_file( vcd_direct );
+    sc_close_vcd_trace_file( vcd_compressed );
+    sc_close_wif_trace_file( wif_threaded );
+    sc_close_wif_trace_file( wif_direct );
+
+    cout << "count " << t.cnt.count.read() << endl;
+    compare( "VCD compressed", compressed_name, "direct.vcd" );
+    compare( "VCD", "threaded.vcd", "direct.vcd" );
+    compare( "WIF", "threaded.awif", "direct.awif" );
+    std::remove( "direct.vcd" );
+    std::remove( "direct.awif" );
+    return 0;
+}
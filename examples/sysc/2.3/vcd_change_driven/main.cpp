@@ -0,0 +1,154 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  main.cpp -- Change driven VCD tracing.
+
+  The same signals, a port and a plain variable of a small counter are
+  traced into two VCD files, one polling all traces at each time step and
+  one visiting only the traces of the signals updated since the last time
+  step, while the plain variable is still polled. Some of the signals
+  change rarely, and a buffer is written with the same value at every
+  clock edge, so it is visited without a value change. Both files are
+  compared after the simulation, except for their dates, and removed.
+
+ *****************************************************************************/
+
+#include "systemc.h"
+
+#include <fstream>
+#include <sstream>
+
+SC_MODULE(counter)
+{
+    sc_in<bool>       clk;
+    sc_in<int>        count_in;
+
+    sc_signal<int>    count;
+    sc_signal<bool>   parity;
+    sc_signal<sc_uint<12> > scaled;
+    sc_signal<sc_logic> overflow;
+    sc_buffer<int>    tick;
+    int               cycles;
+
+    SC_CTOR(counter)
+      : clk( "clk" ), count_in( "count_in" ), count( "count" ),
+        parity( "parity" ), scaled( "scaled" ), overflow( "overflow" ),
+        tick( "tick" ), cycles( 0 )
+    {
+        SC_METHOD(step);
+        sensitive << clk.pos();
+        dont_initialize();
+
+        SC_METHOD(derive);
+        sensitive << count_in;
+        dont_initialize();
+    }
+
+    void step()
+    {
+        count.write( count.read() + 1 );
+        tick.write( 0 );
+        ++cycles;
+    }
+
+    void derive()
+    {
+        int value = count_in.read();
+        parity.write( value % 2 != 0 );
+        if ( value % 4 == 0 )
+            scaled.write( 100 * value );
+        overflow.write( value > 12 ? sc_dt::SC_LOGIC_1 : sc_dt::SC_LOGIC_0 );
+    }
+};
+
+SC_MODULE(top)
+{
+    sc_clock clk;
+    counter  cnt;
+
+    SC_CTOR(top)
+      : clk( "clk", 10, SC_NS ), cnt( "cnt" )
+    {
+        cnt.clk( clk );
+        cnt.count_in( cnt.count );
+    }
+};
+
+void trace_all( sc_trace_file* tf, const top& t )
+{
+    tf->set_time_unit( 1, SC_NS );
+    sc_trace( tf, t.clk, "clk" );
+    sc_trace( tf, t.cnt.count_in, "count_in" );
+    sc_trace( tf, t.cnt.count, "count" );
+    sc_trace( tf, t.cnt.parity, "parity" );
+    sc_trace( tf, t.cnt.scaled, "scaled" );
+    sc_trace( tf, t.cnt.overflow, "overflow" );
+    sc_trace( tf, t.cnt.tick, "tick" );
+    sc_trace( tf, t.cnt.cycles, "cycles" );
+}
+
+// the contents of a file from its time scale on
+std::string contents( const char* file_name )
+{
+    std::ifstream is( file_name );
+    std::stringstream ss;
+    ss << is.rdbuf();
+    std::string s = ss.str();
+    std::string::size_type pos = s.find( "$timescale" );
+    return pos == std::string::npos ? std::string() : s.substr( pos );
+}
+
+int sc_main( int, char*[] )
+{
+    top t( "top" );
+
+    sc_trace_file* polled = sc_create_vcd_trace_file( "polled" );
+    trace_all( polled, t );
+
+    sc_trace_file* driven = sc_create_vcd_trace_file( "change_driven" );
+    sc_trace_change_driven( driven );
+    trace_all( driven, t );
+
+    sc_start( 200, SC_NS );
+
+    sc_close_vcd_trace_file( polled );
+    sc_close_vcd_trace_file( driven );
+
+    std::string polled_vcd = contents( "polled.vcd" );
+    std::string driven_vcd = contents( "change_driven.vcd" );
+    std::remove( "polled.vcd" );
+    std::remove( "change_driven.vcd" );
+
+    int steps = 0;
+    std::stringstream ss( driven_vcd );
+    std::string line;
+    while ( std::getline( ss, line ) )
+        if ( !line.empty() && line[0] == '#' )
+            ++steps;
+
+    cout << "time steps: " << steps << endl;
+    cout << "count " << t.cnt.count.read() << ", cycles " << t.cnt.cycles
+         << endl;
+    cout << "traces "
+         << ( !polled_vcd.empty() && polled_vcd == driven_vcd
+              ? "identical" : "different" ) << endl;
+    return 0;
+}
@@ -59,15 +59,15 @@ public:
 
     sc_buffer()
 	: base_type( sc_gen_unique_name( "buffer" ) )
-	{}
+	{ init(); }
 
     explicit sc_buffer( const char* name_ )
 	: base_type( name_ )
-	{}
+	{ init(); }
 
     sc_buffer( const char* name_, const value_type& initial_value_ )
       : base_type( name_, initial_value_ )
-    {}
+    { init(); }
 
     // interface methods
 
@@ -97,6 +97,11 @@ protected:
 
 private:
 
+    // the update touches this buffer only, like that of sc_signal
+    void init()
+        { this->parallel_update_safe(
+              !base_type::policy_type::needs_update(), typeid( this_type ) ); }
+
     // disabled
     sc_buffer( const this_type& );
 };
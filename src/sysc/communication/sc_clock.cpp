@@ -66,7 +66,9 @@ sc_clock::sc_clock() :
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_idle_skipping( false ), m_parked( false ), m_park_posedge( false ),
+    m_park_time()
 {
     init( sc_time::from_value(simcontext()->m_time_params->default_time_unit),
 	  0.5,
@@ -81,7 +83,9 @@ sc_clock::sc_clock( const char* name_ ) :
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_idle_skipping( false ), m_parked( false ), m_park_posedge( false ),
+    m_park_time()
 {
     init( sc_time::from_value(simcontext()->m_time_params->default_time_unit),
 	  0.5,
@@ -100,7 +104,9 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_idle_skipping( false ), m_parked( false ), m_park_posedge( false ),
+    m_park_time()
 {
     init( period_,
 	  duty_cycle_,
@@ -124,7 +130,9 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_idle_skipping( false ), m_parked( false ), m_park_posedge( false ),
+    m_park_time()
 {
     init( sc_time( period_v_, period_tu_, simcontext() ),
 	  duty_cycle_,
@@ -146,7 +154,9 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_idle_skipping( false ), m_parked( false ), m_park_posedge( false ),
+    m_park_time()
 {
     init( sc_time( period_v_, period_tu_, simcontext() ),
 	  duty_cycle_,
@@ -172,7 +182,9 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_idle_skipping( false ), m_parked( false ), m_park_posedge( false ),
+    m_park_time()
 {
     static bool warn_sc_clock=true;
     if ( warn_sc_clock )
@@ -251,7 +263,10 @@ void sc_clock::before_end_of_elaboration()
 // destructor (does nothing)
 
 sc_clock::~sc_clock()
-{}
+{
+    if( m_parked )
+        simcontext()->unpark_clock( this );
+}
 
 void sc_clock::register_port( sc_port_base& /*port*/, const char* if_typename_ )
 {
@@ -280,6 +295,182 @@ sc_clock::time_stamp()
 }
 
 
+// read the current value, which is derived from the time while the edges
+// are skipped; it is only stored by resume() on the simulator thread, since
+// the processes reading it may run on the parallel workers
+
+const bool&
+sc_clock::read() const
+{
+    if( m_parked && sc_time_stamp() > m_park_time ) {
+        static const bool values[] = { false, true };
+        sc_time next_edge_delay;
+        bool    next_posedge;
+        return values[idle_value( next_edge_delay, next_posedge )];
+    }
+    return base_type::read();
+}
+
+
+// +----------------------------------------------------------------------------
+// |"sc_clock::set_idle_skipping"
+// |
+// | With idle skipping enabled, an edge of this clock does not schedule the
+// | next one while no process waits for the clock's events, so that the
+// | simulation time advances directly to the next other timed event. The
+// | clock is restarted in phase as soon as a process waits for it again.
+// | While the edges are skipped, read() returns the value the clock would
+// | have; event(), posedge() and negedge() return false. Edges, which fall
+// | onto the time a process starts waiting again, are executed one delta
+// | cycle later. No edges are skipped while a trace file is open.
+// +----------------------------------------------------------------------------
+
+void
+sc_clock::set_idle_skipping( bool enable )
+{
+    m_idle_skipping = enable;
+    if( !enable && m_parked ) {
+        simcontext()->unpark_clock( this );
+        resume( true );
+    }
+}
+
+
+// true if a process waits for one of the events of this clock, or the
+// clock is used as a reset
+
+bool
+sc_clock::awaited() const
+{
+    return m_reset_p != 0
+        || ( m_change_event_p != 0 && m_change_event_p->awaited() )
+        || ( m_posedge_event_p != 0 && m_posedge_event_p->awaited() )
+        || ( m_negedge_event_p != 0 && m_negedge_event_p->awaited() );
+}
+
+
+// skip the edges after the current one, if nobody waits for them
+
+bool
+sc_clock::park( bool posedge )
+{
+    if( awaited() || !simcontext()->park_clock( this ) )
+        return false;
+    m_parked = true;
+    m_park_posedge = posedge;
+    m_park_time = sc_time_stamp();
+    return true;
+}
+
+
+// schedule the next edge in phase, if somebody waits for it or force is
+// set; called by the simulation context after each evaluation phase
+
+bool
+sc_clock::resume( bool force )
+{
+    if( !force && !awaited() )
+        return false;
+
+    sc_time next_edge_delay;
+    bool    next_posedge;
+    bool    value = idle_value( next_edge_delay, next_posedge );
+    if( sc_time_stamp() > m_park_time ) {
+        this->m_cur_val = this->m_new_val = value;
+        mark_traces();
+    }
+
+    if( next_posedge )
+        m_next_posedge_event.notify_internal( next_edge_delay );
+    else
+        m_next_negedge_event.notify_internal( next_edge_delay );
+    m_parked = false;
+    return true;
+}
+
+
+// value of the parked clock at the current time, before an edge at this
+// time, and the delay and kind of its next edge
+
+bool
+sc_clock::idle_value( sc_time& next_edge_delay, bool& next_posedge ) const
+{
+    const sc_dt::uint64 first  = ( m_park_posedge ? m_negedge_time
+                                                  : m_posedge_time ).value();
+    const sc_dt::uint64 period = m_period.value();
+    const sc_dt::uint64 since  = ( sc_time_stamp() - m_park_time ).value();
+
+    sc_dt::uint64 phase = since % period;
+    if( since != 0 && phase == 0 ) { // an edge like the last one is due now
+        phase = period;
+    }
+
+    if( phase <= first ) {
+        next_edge_delay = sc_time::from_value( first - phase );
+        next_posedge = !m_park_posedge;
+        return m_park_posedge;
+    } else {
+        next_edge_delay = sc_time::from_value( period - phase );
+        next_posedge = m_park_posedge;
+        return !m_park_posedge;
+    }
+}
+
+
+// save or restore the value and the time of the next edge; the edges
+// notified during elaboration have been cancelled when it is restored
+
+void
+sc_clock::checkpoint_state( sc_checkpoint_archive& ar )
+{
+    bool          value = read();
+    bool          pending = true;   // an edge is notified.
+    bool          posedge = false;
+    sc_dt::uint64 edge_time = 0;    // time of the next edge.
+
+    if( ar.saving() ) {
+        if( m_parked ) {
+            sc_time next_edge_delay;
+            idle_value( next_edge_delay, posedge );
+            edge_time = ( sc_time_stamp() + next_edge_delay ).value();
+        } else if( m_next_posedge_event.m_notify_type != sc_event::NONE ||
+                   m_next_negedge_event.m_notify_type != sc_event::NONE ) {
+            posedge = m_next_posedge_event.m_notify_type != sc_event::NONE;
+            const sc_event& e = posedge ? m_next_posedge_event
+                                        : m_next_negedge_event;
+            edge_time = e.m_notify_type == sc_event::TIMED
+                      ? e.m_timed->notify_time().value()
+                      : sc_time_stamp().value();
+        } else {
+            pending = false;
+        }
+    }
+
+    ar.io( value );
+    ar.io( pending );
+    ar.io( posedge );
+    ar.io( edge_time );
+    if( ar.saving() || ar.failed() )
+        return;
+
+    if( m_parked ) {
+        simcontext()->unpark_clock( this );
+        m_parked = false;
+    }
+    m_next_posedge_event.cancel();
+    m_next_negedge_event.cancel();
+    this->m_cur_val = this->m_new_val = value;
+    mark_traces();
+    if( pending ) {
+        sc_dt::uint64 now = sc_time_stamp().value();
+        sc_time delay = edge_time > now ? sc_time::from_value( edge_time - now )
+                                        : SC_ZERO_TIME;
+        ( posedge ? m_next_posedge_event
+                  : m_next_negedge_event ).notify_internal( delay );
+    }
+}
+
+
 // error reporting
 
 void
@@ -299,6 +490,9 @@ sc_clock::init( const sc_time& period_,
 		const sc_time& start_time_,
 		bool           posedge_first_ )
 {
+    // the update touches this clock only, like that of sc_signal
+    parallel_update_safe( !policy_type::needs_update(), typeid( sc_clock ) );
+
     if( period_ == SC_ZERO_TIME ) {
         report_error( SC_ID_CLOCK_PERIOD_ZERO_, "increase the period" );
         // may continue, if suppressed
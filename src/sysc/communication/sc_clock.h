@@ -111,6 +111,17 @@ public:
     virtual const char* kind() const
         { return "sc_clock"; }
 
+    // read the current value
+    virtual const bool& read() const;
+
+
+    // skip the edges while no process waits for this clock
+
+    void set_idle_skipping( bool enable );
+
+    bool idle_skipping() const
+        { return m_idle_skipping; }
+
 
 #if 0 // @@@@#### REMOVE
     // for backward compatibility with 1.0
@@ -151,6 +162,15 @@ protected:
 
     bool is_clock() const { return true; }
 
+    // idle skipping
+    bool awaited() const;
+    bool park( bool posedge );
+    bool resume( bool force );
+    bool idle_value( sc_time& next_edge_delay, bool& next_posedge ) const;
+
+    // checkpoints
+    virtual void checkpoint_state( sc_checkpoint_archive& ar );
+
 protected:
 
     sc_time  m_period;		// the period of this clock
@@ -163,8 +183,15 @@ protected:
     sc_event m_next_posedge_event;
     sc_event m_next_negedge_event;
 
+    bool     m_idle_skipping;   // skip the edges while nobody waits.
+    bool     m_parked;          // edges are skipped since m_park_time.
+    bool     m_park_posedge;    // true if the last edge was positive
+    sc_time  m_park_time;       // time of the last edge before parking
+
 private:
 
+    friend class sc_simcontext;
+
     // disabled
     sc_clock( const sc_clock& );
     sc_clock& operator = ( const sc_clock& );
@@ -179,18 +206,20 @@ inline
 void
 sc_clock::posedge_action()
 {
-    m_next_negedge_event.notify_internal( m_negedge_time );
-	m_new_val = true;
-	request_update();
+    if( !m_idle_skipping || !park( true ) )
+        m_next_negedge_event.notify_internal( m_negedge_time );
+    m_new_val = true;
+    request_update();
 }
 
 inline
 void
 sc_clock::negedge_action()
 {
-    m_next_posedge_event.notify_internal( m_posedge_time );
-	m_new_val = false;
-	request_update();
+    if( !m_idle_skipping || !park( false ) )
+        m_next_posedge_event.notify_internal( m_posedge_time );
+    m_new_val = false;
+    request_update();
 }
 
 
@@ -107,6 +107,8 @@ SC_DEFINE_MESSAGE( SC_ID_ATTEMPT_TO_BIND_CLOCK_TO_OUTPUT_,  128,
     "attempted to bind sc_clock instance to sc_inout or sc_out" )
 SC_DEFINE_MESSAGE( SC_ID_NO_ASYNC_UPDATE_,  129,
     "this build has no asynchronous update support" )
+SC_DEFINE_MESSAGE( SC_ID_DELTA_COMPRESSION_NOT_POSSIBLE_,  130,
+    "delta cycle compression not possible for signal" )
 
 /* 
 $Log: sc_communication_ids.h,v $
@@ -33,6 +33,7 @@
 #include "sysc/communication/sc_communication_ids.h"
 #include "sysc/communication/sc_prim_channel.h"
 #include "sysc/communication/sc_fifo_ifs.h"
+#include "sysc/kernel/sc_checkpoint.h"
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/tracing/sc_trace.h"
@@ -142,6 +143,8 @@ protected:
 
     virtual void update();
 
+    virtual void checkpoint_state( sc_checkpoint_archive& ar );
+
     // support methods
 
     void init( int );
@@ -357,6 +360,40 @@ sc_fifo<T>::update()
 }
 
 
+// save or restore the samples in the buffer, oldest first
+
+template <class T>
+inline
+void
+sc_fifo<T>::checkpoint_state( sc_checkpoint_archive& ar )
+{
+    if( !sc_checkpoint_traits<T>::supported ) {
+        ar.unsupported();
+        return;
+    }
+    int samples = m_size - m_free;
+    ar.io( samples );
+    if( ar.saving() ) {
+        for( int i = 0; i < samples; ++i )
+            ar.io( m_buf[( m_ri + i ) % m_size] );
+        return;
+    }
+    for( int i = 0; i < m_size; ++i )
+        m_buf[i] = T();
+    m_free = m_size;
+    m_ri = 0;
+    m_wi = 0;
+    for( int i = 0; i < samples && !ar.failed(); ++i ) {
+        T val;
+        ar.io( val );
+        buf_write( val );
+    }
+    m_num_readable = m_size - m_free;
+    m_num_read = 0;
+    m_num_written = 0;
+}
+
+
 // support methods
 
 template <class T>
@@ -133,11 +133,12 @@ struct sc_bind_info
 
     int                        m_max_size;
     sc_port_policy             m_policy;
-    std::vector<sc_bind_elem*> vec;
+    std::vector<sc_bind_elem>  vec;
     bool                       has_parent;
     int                        last_add;
     bool                       is_leaf;
     bool                       complete;
+    bool                       resolving;  // parents being completed.
 
     ef_vector                  thread_vec;
     ef_vector                  method_vec;
@@ -156,6 +157,7 @@ sc_bind_info::sc_bind_info( int max_size_, sc_port_policy policy_ )
   last_add( -1 ),
   is_leaf( true ),
   complete( false ),
+  resolving( false ),
   thread_vec(),
   method_vec()
 {}
@@ -165,9 +167,6 @@ sc_bind_info::sc_bind_info( int max_size_, sc_port_policy policy_ )
 
 sc_bind_info::~sc_bind_info()
 {
-    for( int i = size() - 1; i >= 0; -- i ) {
-	delete vec[i];
-    }
 }
 
 
@@ -280,7 +279,7 @@ sc_port_base::bind( sc_interface& interface_ )
         return;
     }
 
-    m_bind_info->vec.push_back( new sc_bind_elem( &interface_ ) );
+    m_bind_info->vec.push_back( sc_bind_elem( &interface_ ) );
     
     if( ! m_bind_info->has_parent ) {
 	// add (cache) the interface
@@ -309,14 +308,14 @@ sc_port_base::bind( this_type& parent_ )
     // check if parent port is already bound to this port
 #if 0
     for( int i = m_bind_info->size() - 1; i >= 0; -- i ) {
-        if( &parent_ == m_bind_info->vec[i]->parent ) {
+        if( &parent_ == m_bind_info->vec[i].parent ) {
             report_error( SC_ID_BIND_PORT_TO_PORT_, "already bound" );
             return;
         }
     }
 #endif // 
 
-    m_bind_info->vec.push_back( new sc_bind_elem( &parent_ ) );
+    m_bind_info->vec.push_back( sc_bind_elem( &parent_ ) );
     m_bind_info->has_parent = true;
     parent_.m_bind_info->is_leaf = false;
 }
@@ -403,55 +402,43 @@ sc_port_base::make_sensitive( sc_method_handle handle_,
 
 // support methods
 
-int
-sc_port_base::first_parent()
-{
-    for( int i = 0; i < m_bind_info->size(); ++ i ) {
-	if( m_bind_info->vec[i]->parent != 0 ) {
-	    return i;
-	}
-    }
-    return -1;
-}
+// replace the parent ports by their interfaces, which requires that the
+// parents have completed their binding; a parent without interfaces
+// leaves an empty element, like an unbound port
 
 void
-sc_port_base::insert_parent( int i )
+sc_port_base::insert_parents()
 {
-    std::vector<sc_bind_elem*>& vec = m_bind_info->vec;
-
-    this_type* parent = vec[i]->parent;
-
+    if( ! m_bind_info->has_parent ) {
+        return;
+    }
 
-    // IF OUR PARENT HAS NO BINDING THEN IGNORE IT:
-    //
-    // Note that the zeroing of the parent pointer must occur before this
-    // test
-
-    vec[i]->parent = 0;
-    if ( parent->m_bind_info->vec.size() == 0 ) return;
-
-    vec[i]->iface = parent->m_bind_info->vec[0]->iface;
-    int n = parent->m_bind_info->size() - 1;
-    if( n > 0 ) {
-	// resize the bind vector (by adding new elements)
-	for( int k = 0; k < n; ++ k ) {
-	    vec.push_back( new sc_bind_elem() );
-	}
-	// move elements in the bind vector
-	for( int k = m_bind_info->size() - n - 1; k > i; -- k ) {
-	    vec[k + n]->iface = vec[k]->iface;
-	    vec[k + n]->parent = vec[k]->parent;
-	}
-	// insert parent interfaces into the bind vector
-	for( int k = i + 1; k <= i + n; ++ k ) {
-	    vec[k]->iface = parent->m_bind_info->vec[k - i]->iface;
-	    vec[k]->parent = 0;
-	}
+    std::vector<sc_bind_elem>& vec = m_bind_info->vec;
+    std::vector<sc_bind_elem>  flat;
+    flat.reserve( vec.size() );
+    for( int i = 0; i < m_bind_info->size(); ++ i ) {
+        const this_type* parent = vec[i].parent;
+        if( parent == 0 ) {
+            flat.push_back( vec[i] );
+        } else if( parent->m_bind_info->vec.empty() ) {
+            flat.push_back( sc_bind_elem() );
+        } else {
+            flat.insert( flat.end(), parent->m_bind_info->vec.begin(),
+                                     parent->m_bind_info->vec.end() );
+        }
     }
+    vec.swap( flat );
 }
 
 
 // called when elaboration is done
+//
+// The parent ports must complete their binding before this port, so that
+// their interfaces can replace them. Rather than recursing along the
+// chains of ports bound to ports, the parents are completed depth-first
+// from an explicit stack, so that long chains neither exhaust the call
+// stack nor are traversed more than once, and each port copies the
+// interfaces of each of its parents once.
 
 void
 sc_port_base::complete_binding()
@@ -465,18 +452,54 @@ sc_port_base::complete_binding()
 
     // COMPLETE BINDING OF OUR PARENT PORTS SO THAT WE CAN USE THAT INFORMATION:
 
-    int i = first_parent();
-    while( i >= 0 ) {
-        m_bind_info->vec[i]->parent->complete_binding();
-        insert_parent( i );
-        i = first_parent();
+    typedef std::pair<this_type*,int> resolve_frame; // port, next element.
+    std::vector<resolve_frame> stack;
+
+    m_bind_info->resolving = true;
+    stack.push_back( resolve_frame( this, 0 ) );
+    while( ! stack.empty() ) {
+        this_type*    port = stack.back().first;
+        sc_bind_info* info = port->m_bind_info;
+        int           i = stack.back().second;
+
+        while( i < info->size() &&
+               ( info->vec[i].parent == 0 ||
+                 info->vec[i].parent->m_bind_info->complete ) ) {
+            ++ i;
+        }
+        stack.back().second = i + 1;
+        if( i == info->size() ) {
+            stack.pop_back();
+            info->resolving = false;
+            port->insert_parents();
+            port->finish_binding();
+            continue;
+        }
+
+        this_type* parent = info->vec[i].parent;
+        if( parent->m_bind_info->resolving ) {
+            info->vec[i].parent = 0;
+            port->report_error( SC_ID_BIND_PORT_TO_PORT_,
+                                "binding forms a cycle" );
+            // may continue, if suppressed: the parent is left unbound
+            continue;
+        }
+        parent->m_bind_info->resolving = true;
+        stack.push_back( resolve_frame( parent, 0 ) );
     }
+}
+
+
+// called by complete_binding once the parents are replaced
 
+void
+sc_port_base::finish_binding()
+{
     // LOOP OVER BINDING INFORMATION TO COMPLETE THE BINDING PROCESS:
 
     int size;
     for( int j = 0; j < m_bind_info->size(); ++ j ) {
-        sc_interface* iface = m_bind_info->vec[j]->iface;
+        sc_interface* iface = m_bind_info->vec[j].iface;
 
 	// if the interface is zero this was for an unbound port.
 	if ( iface == 0 ) continue;
@@ -725,7 +748,11 @@ sc_port_registry::complete_binding()
 void
 sc_port_registry::elaboration_done()
 {
-    complete_binding();
+    {
+        sc_elab_profiler::scope phase( m_simc->elab_profiler(),
+                                       "port binding" );
+        complete_binding();
+    }
 
     for( int i = size() - 1; i >= 0; -- i ) {
         m_port_vec[i]->elaboration_done();
@@ -165,14 +165,14 @@ private:
 
 
     // support methods
-    int first_parent();
-    void insert_parent( int );
+    void insert_parents();
 
     // called when construction is done
     void construction_done();
 
     // called when elaboration is done
     void complete_binding();
+    void finish_binding();
     void elaboration_done();
 
     // called before simulation starts
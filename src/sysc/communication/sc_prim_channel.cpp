@@ -32,6 +32,7 @@
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_object_int.h"
+#include "sysc/kernel/sc_parallel.h"
 
 #ifndef SC_DISABLE_ASYNC_UPDATES
 #  include "sysc/communication/sc_host_mutex.h"
@@ -53,7 +54,9 @@ namespace sc_core {
 sc_prim_channel::sc_prim_channel()
 : sc_object( 0 ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( 0 ) 
+  m_update_next_p( 0 ),
+  m_parallel_update_safe( false ),
+  m_parallel_update_type( 0 )
 {
     m_registry->insert( *this );
 }
@@ -61,7 +64,9 @@ sc_prim_channel::sc_prim_channel()
 sc_prim_channel::sc_prim_channel( const char* name_ )
 : sc_object( name_ ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( 0 )
+  m_update_next_p( 0 ),
+  m_parallel_update_safe( false ),
+  m_parallel_update_type( 0 )
 {
     m_registry->insert( *this );
 }
@@ -82,6 +87,17 @@ sc_prim_channel::update()
 {}
 
 
+// the dynamic type is only known once the channel is constructed, so the
+// check is made by the first query, on the simulation thread
+
+void
+sc_prim_channel::check_parallel_update_type() const
+{
+    if( typeid( *this ) != *m_parallel_update_type )
+        m_parallel_update_safe = false;
+    m_parallel_update_type = 0;
+}
+
 // called by construction_done (does nothing by default)
 
 void sc_prim_channel::before_end_of_elaboration() 
@@ -355,9 +371,9 @@ sc_prim_channel_registry::async_detach_suspending(sc_prim_channel& p)
 // |"sc_prim_channel_registry::perform_update"
 // |
 // | This method updates the values of the primitive channels in its update
-// | lists.
+// | lists and returns the number of updates performed.
 // +----------------------------------------------------------------------------
-void
+std::size_t
 sc_prim_channel_registry::perform_update()
 {
     // Update the values for the primitive channels set external to the
@@ -375,12 +391,23 @@ sc_prim_channel_registry::perform_update()
 
     now_p = m_update_list_p;
     m_update_list_p = (sc_prim_channel*)sc_prim_channel::list_end;
+
+    // With a worker pool, long update lists are processed in parallel.
+
+    if ( m_simc->m_parallel != 0 )
+    {
+        return m_simc->m_parallel->perform_updates( now_p );
+    }
+
+    std::size_t updates_n = 0;
     for ( ; now_p != (sc_prim_channel*)sc_prim_channel::list_end;
 	now_p = next_p )
     {
 	next_p = now_p->m_update_next_p;
 	now_p->perform_update();
+	++updates_n;
     }
+    return updates_n;
 }
 
 // constructor
@@ -33,6 +33,8 @@
 #include "sysc/kernel/sc_wait.h"
 #include "sysc/kernel/sc_wait_cthread.h"
 
+#include <typeinfo>
+
 namespace sc_core {
 
 // ----------------------------------------------------------------------------
@@ -45,6 +47,7 @@ class SC_API sc_prim_channel
 : public sc_object
 {
     friend class sc_prim_channel_registry;
+    friend class sc_parallel_engine;
 
 public:
     enum { list_end = 0xdb };
@@ -55,6 +58,14 @@ public:
     inline bool update_requested() 
 	{ return m_update_next_p != (sc_prim_channel*)list_end; }
 
+    // may update() run concurrently with the updates of other channels?
+    bool parallel_update_safe() const
+    {
+        if( m_parallel_update_type )
+            check_parallel_update_type();
+        return m_parallel_update_safe;
+    }
+
     // request the update method to be executed during the update phase
     inline void request_update();
 
@@ -92,6 +103,20 @@ protected:
     bool async_attach_suspending();
     bool async_detach_suspending();
 
+    // indicate that update() only modifies the state of this channel and
+    // may therefore be executed on a host thread of the parallel update
+    // phase (see sc_set_parallel_workers), concurrently with the updates
+    // of other channels marked this way.
+    void parallel_update_safe( bool safe )
+        { m_parallel_update_safe = safe; m_parallel_update_type = 0; }
+
+    // the same, but only as long as this channel is of the given dynamic
+    // type: the library channels mark themselves this way, so that classes
+    // derived from them by users, which may have further side effects in
+    // update(), stay sequential unless they opt in with the above.
+    void parallel_update_safe( bool safe, const std::type_info& type )
+        { m_parallel_update_safe = safe; m_parallel_update_type = &type; }
+
 protected:
 
     // to avoid calling sc_get_curr_simcontext()
@@ -215,6 +240,9 @@ private:
     // called after simulation ends
     void simulation_done();
 
+    // clear the parallel update safety of a derived channel
+    void check_parallel_update_type() const;
+
     // disabled
     sc_prim_channel( const sc_prim_channel& );
     sc_prim_channel& operator = ( const sc_prim_channel& );
@@ -223,6 +251,8 @@ private:
 
     sc_prim_channel_registry* m_registry;          // Update list manager.
     sc_prim_channel*          m_update_next_p;     // Next entry in update list.
+    mutable bool              m_parallel_update_safe; // Update may run in parallel.
+    mutable const std::type_info* m_parallel_update_type; // Only for this type.
 };
 
 
@@ -279,8 +309,9 @@ private:
     // destructor
     ~sc_prim_channel_registry();
 
-    // called during the update phase of a delta cycle
-    void perform_update();
+    // called during the update phase of a delta cycle, returns the number
+    // of updates performed
+    std::size_t perform_update();
 
     // called when construction is done
     bool construction_done();
@@ -340,7 +371,10 @@ void
 sc_prim_channel::request_update()
 {
     if( ! m_update_next_p ) {
-	m_registry->request_update( *this );
+	if( SC_UNLIKELY_( simcontext()->parallel_phase() ) )
+	    simcontext()->parallel_request_update( *this );
+	else
+	    m_registry->request_update( *this );
     }
 }
 
@@ -30,8 +30,10 @@
 #include "sysc/communication/sc_communication_ids.h"
 #include "sysc/utils/sc_utils_ids.h"
 #include "sysc/communication/sc_signal.h"
+#include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_reset.h"
 #include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/tracing/sc_trace_file_base.h"
 
 #include <sstream>
 
@@ -96,6 +98,7 @@ sc_writer_policy_check_port::
 sc_signal_channel::~sc_signal_channel()
 {
     delete m_change_event_p;
+    delete m_trace_marker_p;
 }
 
 void
@@ -159,6 +162,172 @@ sc_signal_channel::do_update()
 {
     notify_next_delta( m_change_event_p );
     m_change_stamp = simcontext()->change_stamp();
+    if( SC_UNLIKELY_( m_trace_marker_p != 0 ) )
+        m_trace_marker_p->mark();
+}
+
+void
+sc_signal_channel::mark_traces() const
+{
+    if( m_trace_marker_p )
+        m_trace_marker_p->mark();
+}
+
+// notify an event in the next delta cycle, or at once within a write
+void
+sc_signal_channel::notify_next_delta( sc_event* ev ) const
+{
+    if( !ev )
+        return;
+    if( SC_UNLIKELY_( m_compressed_update ) )
+        ev->notify();
+    else
+        ev->notify_next_delta();
+}
+
+// only methods are statically sensitive to the value changes
+bool
+sc_signal_channel::delta_compressible() const
+{
+    return methods_only();
+}
+
+// do only methods statically sensitive to this signal wait for it?
+bool
+sc_signal_channel::methods_only() const
+{
+    const sc_event* events[] =
+        { m_change_event_p, edge_event_p( true ), edge_event_p( false ) };
+    for( int i = 0; i < 3; ++i ) {
+        if( events[i] && !events[i]->static_methods_only() )
+            return false;
+    }
+    return true;
+}
+
+// is process_p a method statically sensitive to this signal?
+bool
+sc_signal_channel::static_method( const sc_process_b* process_p ) const
+{
+    const sc_event* events[] =
+        { m_change_event_p, edge_event_p( true ), edge_event_p( false ) };
+    for( int i = 0; i < 3; ++i ) {
+        if( events[i] && events[i]->static_method( process_p ) )
+            return true;
+    }
+    return false;
+}
+
+// the same for the processes of the simulator thread, keeping the answer
+// for the last process by its id, which is not reused like its address
+bool
+sc_signal_channel::sensitive_method( const sc_process_b* process_p ) const
+{
+    if( process_p->proc_id != m_checked_proc_id ) {
+        m_checked_proc_id = process_p->proc_id;
+        m_checked_sensitive = static_method( process_p );
+    }
+    return m_checked_sensitive;
+}
+
+//------------------------------------------------------------------------------
+//"sc_signal_channel::compressed_update"
+//
+// This method updates the signal in the evaluation phase, when written by a
+// method process on the simulator thread, so the processes sensitive to it
+// run in the current delta cycle. It returns false, if the signal has to be
+// updated in the update phase instead.
+//------------------------------------------------------------------------------
+bool
+sc_signal_channel::compressed_update()
+{
+    sc_simcontext* simc_p = simcontext();
+    if( !simc_p->evaluation_phase() || simc_p->parallel_phase()
+        || simc_p->get_curr_proc_info()->kind != SC_METHOD_PROC_ )
+        return false;
+
+    // a method reading its own output is run again in the next delta cycle,
+    // and so are the processes waiting for the signal dynamically
+    sc_process_b* writer_p = simc_p->get_curr_proc_info()->process_handle;
+    if( sensitive_method( writer_p ) || !methods_only() )
+        return false;
+
+    // the other readers see the value from before the delta cycle
+    if( m_compressed_stamp != simc_p->change_stamp() ) {
+        m_compressed_stamp = simc_p->change_stamp();
+        keep_value();
+    }
+
+    // the sensitive methods are queued by their rank after the writer
+    m_compressed_update = true;
+    simc_p->m_ranked_writer = static_cast<sc_method_handle>( writer_p );
+    update();
+    simc_p->m_ranked_writer = 0;
+    m_compressed_update = false;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+//"sc_signal_channel::check_reader"
+//
+// This method is called for the reads of a compressed signal. It returns
+// true, if the current process has to read the value from before the
+// compressed update in the current delta cycle, since it is not a method
+// statically sensitive to the signal. Such a reader also stops the
+// compression of the signal, once the value kept is no longer needed. The
+// parallel workers leave the signal as it is.
+//------------------------------------------------------------------------------
+bool
+sc_signal_channel::check_reader() const
+{
+    sc_simcontext* simc_p = simcontext();
+    const sc_process_b* reader_p = simc_p->get_curr_proc_info()->process_handle;
+    bool updated = m_compressed_stamp == simc_p->change_stamp()
+                   && simc_p->evaluation_phase();
+    if( simc_p->parallel_phase() )
+        return updated && !static_method( reader_p );
+
+    bool other = reader_p != 0 && !sensitive_method( reader_p );
+    if( other )
+        m_other_reader = true;
+    if( m_other_reader && !updated )
+        m_delta_compression = false;
+    return updated && other;
+}
+
+//------------------------------------------------------------------------------
+//"sc_signal_channel::select_delta_compression"
+//
+// This method is called at the end of the elaboration for the top level
+// objects. It enables the delta cycle compression of the signals selected
+// by themselves or by a module above them, if they qualify.
+//------------------------------------------------------------------------------
+void
+sc_signal_channel::select_delta_compression(
+    const std::vector<sc_object*>& objects, bool selected )
+{
+    for( std::size_t i = 0; i < objects.size(); ++i )
+    {
+        sc_object* obj_p = objects[i];
+        sc_module* module_p = dynamic_cast<sc_module*>( obj_p );
+        if( module_p ) {
+            select_delta_compression( module_p->get_child_objects(),
+                                      selected
+                                      || module_p->delta_compression() );
+            continue;
+        }
+
+        sc_signal_channel* signal_p = dynamic_cast<sc_signal_channel*>(obj_p);
+        if( !signal_p || signal_p->m_compression == compression_off
+            || ( !selected && signal_p->m_compression == compression_default ) )
+            continue;
+
+        signal_p->m_delta_compression = signal_p->delta_compressible();
+        if( !signal_p->m_delta_compression
+            && signal_p->m_compression == compression_on )
+            SC_REPORT_WARNING( SC_ID_DELTA_COMPRESSION_NOT_POSSIBLE_,
+                               signal_p->name() );
+    }
 }
 
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
@@ -173,6 +342,13 @@ sc_signal<bool,POL>::update()
     }
 }
 
+template< sc_writer_policy POL >
+bool
+sc_signal<bool,POL>::delta_compressible() const
+{
+    return !m_reset_p && !is_clock() && base_type::delta_compressible();
+}
+
 template< sc_writer_policy POL >
 void
 sc_signal<bool,POL>::do_update()
@@ -210,7 +386,11 @@ sc_reset*
 sc_signal<bool,POL>::is_reset() const
 {
     sc_reset* result_p;
-    if ( !m_reset_p ) m_reset_p = new sc_reset( this );
+    if ( !m_reset_p ) {
+        m_reset_p = new sc_reset( this );
+        // updates notify the reset processes from now on
+        const_cast<sc_signal*>( this )->parallel_update_safe( false );
+    }
     result_p = m_reset_p;
     return result_p;
 }
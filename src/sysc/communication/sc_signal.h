@@ -33,6 +33,7 @@
 #include "sysc/communication/sc_prim_channel.h"
 #include "sysc/communication/sc_signal_ifs.h"
 #include "sysc/communication/sc_writer_policy.h"
+#include "sysc/kernel/sc_checkpoint.h"
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_simcontext.h"
@@ -42,6 +43,8 @@
 
 namespace sc_core {
 
+class sc_trace_marker;
+
 inline
 bool
 sc_writer_policy_check_write::check_write( sc_object* target, bool /*value_changed*/ )
@@ -78,17 +81,47 @@ sc_writer_policy_check_write::update()
 //  CLASS : sc_signal_channel
 //
 //  The sc_signal type-agnostic primitive channel base class.
+//
+//  Delta cycle compression: a signal selected by set_delta_compression(),
+//  or inside a module selected by sc_module::set_delta_compression(), is
+//  updated as soon as a method process writes it during the evaluation
+//  phase, and notifies its events immediately, so the methods sensitive to
+//  it run in the same delta cycle. A chain of combinational methods then
+//  settles in one delta cycle instead of one per stage. The triggered
+//  methods run in topological order, each one ranked after the methods
+//  writing its compressed inputs as learnt from their writes, so a method
+//  fed by reconverging paths runs once as soon as the ranks are known.
+//  Only the methods statically sensitive to the signal see the new value
+//  before the update phase; any other process reading the signal gets the
+//  value from before the write, as without compression, and stops the
+//  compression of the signal. At the end of the elaboration a selected
+//  signal is only compressed if it has a single writer and neither threads
+//  nor a reset are statically sensitive to it; otherwise, and for the
+//  writes of threads, of methods sensitive to the signal themselves, or
+//  while processes wait for its events dynamically, the signal is updated
+//  in the update phase as usual.
 // ----------------------------------------------------------------------------
 
 class SC_API sc_signal_channel
   : public sc_prim_channel
 {
+    friend class sc_simcontext;
+    friend class sc_trace_source;
+
 protected:
 
     sc_signal_channel( const char* name_ )
       : sc_prim_channel( name_ )
       , m_change_event_p( 0 )
       , m_change_stamp( ~sc_dt::UINT64_ONE )
+      , m_compression( compression_default )
+      , m_delta_compression( false )
+      , m_compressed_update( false )
+      , m_other_reader( false )
+      , m_compressed_stamp( ~sc_dt::UINT64_ONE )
+      , m_checked_proc_id( -1 )
+      , m_checked_sensitive( false )
+      , m_trace_marker_p( 0 )
     {}
 
 public:
@@ -111,9 +144,38 @@ public:
     bool event() const
         { return simcontext()->event_occurred(m_change_stamp); }
 
+    // update this signal within the delta cycle of the write, or not even
+    // if its module is selected
+    void set_delta_compression( bool on = true )
+        { m_compression = on ? compression_on : compression_off; }
+
+    // is this signal updated within the delta cycle of the write?
+    bool delta_compression() const
+        { return m_delta_compression && !m_other_reader; }
+
 protected:
     void do_update();
 
+    // may this signal be updated within the delta cycle of the write?
+    virtual bool delta_compressible() const;
+
+    // the positive or negative edge event, if present
+    virtual sc_event* edge_event_p( bool /* posedge */ ) const
+        { return 0; }
+
+    // update this signal now, if written by a method process
+    bool compressed_update();
+
+    // keep the current value for the readers of the compressed update
+    virtual void keep_value() {}
+
+    // does the current process read the value kept by keep_value()?
+    bool stale_read() const
+        { return SC_UNLIKELY_( m_delta_compression ) && check_reader(); }
+
+    // mark the traces of this signal as changed, see sc_trace_change_driven()
+    void mark_traces() const;
+
     // reporting to avoid code bloat in sc_signal_t
 
     void deprecated_get_data_ref()  const;
@@ -121,13 +183,33 @@ protected:
     void deprecated_trace()         const;
 
     sc_event* lazy_kernel_event( sc_event**, const char* ) const;
-    void notify_next_delta( sc_event* ev ) const
-        { if( ev ) ev->notify_next_delta(); }
+    void notify_next_delta( sc_event* ev ) const;
 
 protected:
     mutable sc_event* m_change_event_p;  // value change event if present.
     sc_dt::uint64     m_change_stamp;    // delta of last event
 
+private:
+    enum compression_t { compression_default, compression_on, compression_off };
+
+    static void select_delta_compression( const std::vector<sc_object*>&,
+                                          bool selected );
+
+    bool methods_only() const;
+    bool static_method( const sc_process_b* ) const;
+    bool sensitive_method( const sc_process_b* ) const;
+    bool check_reader() const;
+
+    compression_t     m_compression;       // as selected for this signal.
+    mutable bool      m_delta_compression; // updates are compressed.
+    bool              m_compressed_update; // update() runs in the write.
+    mutable bool      m_other_reader;      // read by another process.
+    sc_dt::uint64     m_compressed_stamp;  // change stamp of the last one.
+    mutable int       m_checked_proc_id;   // last process checked, and if
+    mutable bool      m_checked_sensitive; // ... it is a sensitive method.
+
+    mutable sc_trace_marker* m_trace_marker_p; // traces driven by updates.
+
 private:
     // disabled
     sc_signal_channel( const sc_signal_channel& ) /* = delete */;
@@ -171,9 +253,17 @@ protected:
       : base_type( name_ )
       , m_cur_val( initial_value_ )
       , m_new_val( initial_value_ )
-    {}
+      , m_old_val_p( 0 )
+    {
+        // the update only touches this signal, unless the writer policy
+        // has to release the last writer during the update phase (derived
+        // classes have to opt in, see sc_prim_channel)
+        this->parallel_update_safe( !policy_type::needs_update(),
+                                    typeid( sc_signal<T,POL> ) );
+    }
 
-    virtual ~sc_signal_t() {} /* = default; */
+    virtual ~sc_signal_t()
+        { delete m_old_val_p; }
 
 public:
 
@@ -197,7 +287,7 @@ public:
 
     // read the current value
     virtual const T& read() const
-	{ return m_cur_val; }
+	{ return this->stale_read() ? *m_old_val_p : m_cur_val; }
 
     // get a reference to the current value (for tracing)
     virtual const T& get_data_ref() const
@@ -258,9 +348,15 @@ protected:
     virtual void update();
             void do_update();
 
+    virtual bool delta_compressible() const;
+    virtual void keep_value();
+
+    virtual void checkpoint_state( sc_checkpoint_archive& ar );
+
 protected:
     T m_cur_val;         // current value of object.
     T m_new_val;         // next value of object.
+    T* m_old_val_p;      // value before a compressed update.
 
 private:
     // disabled
@@ -295,6 +391,8 @@ sc_signal_t<T,POL>::write( const T& value_ )
 
     m_new_val = value_;
     if( value_changed || policy_type::needs_update() ) {
+        if( SC_UNLIKELY_( delta_compression() ) && compressed_update() )
+            return;
         request_update();
     }
 }
@@ -336,6 +434,37 @@ sc_signal_t<T,POL>::do_update()
     m_cur_val = m_new_val;
 }
 
+// a single writer, which is not released in the update phase
+
+template< class T, sc_writer_policy POL >
+bool
+sc_signal_t<T,POL>::delta_compressible() const
+{
+    return POL == SC_ONE_WRITER && !policy_type::needs_update()
+           && base_type::delta_compressible();
+}
+
+template< class T, sc_writer_policy POL >
+void
+sc_signal_t<T,POL>::keep_value()
+{
+    if( !m_old_val_p )
+        m_old_val_p = new T( m_cur_val );
+    else
+        *m_old_val_p = m_cur_val;
+}
+
+template< class T, sc_writer_policy POL >
+void
+sc_signal_t<T,POL>::checkpoint_state( sc_checkpoint_archive& ar )
+{
+    ar.io( m_cur_val );
+    if( ar.restoring() ) {
+        m_new_val = m_cur_val;
+        this->mark_traces();
+    }
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_signal<T, POL>
 //
@@ -460,6 +589,11 @@ protected:
     virtual void update();
             void do_update();
 
+    virtual bool delta_compressible() const;
+
+    virtual sc_event* edge_event_p( bool posedge ) const
+        { return posedge ? m_posedge_event_p : m_negedge_event_p; }
+
     virtual bool is_clock() const { return false; }
 
 protected:
@@ -547,6 +681,9 @@ protected:
     virtual void update();
             void do_update();
 
+    virtual sc_event* edge_event_p( bool posedge ) const
+        { return posedge ? m_posedge_event_p : m_negedge_event_p; }
+
 protected:
     mutable sc_event* m_negedge_event_p; // negative edge event if present.
     mutable sc_event* m_posedge_event_p; // positive edge event if present.
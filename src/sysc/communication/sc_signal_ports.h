@@ -304,7 +304,7 @@ sc_in<T>::end_of_elaboration()
 	for( int i = 0; i < (int)m_traces->size(); ++ i ) {
 	    sc_trace_params* p = (*m_traces)[i];
 	    in_if_type* iface = dynamic_cast<in_if_type*>( this->get_interface() );
-	    sc_trace( p->tf, iface->read(), p->name );
+	    sc_trace( p->tf, *iface, p->name );
 	}
 	remove_traces();
     }
@@ -1141,7 +1141,7 @@ sc_inout<T>::end_of_elaboration()
 	for( int i = 0; i < (int)m_traces->size(); ++ i ) {
 	    sc_trace_params* p = (*m_traces)[i];
 	    in_if_type* iface = dynamic_cast<in_if_type*>( this->get_interface() );
-	    sc_trace( p->tf, iface->read(), p->name );
+	    sc_trace( p->tf, *iface, p->name );
 	}
 	remove_traces();
     }
@@ -1756,7 +1756,7 @@ sc_trace(sc_trace_file* tf, const sc_in<T>& port, const std::string& name)
     }
 
     if ( iface )
-	sc_trace( tf, iface->read(), name );
+	sc_trace( tf, *iface, name );
     else
 	port.add_trace_internal( tf, name );
 }
@@ -1774,7 +1774,7 @@ sc_trace( sc_trace_file* tf, const sc_inout<T>& port,
     }
 
     if ( iface )
-	sc_trace( tf, iface->read(), name );
+	sc_trace( tf, *iface, name );
     else
 	port.add_trace_internal( tf, name );
 }
@@ -66,20 +66,21 @@ public:
 
     // constructors
 
+    // the resolution in update() only touches this signal
     sc_signal_resolved()
       : base_type( sc_gen_unique_name( "signal_resolved" ) )
       , m_proc_vec(), m_val_vec()
-    {}
+    { parallel_update_safe( true, typeid( this_type ) ); }
 
     explicit sc_signal_resolved( const char* name_ )
       : base_type( name_ )
       , m_proc_vec(), m_val_vec()
-    {}
+    { parallel_update_safe( true, typeid( this_type ) ); }
 
     sc_signal_resolved( const char* name_, const value_type& initial_value_ )
       : base_type( name_, initial_value_ )
       , m_proc_vec() , m_val_vec()
-    {}
+    { parallel_update_safe( true, typeid( this_type ) ); }
 
     // interface methods
 
@@ -106,17 +106,18 @@ public:
 
     // constructors
 
+    // the resolution in update() only touches this signal
     sc_signal_rv()
       : base_type( sc_gen_unique_name( "signal_rv" ) )
-    {}
+    { this->parallel_update_safe( true, typeid( this_type ) ); }
 
     explicit sc_signal_rv( const char* name_ )
       : base_type( name_, value_type() )
-    {}
+    { this->parallel_update_safe( true, typeid( this_type ) ); }
 
     sc_signal_rv( const char* name_, const value_type& initial_value_ )
       : base_type( name_, initial_value_ )
-    {}
+    { this->parallel_update_safe( true, typeid( this_type ) ); }
 
 
     // destructor
@@ -0,0 +1,147 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_sync_channel.cpp -- Thread-safe message channel between
+                         synchronization domains and kernel processes.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/communication/sc_sync_channel.h"
+#include "sysc/kernel/sc_sync_domain.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace sc_core {
+
+// The channels with unpublished messages, written by the domains on their
+// host threads.
+
+static sc_host_mutex                       written_mutex;
+static std::vector<sc_sync_channel_base*>  written_channels;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_sync_channel_base
+//
+//  The type-independent part of sc_sync_channel<T>.
+// ----------------------------------------------------------------------------
+
+sc_sync_channel_base::sc_sync_channel_base( const char* name_,
+                                            const sc_time& latency_ )
+  : sc_prim_channel( name_ ),
+    m_mutex(), m_unpublished( 0 ), m_latency( latency_ ), m_last_arrival(),
+    m_data_written_event( sc_event::kernel_event, "write_event" )
+{}
+
+sc_sync_channel_base::~sc_sync_channel_base()
+{
+    sc_scoped_lock lock( written_mutex );
+    written_channels.erase( std::remove( written_channels.begin(),
+                                         written_channels.end(), this ),
+                            written_channels.end() );
+}
+
+void
+sc_sync_channel_base::start_of_simulation()
+{
+    if( m_latency < sc_sync_domain::quantum() )
+        m_latency = sc_sync_domain::quantum();
+}
+
+// The arrival times of a channel never decrease, so that the messages are
+// read in the order they were written.
+
+sc_time
+sc_sync_channel_base::arrival_time( const sc_time& local_time )
+{
+    sc_time arrival = local_time + m_latency;
+    if( arrival < m_last_arrival )
+        arrival = m_last_arrival;
+    m_last_arrival = arrival;
+    return arrival;
+}
+
+void
+sc_sync_channel_base::written_by_domain()
+{
+    if( m_unpublished++ != 0 )
+        return;
+    sc_scoped_lock lock( written_mutex );
+    written_channels.push_back( this );
+}
+
+void
+sc_sync_channel_base::written_by_kernel( bool first )
+{
+    if( first )
+        request_update();
+}
+
+// All notifications of the messages of a window are computed here, in the
+// same delta cycle of its end, whatever the timing of the host threads.
+
+void
+sc_sync_channel_base::publish_written()
+{
+    std::vector<sc_sync_channel_base*> channels;
+    {
+        sc_scoped_lock lock( written_mutex );
+        channels.swap( written_channels );
+    }
+    for( std::size_t i = 0; i < channels.size(); ++i )
+    {
+        {
+            sc_scoped_lock lock( channels[i]->m_mutex );
+            channels[i]->m_unpublished = 0;
+        }
+        channels[i]->request_update();
+    }
+}
+
+void
+sc_sync_channel_base::update()
+{
+    sc_time arrival;
+    {
+        sc_scoped_lock lock( m_mutex );
+        if( !next_arrival( arrival ) )
+            return;
+    }
+    const sc_time& now = sc_time_stamp();
+    if( arrival > now )
+        m_data_written_event.notify( arrival - now );
+    else
+        m_data_written_event.notify( SC_ZERO_TIME );
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
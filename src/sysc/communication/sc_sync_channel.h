@@ -0,0 +1,255 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_sync_channel.h -- Thread-safe message channel between synchronization
+                       domains and kernel processes.
+
+  Each message carries the local time at which it was written plus the
+  latency of the channel, which is at least one synchronization quantum
+  (see sc_sync_domain). A message becomes readable at that arrival time.
+  Synchronization domains pass their local time explicitly; kernel
+  processes use the overloads without a time, which take the current
+  simulation time and which must not be called from a domain.
+
+  The messages written by the domains in a window are published when the
+  kernel has joined all domains at its end: only then are they readable
+  and is data_written_event() notified, so that neither depends on how
+  far the host threads got.
+
+  A channel has a single writer and a single reader. Messages are read in
+  the order they were written.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_SYNC_CHANNEL_H_INCLUDED_
+#define SC_SYNC_CHANNEL_H_INCLUDED_
+
+#include "sysc/communication/sc_host_mutex.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_simcontext.h"
+
+#include <deque>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_sync_channel_base
+//
+//  The type-independent part of sc_sync_channel<T>.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_sync_channel_base
+: public sc_prim_channel
+{
+public:
+
+    // delay between writing and arrival of a message
+    const sc_time& latency() const
+        { return m_latency; }
+
+    // notified in the kernel when the next unread message arrives
+    const sc_event& data_written_event() const
+        { return m_data_written_event; }
+
+    virtual const sc_event& default_event() const
+        { return m_data_written_event; }
+
+    virtual const char* kind() const
+        { return "sc_sync_channel"; }
+
+protected:
+
+    sc_sync_channel_base( const char* name_, const sc_time& latency_ );
+    virtual ~sc_sync_channel_base();
+
+    // raises the latency to the synchronization quantum
+    virtual void start_of_simulation();
+
+    // notifies data_written_event() for the next unread message
+    virtual void update();
+
+    // arrival time of a message written at local_time (lock held)
+    sc_time arrival_time( const sc_time& local_time );
+
+    // arrival time of the next readable message, if any (lock held)
+    virtual bool next_arrival( sc_time& arrival ) const = 0;
+
+    // a message was written by a domain (lock held) or by the kernel
+    void written_by_domain();
+    void written_by_kernel( bool first );
+
+public:
+
+    // publish the messages written by the domains in the window just
+    // finished (called by sc_sync_domain once all domains are joined)
+    static void publish_written();
+
+protected:
+    mutable sc_host_mutex m_mutex;             // protects the messages.
+    std::size_t           m_unpublished;       // the last messages, unread
+                                               // before publish_written().
+
+private:
+    sc_time               m_latency;           // delay of each message.
+    sc_time               m_last_arrival;      // of the last written message.
+    sc_event              m_data_written_event;
+
+private:
+    // disabled
+    sc_sync_channel_base( const sc_sync_channel_base& );
+    sc_sync_channel_base& operator = ( const sc_sync_channel_base& );
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_sync_channel<T>
+//
+//  Thread-safe message channel between synchronization domains and kernel
+//  processes.
+// ----------------------------------------------------------------------------
+
+template <class T>
+class sc_sync_channel
+: public sc_sync_channel_base
+{
+public:
+
+    // constructor; a latency below the synchronization quantum is raised
+    // to the quantum at the start of the simulation
+
+    explicit sc_sync_channel( const char* name_ =
+                                sc_gen_unique_name( "sync_channel" ),
+                              const sc_time& latency_ = SC_ZERO_TIME )
+      : sc_sync_channel_base( name_, latency_ ), m_messages()
+      {}
+
+
+    // write a message at the given local time (synchronization domains)
+    void write( const T& value, const sc_time& local_time );
+
+    // read the next message, if it has arrived at the given local time
+    // (synchronization domains)
+    bool nb_read( T& value, const sc_time& local_time );
+
+
+    // write a message at the current simulation time (kernel processes)
+    void write( const T& value );
+
+    // read the next message, if it has arrived (kernel processes)
+    bool nb_read( T& value );
+
+protected:
+
+    virtual bool next_arrival( sc_time& arrival ) const;
+
+private:
+
+    struct message
+    {
+        message( const sc_time& t, const T& v ) : arrival( t ), value( v ) {}
+
+        sc_time arrival;
+        T       value;
+    };
+
+    std::deque<message> m_messages;
+};
+
+
+// IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII INLINE IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
+
+template <class T>
+inline
+void
+sc_sync_channel<T>::write( const T& value, const sc_time& local_time )
+{
+    sc_scoped_lock lock( m_mutex );
+    m_messages.push_back( message( arrival_time( local_time ), value ) );
+    written_by_domain();
+}
+
+template <class T>
+inline
+void
+sc_sync_channel<T>::write( const T& value )
+{
+    bool first;
+    {
+        sc_scoped_lock lock( m_mutex );
+        first = m_messages.empty();
+        m_messages.push_back( message( arrival_time( sc_time_stamp() ),
+                                       value ) );
+    }
+    written_by_kernel( first );
+}
+
+template <class T>
+inline
+bool
+sc_sync_channel<T>::nb_read( T& value, const sc_time& local_time )
+{
+    sc_scoped_lock lock( m_mutex );
+    if( m_messages.size() <= m_unpublished ||
+        m_messages.front().arrival > local_time )
+        return false;
+    value = m_messages.front().value;
+    m_messages.pop_front();
+    return true;
+}
+
+template <class T>
+inline
+bool
+sc_sync_channel<T>::nb_read( T& value )
+{
+    if( !nb_read( value, sc_time_stamp() ) )
+        return false;
+    request_update(); // notify the arrival of the next message
+    return true;
+}
+
+template <class T>
+inline
+bool
+sc_sync_channel<T>::next_arrival( sc_time& arrival ) const
+{
+    if( m_messages.size() <= m_unpublished )
+        return false;
+    arrival = m_messages.front().arrival;
+    return true;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_SYNC_CHANNEL_H_INCLUDED_
+// Taf!
@@ -0,0 +1,471 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_checkpoint.cpp -- Checkpoint and restore of the simulation state.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_checkpoint.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_object.h"
+#include "sysc/kernel/sc_object_manager.h"
+#include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_timed_queue.h"
+#include "sysc/utils/sc_report.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace sc_core {
+
+namespace {
+
+const char checkpoint_magic[] = "SystemC checkpoint 1";
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_checkpoint_archive
+//
+//  Saves or restores the state of an object in checkpoint_state().
+// ----------------------------------------------------------------------------
+
+sc_checkpoint_archive::sc_checkpoint_archive()
+  : m_saving( true ), m_failed( false ), m_unsupported( 0 ), m_data(),
+    m_pos( 0 )
+{}
+
+sc_checkpoint_archive::sc_checkpoint_archive( const std::string& data )
+  : m_saving( false ), m_failed( false ), m_unsupported( 0 ), m_data( data ),
+    m_pos( 0 )
+{}
+
+void
+sc_checkpoint_archive::io_bytes( void* p, std::size_t n )
+{
+    if( m_saving ) {
+        m_data.append( static_cast<const char*>( p ), n );
+    } else if( m_failed || m_data.size() - m_pos < n ) {
+        m_failed = true;
+    } else {
+        std::memcpy( p, m_data.data() + m_pos, n );
+        m_pos += n;
+    }
+}
+
+void
+sc_checkpoint_archive::unsupported()
+{
+    ++m_unsupported;
+}
+
+void
+sc_checkpoint_traits< std::string >::io( sc_checkpoint_archive& ar,
+                                         std::string& value )
+{
+    sc_dt::uint64 n = value.size();
+    ar.io( n );
+    if( ar.saving() ) {
+        ar.io_bytes( const_cast<char*>( value.data() ), value.size() );
+    } else if( ar.failed() || ar.m_data.size() - ar.m_pos < n ) {
+        ar.m_failed = true;
+    } else {
+        value.assign( ar.m_data, ar.m_pos, static_cast<std::size_t>( n ) );
+        ar.m_pos += static_cast<std::size_t>( n );
+    }
+}
+
+void
+sc_checkpoint_traits< sc_time >::io( sc_checkpoint_archive& ar,
+                                     sc_time& value )
+{
+    sc_time::value_type v = value.value();
+    ar.io( v );
+    if( ar.restoring() && !ar.failed() )
+        value = sc_time::from_value( v );
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_checkpoint
+//
+//  A checkpoint read from a file, to be restored when simulation starts.
+// ----------------------------------------------------------------------------
+
+sc_checkpoint::sc_checkpoint( sc_simcontext* simc_p )
+  : m_simc( simc_p ), m_resolution( 0.0 ), m_time( 0 ), m_delta_count( 0 ),
+    m_change_stamp( 0 ), m_objects(), m_events(), m_unsupported( 0 ),
+    m_unsupported_name(), m_dropped( 0 ), m_waiting( 0 ), m_waiting_name(),
+    m_restored( 0 )
+{}
+
+void
+sc_checkpoint::save( const char* file_name )
+{
+    m_resolution = m_simc->m_time_params->time_resolution;
+    m_time = m_simc->m_curr_time.value();
+    m_delta_count = m_simc->m_delta_count;
+    m_change_stamp = m_simc->m_change_stamp;
+    save_objects( sc_get_top_level_objects( m_simc ) );
+    save_events();
+
+    sc_checkpoint_archive ar;
+    std::string magic( checkpoint_magic );
+    ar.io( magic );
+    ar.io( m_resolution );
+    ar.io( m_time );
+    ar.io( m_delta_count );
+    ar.io( m_change_stamp );
+
+    sc_dt::uint64 objects_n = m_objects.size();
+    ar.io( objects_n );
+    std::map<std::string, std::string>::iterator it = m_objects.begin();
+    for( ; it != m_objects.end(); ++it ) {
+        std::string name( it->first );
+        ar.io( name );
+        ar.io( it->second );
+    }
+
+    sc_dt::uint64 events_n = m_events.size();
+    ar.io( events_n );
+    for( std::size_t i = 0; i < m_events.size(); ++i ) {
+        ar.io( m_events[i].event_name );
+        ar.io( m_events[i].time );
+        ar.io( m_events[i].delta );
+    }
+
+    std::ofstream os( file_name, std::ios::out | std::ios::binary );
+    os.write( ar.m_data.data(), ar.m_data.size() );
+    os.close();
+    if( !os ) {
+        std::string msg = std::string( "cannot write '" ) + file_name + "'";
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_FAILED_, msg.c_str() );
+        return;
+    }
+
+    if( m_unsupported != 0 ) {
+        std::stringstream msg;
+        msg << m_unsupported << " value(s) without sc_checkpoint_traits not"
+            << " saved, e.g. in '" << m_unsupported_name << "'";
+        SC_REPORT_WARNING( SC_ID_CHECKPOINT_INCOMPLETE_, msg.str().c_str() );
+    }
+    if( m_dropped != 0 ) {
+        std::stringstream msg;
+        msg << m_dropped << " notification(s) of unnamed events not saved";
+        SC_REPORT_WARNING( SC_ID_CHECKPOINT_INCOMPLETE_, msg.str().c_str() );
+    }
+    if( m_waiting != 0 ) {
+        std::stringstream msg;
+        msg << m_waiting << " process(es) waiting for a timeout or a dynamic"
+            << " event not saved, e.g. '" << m_waiting_name << "'";
+        SC_REPORT_WARNING( SC_ID_CHECKPOINT_INCOMPLETE_, msg.str().c_str() );
+    }
+}
+
+bool
+sc_checkpoint::load( const char* file_name )
+{
+    std::ifstream is( file_name, std::ios::in | std::ios::binary );
+    if( !is ) {
+        std::string msg = std::string( "cannot read '" ) + file_name + "'";
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_FAILED_, msg.c_str() );
+        return false;
+    }
+    std::ostringstream data;
+    data << is.rdbuf();
+
+    sc_checkpoint_archive ar( data.str() );
+    std::string magic;
+    ar.io( magic );
+    if( ar.failed() || magic != checkpoint_magic ) {
+        std::string msg = std::string( "'" ) + file_name
+                        + "' is not a checkpoint";
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_FAILED_, msg.c_str() );
+        return false;
+    }
+    ar.io( m_resolution );
+    ar.io( m_time );
+    ar.io( m_delta_count );
+    ar.io( m_change_stamp );
+
+    sc_dt::uint64 objects_n = 0;
+    ar.io( objects_n );
+    for( sc_dt::uint64 i = 0; i < objects_n && !ar.failed(); ++i ) {
+        std::string name;
+        ar.io( name );
+        ar.io( m_objects[name] );
+    }
+
+    sc_dt::uint64 events_n = 0;
+    ar.io( events_n );
+    for( sc_dt::uint64 i = 0; i < events_n && !ar.failed(); ++i ) {
+        notification n;
+        ar.io( n.event_name );
+        ar.io( n.time );
+        ar.io( n.delta );
+        m_events.push_back( n );
+    }
+
+    if( ar.failed() ) {
+        std::string msg = std::string( "'" ) + file_name + "' is truncated";
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_FAILED_, msg.c_str() );
+        return false;
+    }
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_checkpoint::restore"
+// |
+// | This method is called by the simulation context after the
+// | start_of_simulation callbacks and the first update phase, before any
+// | process is made runnable. The notifications issued during
+// | elaboration are cancelled, the simulation time, the delta count and
+// | the objects are restored, and the events are notified as they were
+// | pending when the checkpoint was taken.
+// +----------------------------------------------------------------------------
+void
+sc_checkpoint::restore()
+{
+    if( m_resolution != m_simc->m_time_params->time_resolution ) {
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_FAILED_,
+                         "the time resolution differs from the checkpoint" );
+        return;
+    }
+
+    cancel_pending_events();
+
+    m_simc->m_curr_time = sc_time::from_value( m_time );
+    m_simc->m_delta_count = m_delta_count;
+    m_simc->m_initial_delta_count_at_current_time = m_delta_count;
+    m_simc->m_change_stamp = m_change_stamp;
+
+    restore_objects( sc_get_top_level_objects( m_simc ) );
+    if( !m_objects.empty() ) {
+        std::stringstream msg;
+        msg << "state of " << m_objects.size() << " object(s) not restored,"
+            << " e.g. '" << m_objects.begin()->first << "' not found";
+        SC_REPORT_WARNING( SC_ID_CHECKPOINT_INCOMPLETE_, msg.str().c_str() );
+    }
+
+    sc_object_manager* object_manager = m_simc->get_object_manager();
+    int missing = 0;
+    std::string missing_name;
+    for( std::size_t i = 0; i < m_events.size(); ++i ) {
+        const notification& n = m_events[i];
+        sc_event* e = object_manager->find_event( n.event_name.c_str() );
+        if( e == 0 ) {
+            if( missing++ == 0 )
+                missing_name = n.event_name;
+            continue;
+        }
+        e->cancel();
+        if( n.delta ) {
+            e->notify_internal( SC_ZERO_TIME );
+        } else {
+            sc_event_timed* et =
+                new sc_event_timed( e, sc_time::from_value( n.time ) );
+            m_simc->add_timed_event( et );
+            e->m_timed = et;
+            e->m_notify_type = sc_event::TIMED;
+        }
+    }
+    if( missing != 0 ) {
+        std::stringstream msg;
+        msg << missing << " notification(s) not restored, e.g. of '"
+            << missing_name << "' not found";
+        SC_REPORT_WARNING( SC_ID_CHECKPOINT_INCOMPLETE_, msg.str().c_str() );
+    }
+}
+
+void
+sc_checkpoint::save_objects( const std::vector<sc_object*>& objects )
+{
+    for( std::size_t i = 0; i < objects.size(); ++i ) {
+        sc_object* object_p = objects[i];
+        sc_checkpoint_archive ar;
+        object_p->checkpoint_state( ar );
+        if( ar.m_unsupported != 0 ) {
+            if( m_unsupported == 0 )
+                m_unsupported_name = object_p->name();
+            m_unsupported += ar.m_unsupported;
+        }
+        if( !ar.m_data.empty() )
+            m_objects[object_p->name()].swap( ar.m_data );
+        save_objects( object_p->get_child_objects() );
+    }
+}
+
+void
+sc_checkpoint::restore_objects( const std::vector<sc_object*>& objects )
+{
+    for( std::size_t i = 0; i < objects.size(); ++i ) {
+        sc_object* object_p = objects[i];
+        std::map<std::string, std::string>::iterator it =
+            m_objects.find( object_p->name() );
+        if( it != m_objects.end() ) {
+            sc_checkpoint_archive ar( it->second );
+            object_p->checkpoint_state( ar );
+            if( ar.failed() || ar.m_pos != ar.m_data.size() ) {
+                std::string msg = std::string( "state of '" )
+                                + object_p->name()
+                                + "' does not match the checkpoint";
+                SC_REPORT_WARNING( SC_ID_CHECKPOINT_INCOMPLETE_,
+                                   msg.c_str() );
+            }
+            m_objects.erase( it );
+            ++m_restored;
+        }
+        restore_objects( object_p->get_child_objects() );
+    }
+}
+
+bool
+sc_checkpoint::notified_earlier( const sc_event_timed* a,
+                                 const sc_event_timed* b )
+{
+    return a->notify_time() < b->notify_time();
+}
+
+// record the pending notifications of the named events; the notifications
+// of the kernel events belong to the processes, which start over
+
+void
+sc_checkpoint::save_events()
+{
+    sc_object_manager* object_manager = m_simc->get_object_manager();
+    std::vector<sc_event*> pending( m_simc->m_delta_events );
+
+    // read the timed notifications without changing the queue, so that
+    // the simulation continues as if no checkpoint had been taken
+    std::vector<sc_event_timed*> timed;
+    m_simc->m_timed_events->get_entries( timed );
+    std::stable_sort( timed.begin(), timed.end(), notified_earlier );
+    for( std::size_t i = 0; i < timed.size(); ++i ) {
+        if( timed[i]->event() != 0 )
+            pending.push_back( timed[i]->event() );
+    }
+
+    for( std::size_t i = 0; i < pending.size(); ++i ) {
+        sc_event* e = pending[i];
+        if( !e->in_hierarchy() ) {
+            ++m_dropped;
+            continue;
+        }
+        if( object_manager->find_event( e->name() ) != e )
+            continue; // kernel event
+        notification n;
+        n.event_name = e->name();
+        n.delta = ( e->m_notify_type == sc_event::DELTA );
+        n.time = n.delta ? m_time : e->m_timed->notify_time().value();
+        m_events.push_back( n );
+    }
+
+    save_waits( sc_get_top_level_objects( m_simc ) );
+}
+
+// count the processes waiting for anything but their static sensitivity,
+// which start over without their wait
+
+void
+sc_checkpoint::save_waits( const std::vector<sc_object*>& objects )
+{
+    for( std::size_t i = 0; i < objects.size(); ++i ) {
+        sc_process_b* process_p = dynamic_cast<sc_process_b*>( objects[i] );
+        if( process_p && !process_p->terminated()
+            && process_p->m_trigger_type != sc_process_b::STATIC ) {
+            if( m_waiting++ == 0 )
+                m_waiting_name = process_p->name();
+        }
+        save_waits( objects[i]->get_child_objects() );
+    }
+}
+
+// cancel the notifications issued during elaboration
+
+void
+sc_checkpoint::cancel_pending_events()
+{
+    while( sc_event_timed* et = m_simc->m_timed_events->top() ) {
+        if( et->event() != 0 )
+            et->event()->cancel();
+        else
+            delete m_simc->m_timed_events->extract_top();
+    }
+    std::vector<sc_event*> delta_events( m_simc->m_delta_events );
+    for( std::size_t i = 0; i < delta_events.size(); ++i )
+        delta_events[i]->cancel();
+}
+
+// ----------------------------------------------------------------------------
+
+void
+sc_checkpoint_save( const char* file_name )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    sc_status status = simc_p->get_status();
+    if( status != SC_PAUSED && status != SC_STOPPED ) {
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_FAILED_,
+                         "the simulation has to be paused to be saved" );
+        return;
+    }
+    sc_checkpoint checkpoint( simc_p );
+    checkpoint.save( file_name );
+}
+
+void
+sc_checkpoint_restore( const char* file_name )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if( simc_p->m_start_of_simulation_called ) {
+        SC_REPORT_WARNING( SC_ID_CHECKPOINT_RESTORE_AFTER_START_, file_name );
+        return;
+    }
+    sc_checkpoint* checkpoint_p = new sc_checkpoint( simc_p );
+    if( !checkpoint_p->load( file_name ) ) {
+        delete checkpoint_p;
+        return;
+    }
+    delete simc_p->m_checkpoint_p;
+    simc_p->m_checkpoint_p = checkpoint_p;
+}
+
+bool
+sc_checkpoint_restored()
+{
+    return sc_get_curr_simcontext()->m_checkpoint_restored;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,341 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_checkpoint.h -- Checkpoint and restore of the simulation state.
+
+  sc_checkpoint_save() writes the state of a paused simulation to a file:
+  the simulation time, the delta count, the pending notifications of the
+  named events and the state of each object of the hierarchy, as saved by
+  its sc_object::checkpoint_state() hook. The signals, buffers, clocks and
+  FIFOs of the library implement the hook, models implement it for their
+  own state, e.g. the registers and memories of a virtual platform.
+
+  sc_checkpoint_restore() reads such a file before the simulation starts
+  in a fresh process, which elaborates the same hierarchy. After the
+  start_of_simulation callbacks, the simulation time and the delta count
+  are set, the objects restore their state through their hooks and the
+  events are notified as they were pending, so the simulation continues
+  where the checkpoint was taken.
+
+  The stacks of the thread processes are not part of a checkpoint, since
+  they hold addresses of the process that took it. All processes start
+  over at the restored time, as they start at time zero otherwise, and
+  find the state of their modules as saved; sc_checkpoint_restored() tells
+  them that they resume a checkpoint. The notifications of the kernel
+  events, e.g. the timeouts of wait(t), are dropped with the stacks, with
+  a warning if a process waits for a timeout or a dynamic event when the
+  checkpoint is taken; those of unnamed events cannot be matched and are
+  dropped with a warning as well. The file stores the values as they are
+  in memory and is read by the same build of the model on the same host
+  type.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_CHECKPOINT_H_INCLUDED_
+#define SC_CHECKPOINT_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/kernel/sc_time.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sc_dt {
+
+class sc_logic;
+class sc_signed;
+class sc_unsigned;
+class sc_int_base;
+class sc_uint_base;
+class sc_bv_base;
+class sc_lv_base;
+template< int W > class sc_int;
+template< int W > class sc_uint;
+template< int W > class sc_bigint;
+template< int W > class sc_biguint;
+template< int W > class sc_bv;
+template< int W > class sc_lv;
+
+} // namespace sc_dt
+
+namespace sc_core {
+
+class sc_event;
+class sc_event_timed;
+class sc_object;
+class sc_simcontext;
+template< typename T > struct sc_checkpoint_traits;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_checkpoint_archive
+//
+//  Saves or restores the state of an object in checkpoint_state().
+// ----------------------------------------------------------------------------
+
+class SC_API sc_checkpoint_archive
+{
+    friend class sc_checkpoint;
+    friend struct sc_checkpoint_traits<std::string>;
+
+public:
+
+    bool saving() const    { return m_saving; }
+    bool restoring() const { return !m_saving; }
+
+    // was a restored record shorter than the values read from it?
+    bool failed() const    { return m_failed; }
+
+    // save or restore a value, see sc_checkpoint_traits
+    template< typename T >
+    void io( T& value );
+
+    // save or restore n bytes as they are in memory
+    void io_bytes( void* p, std::size_t n );
+
+    // called for values without sc_checkpoint_traits
+    void unsupported();
+
+private:
+
+    sc_checkpoint_archive();
+    explicit sc_checkpoint_archive( const std::string& data );
+
+private:
+    bool        m_saving;
+    bool        m_failed;
+    int         m_unsupported; // values without sc_checkpoint_traits.
+    std::string m_data;
+    std::size_t m_pos;         // next byte to restore.
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_checkpoint_traits
+//
+//  How a value of type T is saved and restored, specialize for own types.
+//  The value is left alone, and a warning is issued, for other types;
+//  containers check supported before they save their size.
+// ----------------------------------------------------------------------------
+
+template< typename T >
+struct sc_checkpoint_traits
+{
+    enum { supported = 0 };
+
+    static void io( sc_checkpoint_archive& ar, T& )
+        { ar.unsupported(); }
+};
+
+// values saved as they are in memory
+template< typename T >
+struct sc_checkpoint_raw_traits
+{
+    enum { supported = 1 };
+
+    static void io( sc_checkpoint_archive& ar, T& value )
+        { ar.io_bytes( &value, sizeof( T ) ); }
+};
+
+// values saved through the stream operators << and >>
+template< typename T >
+struct sc_checkpoint_stream_traits
+{
+    enum { supported = 1 };
+
+    static void io( sc_checkpoint_archive& ar, T& value )
+    {
+        std::string text;
+        if( ar.saving() ) {
+            std::ostringstream os;
+            os << value;
+            text = os.str();
+        }
+        ar.io( text );
+        if( ar.restoring() && !ar.failed() ) {
+            std::istringstream is( text );
+            is >> value;
+        }
+    }
+};
+
+#define SC_CHECKPOINT_TRAITS_( type, traits ) \
+    template<> struct sc_checkpoint_traits< type > \
+      : public traits< type > {}
+
+SC_CHECKPOINT_TRAITS_( bool, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( char, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( signed char, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( unsigned char, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( short, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( unsigned short, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( int, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( unsigned int, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( long, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( unsigned long, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( long long, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( unsigned long long, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( float, sc_checkpoint_raw_traits );
+SC_CHECKPOINT_TRAITS_( double, sc_checkpoint_raw_traits );
+
+SC_CHECKPOINT_TRAITS_( sc_dt::sc_logic, sc_checkpoint_stream_traits );
+SC_CHECKPOINT_TRAITS_( sc_dt::sc_signed, sc_checkpoint_stream_traits );
+SC_CHECKPOINT_TRAITS_( sc_dt::sc_unsigned, sc_checkpoint_stream_traits );
+SC_CHECKPOINT_TRAITS_( sc_dt::sc_int_base, sc_checkpoint_stream_traits );
+SC_CHECKPOINT_TRAITS_( sc_dt::sc_uint_base, sc_checkpoint_stream_traits );
+SC_CHECKPOINT_TRAITS_( sc_dt::sc_bv_base, sc_checkpoint_stream_traits );
+SC_CHECKPOINT_TRAITS_( sc_dt::sc_lv_base, sc_checkpoint_stream_traits );
+
+#undef SC_CHECKPOINT_TRAITS_
+
+template< int W >
+struct sc_checkpoint_traits< sc_dt::sc_int<W> >
+  : public sc_checkpoint_stream_traits< sc_dt::sc_int<W> > {};
+
+template< int W >
+struct sc_checkpoint_traits< sc_dt::sc_uint<W> >
+  : public sc_checkpoint_stream_traits< sc_dt::sc_uint<W> > {};
+
+template< int W >
+struct sc_checkpoint_traits< sc_dt::sc_bigint<W> >
+  : public sc_checkpoint_stream_traits< sc_dt::sc_bigint<W> > {};
+
+template< int W >
+struct sc_checkpoint_traits< sc_dt::sc_biguint<W> >
+  : public sc_checkpoint_stream_traits< sc_dt::sc_biguint<W> > {};
+
+template< int W >
+struct sc_checkpoint_traits< sc_dt::sc_bv<W> >
+  : public sc_checkpoint_stream_traits< sc_dt::sc_bv<W> > {};
+
+template< int W >
+struct sc_checkpoint_traits< sc_dt::sc_lv<W> >
+  : public sc_checkpoint_stream_traits< sc_dt::sc_lv<W> > {};
+
+template<>
+struct sc_checkpoint_traits< std::string >
+{
+    enum { supported = 1 };
+
+    static void io( sc_checkpoint_archive& ar, std::string& value );
+};
+
+template<>
+struct sc_checkpoint_traits< sc_time >
+{
+    enum { supported = 1 };
+
+    static void io( sc_checkpoint_archive& ar, sc_time& value );
+};
+
+template< typename T >
+inline void
+sc_checkpoint_archive::io( T& value )
+{
+    sc_checkpoint_traits<T>::io( *this, value );
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_checkpoint
+//
+//  A checkpoint read from a file, to be restored when simulation starts.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_checkpoint
+{
+    friend class sc_simcontext;
+
+public:
+
+    explicit sc_checkpoint( sc_simcontext* simc_p );
+
+    // write the state of the simulation context
+    void save( const char* file_name );
+
+    // read a checkpoint for restore(), or report an error
+    bool load( const char* file_name );
+
+private:
+
+    // a pending notification
+    struct notification
+    {
+        std::string  event_name;
+        sc_dt::uint64 time;   // time value, the current time for delta.
+        bool          delta;  // notified for the next delta cycle.
+    };
+
+    void restore();
+
+    void save_objects( const std::vector<sc_object*>& objects );
+    void restore_objects( const std::vector<sc_object*>& objects );
+    void save_events();
+    void save_waits( const std::vector<sc_object*>& objects );
+    void cancel_pending_events();
+
+    static bool notified_earlier( const sc_event_timed*, const sc_event_timed* );
+
+private:
+    sc_simcontext*                     m_simc;
+    double                             m_resolution; // in femtoseconds.
+    sc_dt::uint64                      m_time;
+    sc_dt::uint64                      m_delta_count;
+    sc_dt::uint64                      m_change_stamp;
+    std::map<std::string, std::string> m_objects;   // name -> saved state.
+    std::vector<notification>          m_events;
+    int                                m_unsupported;
+    std::string                        m_unsupported_name;
+    int                                m_dropped;   // unnamed events.
+    int                                m_waiting;   // dynamic waits.
+    std::string                        m_waiting_name;
+    int                                m_restored;  // objects restored.
+
+private:
+    // disabled
+    sc_checkpoint( const sc_checkpoint& );
+    sc_checkpoint& operator = ( const sc_checkpoint& );
+};
+
+// write the state of the paused simulation to a file
+SC_API void sc_checkpoint_save( const char* file_name );
+
+// restore the state of a file when the simulation starts
+SC_API void sc_checkpoint_restore( const char* file_name );
+
+// has the simulation been restored from a checkpoint?
+SC_API bool sc_checkpoint_restored();
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_CHECKPOINT_H_INCLUDED_
+// Taf!
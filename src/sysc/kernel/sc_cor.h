@@ -69,6 +69,10 @@ public:
     // switch stack protection on/off
     virtual void stack_protect( bool /* enable */ ) {}
 
+    // number of stack bytes used so far (0 if unknown)
+    virtual std::size_t stack_usage() const
+        { return 0; }
+
 private:
 
     // disabled
@@ -0,0 +1,424 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_cor_fast.cpp -- Coroutine implementation with a minimal context switch.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#if !defined(_WIN32) && !defined(WIN32) && !defined(SC_USE_PTHREADS) && \
+    defined(SC_USE_FAST_COR)
+
+#include "sysc/kernel/sc_cor_fast.h"
+#include "sysc/kernel/sc_cor_stack.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/utils/sc_report.h"
+
+#if !defined(__x86_64__) && !defined(__aarch64__)
+#   error "SC_USE_FAST_COR is only supported on x86_64 and aarch64"
+#endif
+
+// ----------------------------------------------------------------------------
+//  Context switch
+//
+//  sc_cor_fast_switch( save_sp, new_sp ) pushes the callee-saved registers
+//  (and the floating-point control registers) on the current stack, stores
+//  the stack pointer to *save_sp, switches to new_sp and pops the registers
+//  saved there. A new coroutine starts in sc_cor_fast_start, which calls
+//  the function in the first callee-saved register with the second one as
+//  its argument.
+// ----------------------------------------------------------------------------
+
+extern "C" void sc_cor_fast_switch( void** save_sp, void* new_sp );
+extern "C" void sc_cor_fast_start();
+
+#if defined(__APPLE__)
+#   define SC_COR_FAST_FUNC_(name) \
+        ".globl _" #name "\n" \
+        ".private_extern _" #name "\n" \
+        "_" #name ":\n"
+#   define SC_COR_FAST_END_(name) ""
+#else
+#   if defined(__x86_64__)
+#       define SC_COR_FAST_TYPE_(name) ".type " #name ",@function\n"
+#   else
+#       define SC_COR_FAST_TYPE_(name) ".type " #name ",%function\n"
+#   endif
+#   define SC_COR_FAST_FUNC_(name) \
+        ".globl " #name "\n" \
+        ".hidden " #name "\n" \
+        SC_COR_FAST_TYPE_(name) \
+        #name ":\n"
+#   define SC_COR_FAST_END_(name) ".size " #name ",.-" #name "\n"
+#endif
+
+#if defined(__x86_64__)
+
+// The frame of a suspended coroutine, from its saved stack pointer up:
+// [MXCSR, x87 control word,] r15, r14, r13, r12, rbx, rbp, return address.
+
+#if defined(SC_FAST_COR_NO_FPU_CONTROL)
+#   define SC_COR_FAST_SAVE_FPU_    ""
+#   define SC_COR_FAST_RESTORE_FPU_ ""
+#else
+#   define SC_COR_FAST_SAVE_FPU_ \
+        "    subq    $8, %rsp\n" \
+        "    stmxcsr (%rsp)\n" \
+        "    fnstcw  4(%rsp)\n"
+#   define SC_COR_FAST_RESTORE_FPU_ \
+        "    ldmxcsr (%rsp)\n" \
+        "    fldcw   4(%rsp)\n" \
+        "    addq    $8, %rsp\n"
+#endif
+
+__asm__(
+    ".text\n"
+    ".p2align 4\n"
+    SC_COR_FAST_FUNC_(sc_cor_fast_switch)
+    "    .cfi_startproc\n"
+    "    pushq   %rbp\n"
+    "    pushq   %rbx\n"
+    "    pushq   %r12\n"
+    "    pushq   %r13\n"
+    "    pushq   %r14\n"
+    "    pushq   %r15\n"
+    SC_COR_FAST_SAVE_FPU_
+    "    movq    %rsp, (%rdi)\n"
+    "    movq    %rsi, %rsp\n"
+    SC_COR_FAST_RESTORE_FPU_
+    "    popq    %r15\n"
+    "    popq    %r14\n"
+    "    popq    %r13\n"
+    "    popq    %r12\n"
+    "    popq    %rbx\n"
+    "    popq    %rbp\n"
+    "    ret\n"
+    "    .cfi_endproc\n"
+    SC_COR_FAST_END_(sc_cor_fast_switch)
+    ".p2align 4\n"
+    SC_COR_FAST_FUNC_(sc_cor_fast_start)
+    "    .cfi_startproc\n"
+    "    .cfi_undefined rip\n"
+    "    movq    %r12, %rdi\n"
+    "    callq   *%rbx\n"
+    "    ud2\n"
+    "    .cfi_endproc\n"
+    SC_COR_FAST_END_(sc_cor_fast_start)
+);
+
+#elif defined(__aarch64__)
+
+// The frame of a suspended coroutine, from its saved stack pointer up:
+// x19 - x28, x29 (frame pointer), x30 (return address), d8 - d15, FPCR and
+// padding, 176 bytes.
+
+#if defined(SC_FAST_COR_NO_FPU_CONTROL)
+#   define SC_COR_FAST_SAVE_FPU_    ""
+#   define SC_COR_FAST_RESTORE_FPU_ ""
+#else
+#   define SC_COR_FAST_SAVE_FPU_ \
+        "    mrs     x9, fpcr\n" \
+        "    str     x9, [sp, #160]\n"
+#   define SC_COR_FAST_RESTORE_FPU_ \
+        "    ldr     x9, [sp, #160]\n" \
+        "    msr     fpcr, x9\n"
+#endif
+
+__asm__(
+    ".text\n"
+    ".p2align 4\n"
+    SC_COR_FAST_FUNC_(sc_cor_fast_switch)
+    "    .cfi_startproc\n"
+    "    sub     sp, sp, #176\n"
+    "    stp     x19, x20, [sp, #0]\n"
+    "    stp     x21, x22, [sp, #16]\n"
+    "    stp     x23, x24, [sp, #32]\n"
+    "    stp     x25, x26, [sp, #48]\n"
+    "    stp     x27, x28, [sp, #64]\n"
+    "    stp     x29, x30, [sp, #80]\n"
+    "    stp     d8,  d9,  [sp, #96]\n"
+    "    stp     d10, d11, [sp, #112]\n"
+    "    stp     d12, d13, [sp, #128]\n"
+    "    stp     d14, d15, [sp, #144]\n"
+    SC_COR_FAST_SAVE_FPU_
+    "    mov     x9, sp\n"
+    "    str     x9, [x0]\n"
+    "    mov     sp, x1\n"
+    SC_COR_FAST_RESTORE_FPU_
+    "    ldp     x19, x20, [sp, #0]\n"
+    "    ldp     x21, x22, [sp, #16]\n"
+    "    ldp     x23, x24, [sp, #32]\n"
+    "    ldp     x25, x26, [sp, #48]\n"
+    "    ldp     x27, x28, [sp, #64]\n"
+    "    ldp     x29, x30, [sp, #80]\n"
+    "    ldp     d8,  d9,  [sp, #96]\n"
+    "    ldp     d10, d11, [sp, #112]\n"
+    "    ldp     d12, d13, [sp, #128]\n"
+    "    ldp     d14, d15, [sp, #144]\n"
+    "    add     sp, sp, #176\n"
+    "    ret\n"
+    "    .cfi_endproc\n"
+    SC_COR_FAST_END_(sc_cor_fast_switch)
+    ".p2align 4\n"
+    SC_COR_FAST_FUNC_(sc_cor_fast_start)
+    "    .cfi_startproc\n"
+    "    .cfi_undefined x30\n"
+    "    mov     x0, x20\n"
+    "    blr     x19\n"
+    "    brk     #0\n"
+    "    .cfi_endproc\n"
+    SC_COR_FAST_END_(sc_cor_fast_start)
+);
+
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  File static variables.
+// ----------------------------------------------------------------------------
+
+// main coroutine
+
+static sc_cor_fast main_cor;
+
+// current coroutine
+
+static sc_cor_fast* curr_cor = 0;
+
+// stack pointer of aborted coroutines
+
+static void* abort_sp = 0;
+
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+//  Sanitizer helpers
+// ----------------------------------------------------------------------------
+
+static void __sanitizer_start_switch_fiber(void** fake, void* stack_base,
+    size_t size) __attribute__((weakref("__sanitizer_start_switch_fiber")));
+static void __sanitizer_finish_switch_fiber(void* fake, void** stack_base,
+    size_t* size) __attribute__((weakref("__sanitizer_finish_switch_fiber")));
+
+static void __sanitizer_start_switch_cor_fast( sc_cor_fast* next ) {
+    if (&__sanitizer_start_switch_fiber != NULL) {
+        __sanitizer_start_switch_fiber( NULL, next->m_stack,
+                                        next->m_stack_size );
+    }
+}
+
+static void __sanitizer_finish_switch_cor_fast() {
+    if (&__sanitizer_finish_switch_fiber != NULL) {
+        __sanitizer_finish_switch_fiber( NULL, NULL, NULL );
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// first function executed by a new coroutine
+
+extern "C" void
+sc_cor_fast_entry( sc_cor_fast* cor )
+{
+    __sanitizer_finish_switch_cor_fast();
+    // invoke the user function
+    (*cor->m_fn)( cor->m_arg );
+    // not reached
+}
+
+// build the frame, from which sc_cor_fast_switch() starts a new coroutine
+
+static void*
+sc_cor_fast_frame( void* stack_top, sc_cor_fast* cor )
+{
+    typedef std::size_t word;
+    word entry = reinterpret_cast<word>( &sc_cor_fast_entry );
+    word start = reinterpret_cast<word>( &sc_cor_fast_start );
+
+#if defined(__x86_64__)
+    word* sp = static_cast<word*>( stack_top );
+    *--sp = 0;                                // alignment
+    *--sp = 0;                                // alignment
+    *--sp = start;                            // return address
+    *--sp = 0;                                // rbp
+    *--sp = entry;                            // rbx
+    *--sp = reinterpret_cast<word>( cor );    // r12
+    *--sp = 0;                                // r13
+    *--sp = 0;                                // r14
+    *--sp = 0;                                // r15
+#   if !defined(SC_FAST_COR_NO_FPU_CONTROL)
+        unsigned int   mxcsr;
+        unsigned short fpucw;
+        __asm__ __volatile__( "stmxcsr %0" : "=m" (mxcsr) );
+        __asm__ __volatile__( "fnstcw %0" : "=m" (fpucw) );
+        *--sp = static_cast<word>( mxcsr ) | ( static_cast<word>( fpucw ) << 32 );
+#   endif
+#elif defined(__aarch64__)
+    word* sp = static_cast<word*>( stack_top ) - 22;
+    for( int i = 0; i < 22; ++i )
+        sp[i] = 0;
+    sp[0]  = entry;                           // x19
+    sp[1]  = reinterpret_cast<word>( cor );   // x20
+    sp[11] = start;                           // x30
+#   if !defined(SC_FAST_COR_NO_FPU_CONTROL)
+        word fpcr;
+        __asm__ __volatile__( "mrs %0, fpcr" : "=r" (fpcr) );
+        sp[20] = fpcr;
+#   endif
+#endif
+    return sp;
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_cor_fast
+//
+//  Coroutine class implemented with a minimal context switch.
+// ----------------------------------------------------------------------------
+
+sc_cor_fast::~sc_cor_fast()
+{
+    sc_cor_stack_free( m_stack, m_stack_size );
+}
+
+// switch stack protection on/off
+
+void
+sc_cor_fast::stack_protect( bool enable )
+{
+    sc_cor_stack_protect( m_stack, m_stack_size, enable );
+}
+
+// number of stack bytes touched so far
+
+std::size_t
+sc_cor_fast::stack_usage() const
+{
+    return sc_cor_stack_usage( m_stack, m_stack_size );
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_cor_pkg_fast
+//
+//  Coroutine package class implemented with a minimal context switch.
+// ----------------------------------------------------------------------------
+
+int sc_cor_pkg_fast::instance_count = 0;
+
+// constructor
+
+sc_cor_pkg_fast::sc_cor_pkg_fast( sc_simcontext* simc )
+: sc_cor_pkg( simc )
+{
+    if( ++ instance_count == 1 ) {
+	// initialize the current coroutine
+	sc_assert( curr_cor == 0 );
+	curr_cor = &main_cor;
+	sc_cor_stack_pool_open();
+    }
+}
+
+
+// destructor
+
+sc_cor_pkg_fast::~sc_cor_pkg_fast()
+{
+    if( -- instance_count == 0 ) {
+	// cleanup the current coroutine
+	curr_cor = 0;
+	sc_cor_stack_pool_close();
+    }
+}
+
+
+// create a new coroutine
+
+sc_cor*
+sc_cor_pkg_fast::create( std::size_t stack_size, sc_cor_fn* fn, void* arg )
+{
+    sc_cor_fast* cor = new sc_cor_fast();
+    cor->m_pkg = this;
+    cor->m_stack_size = stack_size;
+    cor->m_fn = fn;
+    cor->m_arg = arg;
+
+    void* aligned_sp = sc_cor_stack_alloc( &cor->m_stack, &cor->m_stack_size );
+    if( aligned_sp == NULL )
+    {
+        SC_REPORT_ERROR( SC_ID_STACK_SETUP_FAILED_
+                       , "failed to allocate stack memory" );
+        sc_abort();
+    }
+    cor->m_sp = sc_cor_fast_frame(
+        static_cast<char*>( aligned_sp ) + cor->m_stack_size, cor );
+    return cor;
+}
+
+
+// yield to the next coroutine
+
+void
+sc_cor_pkg_fast::yield( sc_cor* next_cor )
+{
+    sc_cor_fast* new_cor = static_cast<sc_cor_fast*>( next_cor );
+    sc_cor_fast* old_cor = curr_cor;
+    curr_cor = new_cor;
+    __sanitizer_start_switch_cor_fast( new_cor );
+    sc_cor_fast_switch( &old_cor->m_sp, new_cor->m_sp );
+    __sanitizer_finish_switch_cor_fast();
+}
+
+
+// abort the current coroutine (and resume the next coroutine)
+
+void
+sc_cor_pkg_fast::abort( sc_cor* next_cor )
+{
+    sc_cor_fast* new_cor = static_cast<sc_cor_fast*>( next_cor );
+    curr_cor = new_cor;
+    sc_cor_fast_switch( &abort_sp, new_cor->m_sp );
+}
+
+
+// get the main coroutine
+
+sc_cor*
+sc_cor_pkg_fast::get_main()
+{
+    return &main_cor;
+}
+
+} // namespace sc_core
+
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
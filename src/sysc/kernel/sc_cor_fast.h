@@ -0,0 +1,146 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_cor_fast.h -- Coroutine implementation with a minimal context switch.
+
+  The context switch saves the callee-saved registers and the stack pointer
+  only. Unless SC_FAST_COR_NO_FPU_CONTROL is defined, it also preserves the
+  floating-point control registers (x87 control word and MXCSR on x86_64,
+  FPCR on aarch64). Selected with SC_USE_FAST_COR, for x86_64 and aarch64.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_COR_FAST_H_INCLUDED_
+#define SC_COR_FAST_H_INCLUDED_
+
+#if !defined(_WIN32) && !defined(WIN32) && !defined(WIN64) && \
+    !defined(SC_USE_PTHREADS) && defined(SC_USE_FAST_COR)
+
+#include "sysc/kernel/sc_cor.h"
+
+namespace sc_core {
+
+class sc_cor_pkg_fast;
+typedef sc_cor_pkg_fast sc_cor_pkg_t;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_cor_fast
+//
+//  Coroutine class implemented with a minimal context switch.
+// ----------------------------------------------------------------------------
+
+class sc_cor_fast
+: public sc_cor
+{
+public:
+
+    // constructor
+    sc_cor_fast()
+	: m_stack_size( 0 ), m_stack( 0 ), m_sp( 0 ), m_fn( 0 ), m_arg( 0 ),
+	  m_pkg( 0 )
+	{}
+
+    // destructor
+    virtual ~sc_cor_fast();
+
+    // switch stack protection on/off
+    virtual void stack_protect( bool enable );
+
+    // number of stack bytes touched so far
+    virtual std::size_t stack_usage() const;
+
+public:
+
+    std::size_t      m_stack_size;  // stack size
+    void*            m_stack;       // stack
+    void*            m_sp;          // saved stack pointer
+
+    sc_cor_fn*       m_fn;          // function to run
+    void*            m_arg;         // its argument
+
+    sc_cor_pkg_fast* m_pkg;         // the creating coroutine package
+
+private:
+
+    // disabled
+    sc_cor_fast( const sc_cor_fast& );
+    sc_cor_fast& operator = ( const sc_cor_fast& );
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_cor_pkg_fast
+//
+//  Coroutine package class implemented with a minimal context switch.
+// ----------------------------------------------------------------------------
+
+class sc_cor_pkg_fast
+: public sc_cor_pkg
+{
+public:
+
+    // constructor
+    sc_cor_pkg_fast( sc_simcontext* simc );
+
+    // destructor
+    virtual ~sc_cor_pkg_fast();
+
+    // create a new coroutine
+    virtual sc_cor* create( std::size_t stack_size, sc_cor_fn* fn, void* arg );
+
+    // yield to the next coroutine
+    virtual void yield( sc_cor* next_cor );
+
+    // abort the current coroutine (and resume the next coroutine)
+    virtual void abort( sc_cor* next_cor );
+
+    // get the main coroutine
+    virtual sc_cor* get_main();
+
+private:
+
+    static int instance_count;
+
+private:
+
+    // disabled
+    sc_cor_pkg_fast();
+    sc_cor_pkg_fast( const sc_cor_pkg_fast& );
+    sc_cor_pkg_fast& operator = ( const sc_cor_pkg_fast& );
+};
+
+} // namespace sc_core
+
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_COR_FAST_H_INCLUDED_
+// Taf!
@@ -26,17 +26,11 @@
  CHANGE LOG APPEARS AT THE END OF THE FILE
  *****************************************************************************/
 
-#if !defined(_WIN32) && !defined(WIN32) && !defined(SC_USE_PTHREADS)
-
-#include <unistd.h>
-#include <sys/mman.h>
-#include <sys/types.h>
-#include <cerrno>
-#include <cstring>
-#include <cstdlib>
-#include <sstream>
+#if !defined(_WIN32) && !defined(WIN32) && !defined(SC_USE_PTHREADS) && \
+    !defined(SC_USE_FAST_COR)
 
 #include "sysc/kernel/sc_cor_qt.h"
+#include "sysc/kernel/sc_cor_stack.h"
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/utils/sc_report.h"
 
@@ -80,22 +74,6 @@ static void __sanitizer_finish_switch_cor_qt() {
 
 // ----------------------------------------------------------------------------
 
-static std::size_t sc_pagesize()
-{
-    static std::size_t pagesize = 0;
-
-    if( pagesize == 0 ) {
-#     if defined(__ppc__)
-        pagesize = getpagesize();
-#     else
-        pagesize = sysconf( _SC_PAGESIZE );
-#     endif
-    }
-
-    sc_assert( pagesize != 0 );
-    return pagesize;
-}
-
 // ----------------------------------------------------------------------------
 //  CLASS : sc_cor_qt
 //
@@ -104,13 +82,7 @@ static std::size_t sc_pagesize()
 
 sc_cor_qt::~sc_cor_qt()
 {
-#ifdef SC_LEGACY_MEM_MGMT
-    std::free( m_stack );
-#else
-    if ( m_stack ) {
-        ::munmap( m_stack, m_stack_size );
-    }
-#endif
+    sc_cor_stack_free( m_stack, m_stack_size );
 }
 
 // switch stack protection on/off
@@ -118,61 +90,15 @@ sc_cor_qt::~sc_cor_qt()
 void
 sc_cor_qt::stack_protect( bool enable )
 {
-    // Code needs to be tested on HP-UX and disabled if it doesn't work there
-    // Code still needs to be ported to WIN32
-
-    const std::size_t pagesize = sc_pagesize();
-    sc_assert( m_stack_size > ( 2 * pagesize ) );
-
-    std::size_t sp_addr = reinterpret_cast<std::size_t>(m_stack);
-#ifndef SC_HAVE_POSIX_MEMALIGN
-    const std::size_t round_up_mask = pagesize - 1;
-    if( sp_addr & round_up_mask ) { // misaligned allocation
-        sp_addr = (sp_addr + round_up_mask) & ~round_up_mask;
-    }
-#endif // SC_HAVE_POSIX_MEMALIGN
-
-#ifdef QUICKTHREADS_GROW_DOWN
-    // Stacks grow from high address down to low address
-    caddr_t redzone = caddr_t( sp_addr );
-#else
-    // Stacks grow from low address up to high address
-    caddr_t redzone = caddr_t( sp_addr + m_stack_size - pagesize );
-#endif
-
-    int ret;
-
-    // Enable the red zone at the end of the stack so that references within
-    // it will cause an interrupt.
-
-    if( enable ) {
-        ret = mprotect( redzone, pagesize - 1, PROT_NONE );
-    }
-
-    // Revert the red zone to normal memory usage.
+    sc_cor_stack_protect( m_stack, m_stack_size, enable );
+}
 
-    else {
-        ret = mprotect( redzone, pagesize - 1, PROT_READ | PROT_WRITE );
-    }
+// number of stack bytes touched so far
 
-    if( ret != 0 ) // ignore mprotect error with warning
-    {
-        static bool mprotect_fail_warned_once = false;
-        if( mprotect_fail_warned_once == false )
-        {
-            mprotect_fail_warned_once = true;
-
-            int mprotect_errno = errno;
-            std::stringstream sstr;
-            sstr << "unsuccessful stack protection ignored: "
-                 << std::strerror(mprotect_errno)
-                 << ", address=0x" << std::hex << redzone
-                 << ", enable=" << std::boolalpha << enable;
-
-            SC_REPORT_WARNING( SC_ID_STACK_SETUP_FAILED_
-                             , sstr.str().c_str() );
-        }
-    }
+std::size_t
+sc_cor_qt::stack_usage() const
+{
+    return sc_cor_stack_usage( m_stack, m_stack_size );
 }
 
 
@@ -184,46 +110,6 @@ sc_cor_qt::stack_protect( bool enable )
 
 int sc_cor_pkg_qt::instance_count = 0;
 
-// support functions
-
-// allocate aligned stack memory
-static inline void*
-stack_alloc( void** buf, std::size_t* stack_size )
-{
-    const std::size_t alignment     = sc_pagesize();
-    const std::size_t round_up_mask = alignment - 1;
-    sc_assert( 0 == ( alignment & round_up_mask ) ); // power of 2
-    sc_assert( buf );
-
-    // round up to multiple of alignment
-    *stack_size = (*stack_size + round_up_mask) & ~round_up_mask;
-
-#ifdef SC_LEGACY_MEM_MGMT
-    #ifdef SC_HAVE_POSIX_MEMALIGN
-        if( 0 != posix_memalign( buf, alignment, *stack_size ) ) {
-            *buf = NULL; // allocation failed
-        }
-        return *buf;
-    #endif
-    *buf = std::malloc( *stack_size );
-    std::size_t sp_addr = reinterpret_cast<std::size_t>( *buf );
-    if( sp_addr & round_up_mask ) // misaligned allocation
-    {
-        sc_assert( *stack_size > (alignment * 2) );
-        sp_addr = (sp_addr + round_up_mask) & ~round_up_mask;
-        *stack_size -= alignment;
-    }
-    return reinterpret_cast<void*>( sp_addr );
-#else
-    *buf = ::mmap( NULL, *stack_size, PROT_READ | PROT_WRITE,
-                   MAP_PRIVATE | MAP_ANON, -1, 0 );
-    if ( *buf == MAP_FAILED ) {
-        *buf = NULL;
-    }
-    return *buf;
-#endif
-}
-
 // constructor
 
 sc_cor_pkg_qt::sc_cor_pkg_qt( sc_simcontext* simc )
@@ -233,6 +119,7 @@ sc_cor_pkg_qt::sc_cor_pkg_qt( sc_simcontext* simc )
 	// initialize the current coroutine
 	sc_assert( curr_cor == 0 );
 	curr_cor = &main_cor;
+	sc_cor_stack_pool_open();
     }
 }
 
@@ -244,6 +131,7 @@ sc_cor_pkg_qt::~sc_cor_pkg_qt()
     if( -- instance_count == 0 ) {
 	// cleanup the current coroutine
 	curr_cor = 0;
+	sc_cor_stack_pool_close();
     }
 }
 
@@ -267,7 +155,7 @@ sc_cor_pkg_qt::create( std::size_t stack_size, sc_cor_fn* fn, void* arg )
     cor->m_pkg = this;
     cor->m_stack_size = stack_size;
 
-    void* aligned_sp = stack_alloc( &cor->m_stack, &cor->m_stack_size );
+    void* aligned_sp = sc_cor_stack_alloc( &cor->m_stack, &cor->m_stack_size );
     if( aligned_sp == NULL )
     {
         SC_REPORT_ERROR( SC_ID_STACK_SETUP_FAILED_
@@ -31,7 +31,8 @@
 #define SC_COR_QT_H
 
 
-#if !defined(_WIN32) && !defined(WIN32) && !defined(WIN64)  && !defined(SC_USE_PTHREADS)
+#if !defined(_WIN32) && !defined(WIN32) && !defined(WIN64)  && !defined(SC_USE_PTHREADS) && \
+    !defined(SC_USE_FAST_COR)
 
 #include "sysc/kernel/sc_cor.h"
 #include "sysc/packages/qt/qt.h"
@@ -63,6 +64,9 @@ public:
     // switch stack protection on/off
     virtual void stack_protect( bool enable );
 
+    // number of stack bytes touched so far
+    virtual std::size_t stack_usage() const;
+
 public:
 
     std::size_t    m_stack_size;  // stack size
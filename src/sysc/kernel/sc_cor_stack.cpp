@@ -0,0 +1,333 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_cor_stack.cpp -- Stack memory of the Unix coroutine packages.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#if !defined(_WIN32) && !defined(WIN32) && !defined(SC_USE_PTHREADS)
+
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include "sysc/kernel/sc_cor_stack.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/utils/sc_report.h"
+
+#if defined(SC_USE_FAST_COR)
+#   define SC_COR_STACK_GROW_DOWN_ // x86_64 and aarch64
+#else
+#   include "sysc/packages/qt/qt.h"
+#   if defined(QUICKTHREADS_GROW_DOWN)
+#       define SC_COR_STACK_GROW_DOWN_
+#   endif
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  File static variables.
+// ----------------------------------------------------------------------------
+
+#ifndef SC_LEGACY_MEM_MGMT
+// stacks of destroyed coroutines, by size, for reuse by new ones.
+
+typedef std::map< std::size_t, std::vector<void*> > sc_stack_pool;
+
+static sc_stack_pool* stack_pool = 0;
+static int            stack_pool_holders = 0;
+#endif
+
+// ----------------------------------------------------------------------------
+
+static std::size_t sc_pagesize()
+{
+    static std::size_t pagesize = 0;
+
+    if( pagesize == 0 ) {
+#     if defined(__ppc__)
+        pagesize = getpagesize();
+#     else
+        pagesize = sysconf( _SC_PAGESIZE );
+#     endif
+    }
+
+    sc_assert( pagesize != 0 );
+    return pagesize;
+}
+
+// switch the red zone at the end of a stack on/off
+
+static void
+stack_redzone( void* stack, std::size_t stack_size, bool enable )
+{
+    // Code needs to be tested on HP-UX and disabled if it doesn't work there
+    // Code still needs to be ported to WIN32
+
+    const std::size_t pagesize = sc_pagesize();
+    sc_assert( stack_size > ( 2 * pagesize ) );
+
+    std::size_t sp_addr = reinterpret_cast<std::size_t>(stack);
+#ifndef SC_HAVE_POSIX_MEMALIGN
+    const std::size_t round_up_mask = pagesize - 1;
+    if( sp_addr & round_up_mask ) { // misaligned allocation
+        sp_addr = (sp_addr + round_up_mask) & ~round_up_mask;
+    }
+#endif // SC_HAVE_POSIX_MEMALIGN
+
+#ifdef SC_COR_STACK_GROW_DOWN_
+    // Stacks grow from high address down to low address
+    caddr_t redzone = caddr_t( sp_addr );
+#else
+    // Stacks grow from low address up to high address
+    caddr_t redzone = caddr_t( sp_addr + stack_size - pagesize );
+#endif
+
+    int ret;
+
+    // Enable the red zone at the end of the stack so that references within
+    // it will cause an interrupt.
+
+    if( enable ) {
+        ret = mprotect( redzone, pagesize - 1, PROT_NONE );
+    }
+
+    // Revert the red zone to normal memory usage.
+
+    else {
+        ret = mprotect( redzone, pagesize - 1, PROT_READ | PROT_WRITE );
+    }
+
+    if( ret != 0 ) // ignore mprotect error with warning
+    {
+        static bool mprotect_fail_warned_once = false;
+        if( mprotect_fail_warned_once == false )
+        {
+            mprotect_fail_warned_once = true;
+
+            int mprotect_errno = errno;
+            std::stringstream sstr;
+            sstr << "unsuccessful stack protection ignored: "
+                 << std::strerror(mprotect_errno)
+                 << ", address=0x" << std::hex << redzone
+                 << ", enable=" << std::boolalpha << enable;
+
+            SC_REPORT_WARNING( SC_ID_STACK_SETUP_FAILED_
+                             , sstr.str().c_str() );
+        }
+    }
+}
+
+// allocate aligned stack memory
+
+void*
+sc_cor_stack_alloc( void** buf, std::size_t* stack_size )
+{
+    const std::size_t alignment     = sc_pagesize();
+    const std::size_t round_up_mask = alignment - 1;
+    sc_assert( 0 == ( alignment & round_up_mask ) ); // power of 2
+    sc_assert( buf );
+
+    // round up to multiple of alignment
+    *stack_size = (*stack_size + round_up_mask) & ~round_up_mask;
+
+#ifdef SC_LEGACY_MEM_MGMT
+    #ifdef SC_HAVE_POSIX_MEMALIGN
+        if( 0 != posix_memalign( buf, alignment, *stack_size ) ) {
+            *buf = NULL; // allocation failed
+        }
+        return *buf;
+    #endif
+    *buf = std::malloc( *stack_size );
+    std::size_t sp_addr = reinterpret_cast<std::size_t>( *buf );
+    if( sp_addr & round_up_mask ) // misaligned allocation
+    {
+        sc_assert( *stack_size > (alignment * 2) );
+        sp_addr = (sp_addr + round_up_mask) & ~round_up_mask;
+        *stack_size -= alignment;
+    }
+    return reinterpret_cast<void*>( sp_addr );
+#else
+    if( stack_pool != 0 ) {
+        sc_stack_pool::iterator it = stack_pool->find( *stack_size );
+        if( it != stack_pool->end() && !it->second.empty() ) {
+            *buf = it->second.back();
+            it->second.pop_back();
+            return *buf;
+        }
+    }
+
+    // only the touched pages of a stack are committed
+#   if defined(MAP_NORESERVE)
+        const int flags = MAP_PRIVATE | MAP_ANON | MAP_NORESERVE;
+#   else
+        const int flags = MAP_PRIVATE | MAP_ANON;
+#   endif
+    *buf = ::mmap( NULL, *stack_size, PROT_READ | PROT_WRITE, flags, -1, 0 );
+    if ( *buf == MAP_FAILED ) {
+        *buf = NULL;
+    } else {
+        stack_redzone( *buf, *stack_size, true );
+    }
+    return *buf;
+#endif
+}
+
+// return a stack to the pool; its pages are given back to the system, the
+// address range stays reserved.
+
+void
+#ifdef SC_LEGACY_MEM_MGMT
+sc_cor_stack_free( void* buf, std::size_t )
+{
+    std::free( buf );
+#else
+sc_cor_stack_free( void* buf, std::size_t stack_size )
+{
+    if( buf == 0 )
+        return;
+    if( stack_pool == 0 ) {
+        ::munmap( buf, stack_size );
+        return;
+    }
+#   if defined(MADV_DONTNEED)
+        const std::size_t pagesize = sc_pagesize();
+#     ifdef SC_COR_STACK_GROW_DOWN_
+        void* pages = static_cast<char*>( buf ) + pagesize;
+#     else
+        void* pages = buf;
+#     endif
+        ::madvise( pages, stack_size - pagesize, MADV_DONTNEED );
+#   endif
+    (*stack_pool)[stack_size].push_back( buf );
+#endif
+}
+
+// switch stack protection on/off
+// (the red zone of a mapped stack is set up once by sc_cor_stack_alloc()
+// and stays in place while the stack is pooled)
+
+void
+#ifdef SC_LEGACY_MEM_MGMT
+sc_cor_stack_protect( void* buf, std::size_t stack_size, bool enable )
+{
+    stack_redzone( buf, stack_size, enable );
+}
+#else
+sc_cor_stack_protect( void*, std::size_t, bool /* enable */ )
+{}
+#endif
+
+//------------------------------------------------------------------------------
+//"sc_cor_stack_usage"
+//
+// This function returns the high-water mark of a stack, i.e., the distance
+// between the base of the stack and its farthest page that has been touched.
+// Mapped stacks are committed lazily and pooled stacks are released to the
+// system before reuse, so the pages resident in memory are exactly the ones
+// the coroutine has used. Stacks allocated with malloc report 0.
+//------------------------------------------------------------------------------
+std::size_t
+#if defined(SC_LEGACY_MEM_MGMT)
+sc_cor_stack_usage( void*, std::size_t )
+{
+    return 0;
+}
+#else
+sc_cor_stack_usage( void* buf, std::size_t stack_size )
+{
+    if( buf == 0 )
+        return 0;
+
+    const std::size_t pagesize = sc_pagesize();
+    const std::size_t pages_n  = stack_size / pagesize;
+#   if defined(__linux__)
+        std::vector<unsigned char> resident( pages_n );
+#   else
+        std::vector<char> resident( pages_n );
+#   endif
+    if( ::mincore( buf, stack_size, &resident[0] ) != 0 )
+        return 0;
+
+#   ifdef SC_COR_STACK_GROW_DOWN_
+        std::size_t page_i = 1; // skip the red zone
+        while( page_i < pages_n && !( resident[page_i] & 1 ) )
+            ++page_i;
+        return ( pages_n - page_i ) * pagesize;
+#   else
+        std::size_t page_n = pages_n - 1; // skip the red zone
+        while( page_n > 0 && !( resident[page_n - 1] & 1 ) )
+            --page_n;
+        return page_n * pagesize;
+#   endif
+}
+#endif
+
+void
+sc_cor_stack_pool_open()
+{
+#ifndef SC_LEGACY_MEM_MGMT
+    if( stack_pool_holders++ == 0 )
+        stack_pool = new sc_stack_pool;
+#endif
+}
+
+// unmap the pooled stacks; stacks still in use are unmapped when they are
+// released
+
+void
+sc_cor_stack_pool_close()
+{
+#ifndef SC_LEGACY_MEM_MGMT
+    if( --stack_pool_holders == 0 ) {
+        for( sc_stack_pool::iterator it = stack_pool->begin();
+             it != stack_pool->end(); ++it ) {
+            for( std::size_t i = 0; i < it->second.size(); ++i )
+                ::munmap( it->second[i], it->first );
+        }
+        delete stack_pool;
+        stack_pool = 0;
+    }
+#endif
+}
+
+} // namespace sc_core
+
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,75 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_cor_stack.h -- Stack memory of the Unix coroutine packages.
+
+  Unless SC_LEGACY_MEM_MGMT is defined, stacks are mapped with a red zone
+  at their end and committed lazily. Released stacks are kept in a pool,
+  with their pages given back to the system, while a coroutine package
+  holds it open.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_COR_STACK_H_INCLUDED_
+#define SC_COR_STACK_H_INCLUDED_
+
+#if !defined(_WIN32) && !defined(WIN32) && !defined(SC_USE_PTHREADS)
+
+#include <cstddef>
+
+namespace sc_core {
+
+// allocate a stack of at least *stack_size bytes. *buf and *stack_size
+// receive the allocation and its size; the result is the page aligned
+// start of the stack, or 0 if the allocation failed.
+void* sc_cor_stack_alloc( void** buf, std::size_t* stack_size );
+
+// release a stack allocated by sc_cor_stack_alloc()
+void sc_cor_stack_free( void* buf, std::size_t stack_size );
+
+// switch the red zone of a stack on/off
+void sc_cor_stack_protect( void* buf, std::size_t stack_size, bool enable );
+
+// number of bytes of the stack touched so far, 0 if unknown
+std::size_t sc_cor_stack_usage( void* buf, std::size_t stack_size );
+
+// hold the pool of released stacks open; it is unmapped when the last
+// holder closes it
+void sc_cor_stack_pool_open();
+void sc_cor_stack_pool_close();
+
+} // namespace sc_core
+
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_COR_STACK_H_INCLUDED_
+// Taf!
@@ -0,0 +1,286 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_coroutine.cpp -- Stackless processes based on C++20 coroutines.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_coroutine.h"
+
+#if defined(SC_HAS_COROUTINES_)
+
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/kernel/sc_wait.h"
+
+#include <sstream>
+
+namespace sc_core {
+
+class sc_coroutine_process;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coroutine_host
+//
+//  Process host whose entry function resumes the coroutine process. It is
+//  a separate object, since the process host has to be complete when the
+//  process is constructed.
+// ----------------------------------------------------------------------------
+
+class sc_coroutine_host : public sc_process_host
+{
+public:
+    sc_coroutine_host() : m_process_p( 0 ) {}
+
+    void step();
+
+    sc_coroutine_process* m_process_p;
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coroutine_process
+//
+//  Method process that runs the body of a coroutine process. Each execution
+//  resumes the coroutine frame until its next co_await; the frame is
+//  (re-)created at the start of the process and after a reset.
+// ----------------------------------------------------------------------------
+
+class sc_coroutine_process : public sc_method_process
+{
+    friend class sc_co_wait;
+    friend class sc_coroutine_host;
+
+public:
+
+    sc_coroutine_process( const char* name_p, sc_coroutine_host* host_p,
+                          const sc_coroutine_fn& body_fn,
+                          const sc_spawn_options* opt_p )
+      : sc_method_process( name_p, true,
+                           SC_MAKE_FUNC_PTR( sc_coroutine_host, step ),
+                           host_p, opt_p ),
+        m_body(), m_factory( body_fn ), m_restart( false ), m_wait_n( 0 )
+    {}
+
+    static sc_process_handle create( const char* name_p,
+                                     const sc_coroutine_fn& body_fn,
+                                     const sc_spawn_options* opt_p );
+
+protected:
+
+    virtual ~sc_coroutine_process() {}
+
+    virtual void kill_process(
+        sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
+    virtual void throw_reset( bool async );
+
+    void step();
+
+private:
+    sc_coroutine    m_body;    // current coroutine frame.
+    sc_coroutine_fn m_factory; // creates a new coroutine frame.
+    bool            m_restart; // create a new frame on the next execution.
+    int             m_wait_n;  // static triggers left for co_wait( n ).
+};
+
+void
+sc_coroutine_host::step()
+{
+    m_process_p->step();
+}
+
+//------------------------------------------------------------------------------
+//"sc_coroutine_process::kill_process"
+//
+// This method kills this object instance and releases its coroutine frame.
+// If the process kills itself, the frame is released by step() while the
+// kill exception leaves it.
+//------------------------------------------------------------------------------
+void
+sc_coroutine_process::kill_process( sc_descendant_inclusion_info descendants )
+{
+    sc_method_process::kill_process( descendants );
+    if ( m_state & ps_bit_zombie )
+        m_body.destroy();
+}
+
+//------------------------------------------------------------------------------
+//"sc_coroutine_process::throw_reset"
+//
+// This method resets this object instance. A reset issued via a process
+// handle is not visible in the throw status on the next execution, so it
+// is remembered here.
+//------------------------------------------------------------------------------
+void
+sc_coroutine_process::throw_reset( bool async )
+{
+    if ( async && !m_unwinding && !( m_state & ps_bit_zombie ) )
+        m_restart = true;
+    sc_method_process::throw_reset( async );
+}
+
+//------------------------------------------------------------------------------
+//"sc_coroutine_process::step"
+//
+// This method executes the coroutine process up to its next suspension:
+//   (1) At the start and if the process is in reset a new frame is created,
+//       which starts the body from its beginning.
+//   (2) While waiting for more than one static trigger the body is not
+//       resumed, and the static sensitivity stays in effect.
+//   (3) Once the body returns, the process terminates like a thread.
+//------------------------------------------------------------------------------
+void
+sc_coroutine_process::step()
+{
+    if ( m_restart || !m_body.valid() ||
+         m_throw_status == THROW_SYNC_RESET ||
+         m_throw_status == THROW_ASYNC_RESET )
+    {
+        m_restart = false;
+        m_wait_n = 0;
+        m_body = m_factory();
+    }
+    else if ( m_wait_n > 1 )
+    {
+        --m_wait_n;
+        return;
+    }
+
+    m_wait_n = 0;
+    try {
+        m_body.resume();
+    }
+    catch( ... ) {
+        m_body.destroy();
+        throw;
+    }
+
+    if ( m_body.done() )
+    {
+        m_body.destroy();
+        disconnect_process();
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_co_wait
+//
+//  Awaitable returned by co_wait().
+// ----------------------------------------------------------------------------
+
+void
+sc_co_wait::await_suspend( std::coroutine_handle<> ) const
+{
+    sc_simcontext*        simc_p = sc_get_curr_simcontext();
+    sc_coroutine_process* cp =
+        dynamic_cast<sc_coroutine_process*>( sc_get_current_process_b() );
+    if ( cp == 0 ) {
+        SC_REPORT_ERROR( SC_ID_CO_WAIT_NOT_ALLOWED_, "" );
+        return;
+    }
+
+    switch( m_kind )
+    {
+      case STATIC:
+        break;
+      case CYCLES:
+        if ( m_n <= 0 ) {
+            std::stringstream msg;
+            msg << "n = " << m_n;
+            SC_REPORT_ERROR( SC_ID_WAIT_N_INVALID_, msg.str().c_str() );
+            return;
+        }
+        cp->m_wait_n = m_n;
+        break;
+      case EVENT:
+        next_trigger( *static_cast<const sc_event*>( m_object_p ), simc_p );
+        break;
+      case OR_LIST:
+        next_trigger( *static_cast<const sc_event_or_list*>( m_object_p ),
+                      simc_p );
+        break;
+      case AND_LIST:
+        next_trigger( *static_cast<const sc_event_and_list*>( m_object_p ),
+                      simc_p );
+        break;
+      case TIMEOUT:
+        next_trigger( m_time, simc_p );
+        break;
+      case EVENT_TIMEOUT:
+        next_trigger( m_time, *static_cast<const sc_event*>( m_object_p ),
+                      simc_p );
+        break;
+      case OR_LIST_TIMEOUT:
+        next_trigger( m_time,
+                      *static_cast<const sc_event_or_list*>( m_object_p ),
+                      simc_p );
+        break;
+      case AND_LIST_TIMEOUT:
+        next_trigger( m_time,
+                      *static_cast<const sc_event_and_list*>( m_object_p ),
+                      simc_p );
+        break;
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+//  FUNCTION : sc_create_coroutine_process
+//
+//  Creates a coroutine process.
+// ----------------------------------------------------------------------------
+
+sc_process_handle
+sc_create_coroutine_process( const char* name_p, sc_coroutine_fn body_fn,
+                             const sc_spawn_options* opt_p )
+{
+    return sc_coroutine_process::create( name_p, body_fn, opt_p );
+}
+
+sc_process_handle
+sc_coroutine_process::create( const char* name_p,
+                              const sc_coroutine_fn& body_fn,
+                              const sc_spawn_options* opt_p )
+{
+    sc_coroutine_host*    host_p = new sc_coroutine_host;
+    sc_coroutine_process* process_p = new sc_coroutine_process(
+        name_p ? name_p : sc_gen_unique_name( "coroutine" ),
+        host_p, body_fn, opt_p );
+    host_p->m_process_p = process_p;
+    return process_p->simcontext()->add_method_process( process_p );
+}
+
+} // namespace sc_core
+
+#endif // SC_HAS_COROUTINES_
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,286 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_coroutine.h -- Stackless processes based on C++20 coroutines.
+
+  A coroutine process executes a member function or callable returning
+  sc_coroutine. It behaves like an SC_THREAD, but suspends with
+
+      co_await co_wait( ... );
+
+  instead of wait( ... ), so it does not need a stack of its own. Between
+  two suspensions it is scheduled like an SC_METHOD, and it honours reset
+  specifications, reset(), kill() and the other process control methods:
+
+      SC_MODULE(producer)
+      {
+          SC_CTOR(producer)
+          {
+              SC_COROUTINE(run);
+              sensitive << clk.pos();
+          }
+
+          sc_core::sc_coroutine run()
+          {
+              for( ;; ) {
+                  co_await sc_core::co_wait();
+                  ...
+              }
+          }
+      };
+
+  Only available if the library and the model are compiled for C++20 or
+  later.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_COROUTINE_H_INCLUDED_
+#define SC_COROUTINE_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#if SC_CPLUSPLUS >= 202002L && defined(__cpp_impl_coroutine)
+# define SC_HAS_COROUTINES_ 1
+#endif
+
+#if defined(SC_HAS_COROUTINES_)
+
+#include "sysc/kernel/sc_process_handle.h"
+#include "sysc/kernel/sc_time.h"
+
+#include <coroutine>
+#include <functional>
+#include <utility>
+
+namespace sc_core {
+
+class sc_event;
+class sc_event_and_list;
+class sc_event_or_list;
+class sc_spawn_options;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coroutine
+//
+//  Result type of the body of a coroutine process. Owns the coroutine
+//  frame, which starts suspended and stays around after completion until
+//  it is destroyed by its owner.
+// ----------------------------------------------------------------------------
+
+class sc_coroutine
+{
+public:
+
+    struct promise_type
+    {
+        sc_coroutine get_return_object()
+          { return sc_coroutine( handle_type::from_promise( *this ) ); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+
+        // exceptions, including kill and reset, leave through resume()
+        void unhandled_exception() { throw; }
+    };
+
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    sc_coroutine() : m_handle() {}
+    sc_coroutine( sc_coroutine&& other ) noexcept
+      : m_handle( std::exchange( other.m_handle, handle_type() ) ) {}
+
+    sc_coroutine& operator = ( sc_coroutine&& other ) noexcept
+    {
+        if( this != &other ) {
+            destroy();
+            m_handle = std::exchange( other.m_handle, handle_type() );
+        }
+        return *this;
+    }
+
+    ~sc_coroutine()
+      { destroy(); }
+
+    bool valid() const
+      { return static_cast<bool>( m_handle ); }
+    bool done() const
+      { return m_handle.done(); }
+    void resume() const
+      { m_handle.resume(); }
+
+    void destroy()
+    {
+        if( m_handle ) {
+            m_handle.destroy();
+            m_handle = handle_type();
+        }
+    }
+
+private:
+
+    explicit sc_coroutine( handle_type handle ) : m_handle( handle ) {}
+
+public:
+
+    sc_coroutine( const sc_coroutine& ) = delete;
+    sc_coroutine& operator = ( const sc_coroutine& ) = delete;
+
+private:
+    handle_type m_handle;
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_co_wait
+//
+//  Awaitable returned by co_wait(). Suspending on it sets the dynamic
+//  sensitivity of the coroutine process, like wait() does for a thread.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_co_wait
+{
+public:
+
+    enum wait_kind {
+        STATIC,          // co_wait()
+        CYCLES,          // co_wait( n )
+        EVENT,           // co_wait( e )
+        OR_LIST,         // co_wait( e1 | e2 )
+        AND_LIST,        // co_wait( e1 & e2 )
+        TIMEOUT,         // co_wait( t )
+        EVENT_TIMEOUT,   // co_wait( t, e )
+        OR_LIST_TIMEOUT, // co_wait( t, e1 | e2 )
+        AND_LIST_TIMEOUT // co_wait( t, e1 & e2 )
+    };
+
+    explicit sc_co_wait( wait_kind kind, int n = 1 )
+      : m_kind( kind ), m_n( n ), m_object_p( 0 ), m_time() {}
+    sc_co_wait( wait_kind kind, const void* object_p )
+      : m_kind( kind ), m_n( 1 ), m_object_p( object_p ), m_time() {}
+    sc_co_wait( wait_kind kind, const sc_time& t, const void* object_p = 0 )
+      : m_kind( kind ), m_n( 1 ), m_object_p( object_p ), m_time( t ) {}
+
+    bool await_ready() const noexcept
+      { return false; }
+    void await_suspend( std::coroutine_handle<> ) const;
+    void await_resume() const noexcept
+      {}
+
+private:
+    wait_kind   m_kind;
+    int         m_n;        // number of static triggers to wait for.
+    const void* m_object_p; // event or event list waited for.
+    sc_time     m_time;     // timeout.
+};
+
+inline sc_co_wait co_wait()
+  { return sc_co_wait( sc_co_wait::STATIC ); }
+inline sc_co_wait co_wait( int n )
+  { return sc_co_wait( sc_co_wait::CYCLES, n ); }
+inline sc_co_wait co_wait( const sc_event& e )
+  { return sc_co_wait( sc_co_wait::EVENT, &e ); }
+inline sc_co_wait co_wait( const sc_event_or_list& el )
+  { return sc_co_wait( sc_co_wait::OR_LIST, &el ); }
+inline sc_co_wait co_wait( const sc_event_and_list& el )
+  { return sc_co_wait( sc_co_wait::AND_LIST, &el ); }
+inline sc_co_wait co_wait( const sc_time& t )
+  { return sc_co_wait( sc_co_wait::TIMEOUT, t ); }
+inline sc_co_wait co_wait( double v, sc_time_unit tu )
+  { return sc_co_wait( sc_co_wait::TIMEOUT, sc_time( v, tu ) ); }
+inline sc_co_wait co_wait( const sc_time& t, const sc_event& e )
+  { return sc_co_wait( sc_co_wait::EVENT_TIMEOUT, t, &e ); }
+inline sc_co_wait co_wait( double v, sc_time_unit tu, const sc_event& e )
+  { return sc_co_wait( sc_co_wait::EVENT_TIMEOUT, sc_time( v, tu ), &e ); }
+inline sc_co_wait co_wait( const sc_time& t, const sc_event_or_list& el )
+  { return sc_co_wait( sc_co_wait::OR_LIST_TIMEOUT, t, &el ); }
+inline sc_co_wait co_wait( const sc_time& t, const sc_event_and_list& el )
+  { return sc_co_wait( sc_co_wait::AND_LIST_TIMEOUT, t, &el ); }
+
+
+// ----------------------------------------------------------------------------
+//  FUNCTION : sc_create_coroutine_process
+//
+//  Creates a coroutine process, whose body is created by calling body_fn
+//  at the start of the process and whenever the process is reset.
+// ----------------------------------------------------------------------------
+
+typedef std::function<sc_coroutine()> sc_coroutine_fn;
+
+extern SC_API sc_process_handle
+sc_create_coroutine_process( const char* name_p, sc_coroutine_fn body_fn,
+                             const sc_spawn_options* opt_p = 0 );
+
+template< typename T >
+inline sc_process_handle
+sc_create_coroutine_process( const char* name_p, T* host_p,
+                             sc_coroutine (T::*func_p)(),
+                             const sc_spawn_options* opt_p = 0 )
+{
+    return sc_create_coroutine_process( name_p,
+        [host_p, func_p]() { return (host_p->*func_p)(); }, opt_p );
+}
+
+// spawn a coroutine process from a callable returning sc_coroutine
+
+template< typename F >
+inline sc_process_handle
+sc_spawn_coroutine( F body_fn, const char* name_p = 0,
+                    const sc_spawn_options* opt_p = 0 )
+{
+    return sc_create_coroutine_process( name_p, sc_coroutine_fn( body_fn ),
+                                        opt_p );
+}
+
+} // namespace sc_core
+
+// declare a coroutine process in a module, like SC_THREAD
+
+#define declare_coroutine_process(handle, name, host_tag, func)          \
+    {                                                                     \
+        ::sc_core::sc_process_handle handle =                            \
+            ::sc_core::sc_create_coroutine_process(                      \
+                name, this, &host_tag::func );                            \
+        this->sensitive << handle;                                        \
+        this->sensitive_pos << handle;                                    \
+        this->sensitive_neg << handle;                                    \
+    }
+
+#define SC_COROUTINE(func)                                                    \
+    declare_coroutine_process( func ## _handle,                               \
+                               #func,                                         \
+                               SC_CURRENT_USER_MODULE,                        \
+                               func )
+
+#endif // SC_HAS_COROUTINES_
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_COROUTINE_H_INCLUDED_
+// Taf!
@@ -0,0 +1,362 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_elab_profiler.cpp -- Profile of the elaboration, by module type and phase.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_elab_profiler.h"
+#include "sysc/kernel/sc_kernel_stats.h"
+#include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_simcontext.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <typeinfo>
+
+#if defined(__GNUC__)
+#   include <cxxabi.h>
+#endif
+#if defined(__GLIBC__)
+#   include <malloc.h>
+#endif
+
+namespace sc_core {
+
+namespace {
+
+// name prefix of the modules the kernel instantiates for itself
+const char kernel_module_prefix[] = "$$$$kernel_module$$$$";
+
+bool by_time( const sc_elab_profiler::entry& a,
+              const sc_elab_profiler::entry& b )
+{
+    if ( a.time != b.time )
+        return a.time > b.time;
+    return a.name < b.name;
+}
+
+// bytes allocated from the heap, or zero if not known
+sc_elab_profiler::int64 heap_in_use()
+{
+#if defined(__GLIBC__) && \
+    ( __GLIBC__ > 2 || ( __GLIBC__ == 2 && __GLIBC_MINOR__ >= 33 ) )
+    struct mallinfo2 info = mallinfo2();
+    return static_cast<sc_elab_profiler::int64>( info.uordblks )
+         + static_cast<sc_elab_profiler::int64>( info.hblkhd );
+#elif defined(__GLIBC__)
+    struct mallinfo info = mallinfo();
+    return static_cast<sc_elab_profiler::int64>(
+               static_cast<unsigned>( info.uordblks ) )
+         + static_cast<sc_elab_profiler::int64>(
+               static_cast<unsigned>( info.hblkhd ) );
+#else
+    return 0;
+#endif
+}
+
+// readable name of a type
+std::string type_name( const std::type_info& type )
+{
+#if defined(__GNUC__)
+    int   status = 0;
+    char* name_p = abi::__cxa_demangle( type.name(), 0, 0, &status );
+    if ( name_p )
+    {
+        std::string result( name_p );
+        std::free( name_p );
+        return result;
+    }
+#endif
+    return type.name();
+}
+
+void print_json_string( ::std::ostream& os, const std::string& s )
+{
+    os << '"';
+    for ( std::size_t i = 0; i < s.size(); ++i )
+    {
+        if ( s[i] == '"' || s[i] == '\\' )
+            os << '\\';
+        os << s[i];
+    }
+    os << '"';
+}
+
+void print_json_entries( ::std::ostream& os,
+                         const std::vector<sc_elab_profiler::entry>& entries,
+                         const char* count_name )
+{
+    os << "[";
+    for ( std::size_t i = 0; i < entries.size(); ++i )
+    {
+        os << ( i ? ",\n    " : "\n    " ) << "{ \"name\": ";
+        print_json_string( os, entries[i].name );
+        os << ", \"" << count_name << "\": " << entries[i].count
+           << ", \"time\": " << entries[i].time
+           << ", \"bytes\": " << entries[i].bytes << " }";
+    }
+    os << ( entries.empty() ? "]" : "\n  ]" );
+}
+
+const char* construction_phase = "construction";
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_elab_profiler
+//
+//  Profile of the elaboration, by module type and phase.
+// ----------------------------------------------------------------------------
+
+sc_elab_profiler::sc_elab_profiler()
+  : m_enabled( false ), m_dump( 0 ), m_modules(), m_phase_stack(),
+    m_types(), m_phases()
+{
+    const char* env = std::getenv( "SC_ELAB_PROFILE" );
+    if ( env && *env && std::strcmp( env, "0" ) != 0 )
+    {
+        m_enabled = true;
+        m_dump = std::strcmp( env, "json" ) == 0 ? 2 : 1;
+    }
+}
+
+bool
+sc_elab_profiler::heap_measured()
+{
+#if defined(__GLIBC__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+sc_elab_profiler::frame
+sc_elab_profiler::begin_frame( std::size_t phase ) const
+{
+    frame f;
+    f.start_bytes = heap_in_use();
+    f.nested_ns = 0;
+    f.nested_bytes = 0;
+    f.phase = phase;
+    f.start_ns = sc_kernel_stats::host_time_ns();
+    return f;
+}
+
+//------------------------------------------------------------------------------
+//"sc_elab_profiler::end_frame"
+//
+// This method pops the innermost frame of the stack and charges the host
+// time and heap growth since its start, less those of the frames nested in
+// it, to the supplied entry. The total is charged to the enclosing frame as
+// nested.
+//------------------------------------------------------------------------------
+void
+sc_elab_profiler::end_frame( std::vector<frame>& stack, entry& e )
+{
+    uint64 now_ns = sc_kernel_stats::host_time_ns();
+    frame  f = stack.back();
+    stack.pop_back();
+
+    uint64 time_ns = now_ns - f.start_ns;
+    int64  bytes = heap_in_use() - f.start_bytes;
+    e.count += 1;
+    e.time += 1e-9 * static_cast<double>( time_ns - f.nested_ns );
+    e.bytes += bytes - f.nested_bytes;
+    if ( !stack.empty() )
+    {
+        stack.back().nested_ns += time_ns;
+        stack.back().nested_bytes += bytes;
+    }
+    else if ( &stack == &m_modules && m_phase_stack.empty() )
+    {
+        // top-level module constructed outside of the other phases
+
+        entry& construction = m_phases[find_phase( construction_phase )];
+        construction.count += 1;
+        construction.time += 1e-9 * static_cast<double>( time_ns );
+        construction.bytes += bytes;
+    }
+}
+
+void
+sc_elab_profiler::module_begin()
+{
+    if ( m_enabled )
+        m_modules.push_back( begin_frame( 0 ) );
+}
+
+void
+sc_elab_profiler::end_module( const sc_module* module_p )
+{
+    if ( !module_p )
+    {
+        // the module was destroyed during its construction
+        m_modules.pop_back();
+        return;
+    }
+    if ( std::strncmp( module_p->basename(), kernel_module_prefix,
+                       sizeof( kernel_module_prefix ) - 1 ) == 0 )
+    {
+        // not part of the model, e.g. sc_invoke_method
+        m_modules.pop_back();
+        return;
+    }
+
+    const std::type_info& type = typeid( *module_p );
+    std::map<std::string, entry>::iterator it = m_types.find( type.name() );
+    if ( it == m_types.end() )
+    {
+        entry e;
+        e.name = type_name( type );
+        e.count = 0;
+        e.time = 0.0;
+        e.bytes = 0;
+        it = m_types.insert( std::make_pair( std::string( type.name() ), e ) )
+                    .first;
+    }
+    end_frame( m_modules, it->second );
+}
+
+std::size_t
+sc_elab_profiler::find_phase( const char* name )
+{
+    for ( std::size_t i = 0; i < m_phases.size(); ++i )
+        if ( m_phases[i].name == name )
+            return i;
+
+    entry e;
+    e.name = name;
+    e.count = 0;
+    e.time = 0.0;
+    e.bytes = 0;
+    m_phases.push_back( e );
+    return m_phases.size() - 1;
+}
+
+void
+sc_elab_profiler::phase_begin( const char* name )
+{
+    m_phase_stack.push_back( begin_frame( find_phase( name ) ) );
+}
+
+void
+sc_elab_profiler::phase_end()
+{
+    if ( !m_phase_stack.empty() )
+        end_frame( m_phase_stack, m_phases[m_phase_stack.back().phase] );
+}
+
+void
+sc_elab_profiler::reset()
+{
+    m_modules.clear();
+    m_phase_stack.clear();
+    m_types.clear();
+    m_phases.clear();
+}
+
+std::vector<sc_elab_profiler::entry>
+sc_elab_profiler::module_types() const
+{
+    std::vector<entry> result;
+    result.reserve( m_types.size() );
+    std::map<std::string, entry>::const_iterator it = m_types.begin();
+    for ( ; it != m_types.end(); ++it )
+        result.push_back( it->second );
+    std::sort( result.begin(), result.end(), &by_time );
+    return result;
+}
+
+void
+sc_elab_profiler::print( ::std::ostream& os, std::size_t top_n ) const
+{
+    os << "Elaboration profile\n"
+       << "  " << std::left << std::setw(30) << "phases" << std::right
+       << std::setw(9) << "count" << std::setw(14) << "time [s]"
+       << std::setw(15) << "heap [bytes]" << "\n";
+    for ( std::size_t i = 0; i < m_phases.size(); ++i )
+    {
+        os << "    " << std::left << std::setw(28) << m_phases[i].name
+           << std::right << std::setw(9) << m_phases[i].count
+           << std::setw(14) << m_phases[i].time
+           << std::setw(15) << m_phases[i].bytes << "\n";
+    }
+
+    std::vector<entry> types = module_types();
+    if ( top_n > types.size() )
+        top_n = types.size();
+    os << "  " << std::left << std::setw(30) << "module types by time"
+       << std::right << std::setw(9) << "modules" << std::setw(14)
+       << "time [s]" << std::setw(15) << "heap [bytes]" << "\n";
+    for ( std::size_t i = 0; i < top_n; ++i )
+    {
+        os << "    " << std::setw(37) << types[i].count
+           << std::setw(14) << types[i].time
+           << std::setw(15) << types[i].bytes
+           << "  " << types[i].name << "\n";
+    }
+    if ( !heap_measured() )
+        os << "  (the heap is not measured on this platform)\n";
+    os << ::std::flush;
+}
+
+void
+sc_elab_profiler::print_json( ::std::ostream& os ) const
+{
+    os << "{\n  \"phases\": ";
+    print_json_entries( os, m_phases, "count" );
+    os << ",\n  \"module_types\": ";
+    print_json_entries( os, module_types(), "modules" );
+    os << ",\n  \"heap_measured\": " << ( heap_measured() ? "true" : "false" )
+       << "\n}" << ::std::endl;
+}
+
+void
+sc_elab_profiler::start_of_simulation() const
+{
+    if ( m_dump == 1 )
+        print();
+    else if ( m_dump == 2 )
+        print_json();
+}
+
+sc_elab_profiler&
+sc_get_elab_profiler()
+{
+    return sc_get_curr_simcontext()->elab_profiler();
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,183 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_elab_profiler.h -- Profile of the elaboration, by module type and phase.
+
+  Once enabled, the profiler measures the host time and the growth of the
+  heap spent constructing each module, from the construction of its
+  sc_module_name to its destruction, and charges them to the dynamic type
+  of the module, less the modules constructed inside. It measures the
+  phases of elaboration and of the preparation of the simulation as well:
+  the construction of the top-level modules, the before_end_of_elaboration,
+  end_of_elaboration and start_of_simulation callbacks, the completion of
+  the port binding (which resolves the static sensitivity to ports), the
+  creation of the thread processes and the initialization phase. The
+  modules the kernel instantiates for itself are not measured.
+
+  The profiler is enabled by enable() before the modules are constructed,
+  or by the SC_ELAB_PROFILE environment variable, which also prints the
+  report when the simulation is about to start: as JSON if its value is
+  "json", as text otherwise. The heap is measured with the allocator
+  statistics of the GNU C library; elsewhere it reads zero.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_ELAB_PROFILER_H_INCLUDED_
+#define SC_ELAB_PROFILER_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sc_core {
+
+class sc_module;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_elab_profiler
+//
+//  Profile of the elaboration, see sc_get_elab_profiler().
+// ----------------------------------------------------------------------------
+
+class SC_API sc_elab_profiler
+{
+    friend class sc_simcontext;
+
+public:
+
+    typedef sc_dt::uint64 uint64;
+    typedef sc_dt::int64  int64;
+
+    // profile of one module type or phase
+    struct entry
+    {
+        std::string name;
+        uint64      count;   // modules constructed or phases executed.
+        double      time;    // seconds of host time, less nested ones.
+        int64       bytes;   // growth of the heap, less nested ones.
+    };
+
+    // phase measured while the object exists
+    class scope
+    {
+    public:
+        scope( sc_elab_profiler& profiler, const char* name )
+          : m_profiler_p( profiler.enabled() ? &profiler : 0 )
+            { if ( m_profiler_p ) m_profiler_p->phase_begin( name ); }
+        ~scope()
+            { if ( m_profiler_p ) m_profiler_p->phase_end(); }
+    private:
+        sc_elab_profiler* m_profiler_p;
+    private:
+        // disabled
+        scope( const scope& );
+        scope& operator = ( const scope& );
+    };
+
+    void enable( bool on = true )
+        { m_enabled = on; }
+    bool enabled() const
+        { return m_enabled; }
+
+    // can the growth of the heap be measured?
+    static bool heap_measured();
+
+    // the module types, with the largest host time first
+    std::vector<entry> module_types() const;
+
+    // the phases, in the order of their first execution
+    std::vector<entry> phases() const
+        { return m_phases; }
+
+    // forget the measurements
+    void reset();
+
+    // print the phases and the top_n module types
+    void print( ::std::ostream& os = ::std::cout,
+                std::size_t top_n = 20 ) const;
+    void print_json( ::std::ostream& os = ::std::cout ) const;
+
+public: // kernel internal
+
+    void module_begin();
+    void module_end( const sc_module* module_p )
+        { if ( !m_modules.empty() ) end_module( module_p ); }
+    void phase_begin( const char* name );
+    void phase_end();
+
+    // print the report if selected by SC_ELAB_PROFILE
+    void start_of_simulation() const;
+
+private:
+
+    // measurement in progress
+    struct frame
+    {
+        uint64      start_ns;    // host time at the start.
+        int64       start_bytes; // heap at the start.
+        uint64      nested_ns;   // host time of the nested frames.
+        int64       nested_bytes;// heap growth of the nested frames.
+        std::size_t phase;       // index of the phase, if one.
+    };
+
+    sc_elab_profiler();
+
+    void end_module( const sc_module* module_p );
+    frame begin_frame( std::size_t phase ) const;
+    void end_frame( std::vector<frame>& stack, entry& e );
+    std::size_t find_phase( const char* name );
+
+private:
+    bool                         m_enabled;
+    int                          m_dump;        // 0 no, 1 text, 2 JSON.
+    std::vector<frame>           m_modules;     // modules being constructed.
+    std::vector<frame>           m_phase_stack; // phases in progress.
+    std::map<std::string, entry> m_types;       // by mangled type name.
+    std::vector<entry>           m_phases;
+
+private:
+    // disabled
+    sc_elab_profiler( const sc_elab_profiler& );
+    sc_elab_profiler& operator = ( const sc_elab_profiler& );
+};
+
+// the profiler of the current simulation context
+SC_API sc_elab_profiler& sc_get_elab_profiler();
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_ELAB_PROFILER_H_INCLUDED_
+// Taf!
@@ -31,6 +31,7 @@
 
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_parallel.h"
 #include "sysc/kernel/sc_phase_callback_registry.h"
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_process_handle.h"
@@ -46,6 +47,85 @@ using std::malloc;
 using std::strrchr;
 using std::strncmp;
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_event_fanout
+//
+//  Static sensitivity of an event, as one flat, cache line aligned array of
+//  processes: the methods grow up from its front, the threads grow down from
+//  its back, so sc_event::trigger() walks a single block of memory.
+// ----------------------------------------------------------------------------
+
+class sc_event_fanout
+{
+public:
+
+    enum { cache_line = 64 };
+
+    static sc_event_fanout* create( const sc_event_fanout* old_p );
+    static void destroy( sc_event_fanout* fanout_p );
+
+    sc_process_b** procs()
+        { return reinterpret_cast<sc_process_b**>( this + 1 ); }
+
+    // k-th method and k-th thread, in the order they were added.
+    sc_process_b*& method( int k ) { return procs()[k]; }
+    sc_process_b*& thread( int k ) { return procs()[m_capacity - 1 - k]; }
+
+    bool full() const { return m_methods_n + m_threads_n == m_capacity; }
+
+public:
+
+    char* m_block;     // allocation holding this table.
+    int   m_capacity;  // number of process slots.
+    int   m_methods_n; // number of methods.
+    int   m_threads_n; // number of threads.
+
+private:
+
+    sc_event_fanout();
+    sc_event_fanout( const sc_event_fanout& );
+    sc_event_fanout& operator = ( const sc_event_fanout& );
+};
+
+// allocate a table with twice the capacity of old_p and copy old_p into it;
+// the first table fills the rest of its cache line.
+
+sc_event_fanout*
+sc_event_fanout::create( const sc_event_fanout* old_p )
+{
+    int capacity = old_p ? 2 * old_p->m_capacity
+                         : int( ( cache_line - sizeof(sc_event_fanout) )
+                                / sizeof(sc_process_b*) );
+    char* block = new char[ cache_line - 1 + sizeof(sc_event_fanout)
+                            + capacity * sizeof(sc_process_b*) ];
+    std::size_t addr = reinterpret_cast<std::size_t>( block );
+    addr = ( addr + cache_line - 1 ) & ~std::size_t( cache_line - 1 );
+
+    sc_event_fanout* fanout_p = reinterpret_cast<sc_event_fanout*>( addr );
+    fanout_p->m_block = block;
+    fanout_p->m_capacity = capacity;
+    fanout_p->m_methods_n = 0;
+    fanout_p->m_threads_n = 0;
+
+    if( old_p ) {
+        sc_event_fanout* from_p = const_cast<sc_event_fanout*>( old_p );
+        for( int k = 0; k < old_p->m_methods_n; ++k )
+            fanout_p->method( k ) = from_p->method( k );
+        for( int k = 0; k < old_p->m_threads_n; ++k )
+            fanout_p->thread( k ) = from_p->thread( k );
+        fanout_p->m_methods_n = old_p->m_methods_n;
+        fanout_p->m_threads_n = old_p->m_threads_n;
+    }
+    return fanout_p;
+}
+
+void
+sc_event_fanout::destroy( sc_event_fanout* fanout_p )
+{
+    if( fanout_p )
+        delete [] fanout_p->m_block;
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_event
 //
@@ -58,27 +138,34 @@ const sc_event sc_event::none( kernel_event, "none" );
 const char*
 sc_event::basename() const
 {
-    const char* p = strrchr( m_name.c_str(), SC_HIERARCHY_CHAR );
-    return p ? (p + 1) : m_name.c_str();
+    const char* p = strrchr( m_name, SC_HIERARCHY_CHAR );
+    return p ? (p + 1) : m_name;
 }
 
 void
 sc_event::cancel()
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record( sc_parallel_frame::CANCEL, this );
+        return;
+    }
+
     // cancel a delta or timed notification
     switch( m_notify_type ) {
     case DELTA: {
         // remove this event from the delta events set
         m_simc->remove_delta_event( this );
         m_notify_type = NONE;
+        SC_KERNEL_STATS_( m_simc->kernel_stats().cancellation() );
         break;
     }
     case TIMED: {
         // remove this event from the timed events set
         sc_assert( m_timed != 0 );
-        m_timed->m_event = 0;
+        m_simc->remove_timed_event( m_timed );
         m_timed = 0;
         m_notify_type = NONE;
+        SC_KERNEL_STATS_( m_simc->kernel_stats().cancellation() );
         break;
     }
     default:
@@ -87,9 +174,34 @@ sc_event::cancel()
 }
 
 
+// do only methods statically sensitive to this event wait for it?
+bool
+sc_event::static_methods_only() const
+{
+    return ( !m_static || m_static->m_threads_n == 0 )
+           && m_methods_dynamic.empty() && m_threads_dynamic.empty();
+}
+
+// is process_p a method statically sensitive to this event?
+bool
+sc_event::static_method( const sc_process_b* process_p ) const
+{
+    for( int k = 0; m_static && k < m_static->m_methods_n; ++k ) {
+        if( m_static->method( k ) == process_p )
+            return true;
+    }
+    return false;
+}
+
+
 void
 sc_event::notify()
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record( sc_parallel_frame::NOTIFY, this );
+        return;
+    }
+
     // immediate notification
     if( !m_simc->evaluation_phase() )
         // coming from
@@ -100,6 +212,7 @@ sc_event::notify()
         SC_REPORT_ERROR( SC_ID_IMMEDIATE_NOTIFICATION_, "" );
         return;
     }
+    SC_KERNEL_STATS_( m_simc->kernel_stats().immediate_notification() );
     cancel();
     trigger();
 }
@@ -107,6 +220,14 @@ sc_event::notify()
 void
 sc_event::notify( const sc_time& t )
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record( sc_parallel_frame::NOTIFY_TIMED,
+                                              this, t );
+        return;
+    }
+    SC_KERNEL_STATS_( t == SC_ZERO_TIME
+                      ? m_simc->kernel_stats().delta_notification()
+                      : m_simc->kernel_stats().timed_notification() );
     if( m_notify_type == DELTA ) {
         return;
     }
@@ -127,7 +248,7 @@ sc_event::notify( const sc_time& t )
         if( m_notify_type == TIMED ) {
             // remove this event from the timed events set
             sc_assert( m_timed != 0 );
-            m_timed->m_event = 0;
+            m_simc->remove_timed_event( m_timed );
             m_timed = 0;
         }
         // add this event to the delta events set
@@ -154,7 +275,7 @@ sc_event::notify( const sc_time& t )
             return;
         }
         // remove this event from the timed events set
-        m_timed->m_event = 0;
+        m_simc->remove_timed_event( m_timed );
         m_timed = 0;
     }
     // add this event to the timed events set
@@ -178,10 +299,16 @@ static void sc_warn_notify_delayed()
 void
 sc_event::notify_delayed()
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record( sc_parallel_frame::NOTIFY_DELAYED,
+                                              this );
+        return;
+    }
     sc_warn_notify_delayed();
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
     }
+    SC_KERNEL_STATS_( m_simc->kernel_stats().delta_notification() );
     // add this event to the delta events set
     m_delta_event_index = m_simc->add_delta_event( this );
     m_notify_type = DELTA;
@@ -190,16 +317,23 @@ sc_event::notify_delayed()
 void
 sc_event::notify_delayed( const sc_time& t )
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record(
+            sc_parallel_frame::NOTIFY_DELAYED_TIMED, this, t );
+        return;
+    }
     sc_warn_notify_delayed();
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
     }
     if( t == SC_ZERO_TIME ) {
         // add this event to the delta events set
+        SC_KERNEL_STATS_( m_simc->kernel_stats().delta_notification() );
         m_delta_event_index = m_simc->add_delta_event( this );
         m_notify_type = DELTA;
     } else {
         // add this event to the timed events set
+        SC_KERNEL_STATS_( m_simc->kernel_stats().timed_notification() );
         sc_event_timed* et = new sc_event_timed( this,
                                                  m_simc->time_stamp() + t );
         m_simc->add_timed_event( et );
@@ -228,6 +362,7 @@ void
 sc_event::register_event( const char* leaf_name, bool is_kernel_event /* = false */ )
 {
     sc_object_manager* object_manager = m_simc->get_object_manager();
+    std::string        kernel_name;  // leaf name of a kernel event.
     m_parent_p = m_simc->active_object();
 
     // No name provided, if we are not executing then create a name:
@@ -242,15 +377,15 @@ sc_event::register_event( const char* leaf_name, bool is_kernel_event /* = false
     // prepend kernel events with internal prefix
     else if ( is_kernel_event )
     {
-        m_name = SC_KERNEL_EVENT_PREFIX;
-        m_name.append( leaf_name );
-        leaf_name = m_name.c_str();
+        kernel_name = SC_KERNEL_EVENT_PREFIX;
+        kernel_name.append( leaf_name );
+        leaf_name = kernel_name.c_str();
     }
 
     // Create a hierarchichal name and place it into the object manager if
     // its not a kernel event:
 
-    object_manager->create_name( leaf_name ).swap( m_name );
+    m_name = object_manager->create_name( leaf_name );
 
     if ( !is_kernel_event )
     {
@@ -285,16 +420,15 @@ sc_event::reset()
 // |     name = name of the event.
 // +----------------------------------------------------------------------------
 sc_event::sc_event( const char* name ) :
-    m_name(),
+    m_name(""),
     m_parent_p(NULL),
     m_simc( sc_get_curr_simcontext() ),
     m_trigger_stamp( ~sc_dt::UINT64_ZERO ),
     m_notify_type( NONE ),
     m_delta_event_index( -1 ),
     m_timed( 0 ),
-    m_methods_static(),
+    m_static( 0 ),
     m_methods_dynamic(),
-    m_threads_static(),
     m_threads_dynamic()
 {
     register_event( name );
@@ -308,16 +442,15 @@ sc_event::sc_event( const char* name ) :
 // | hierarchy.
 // +----------------------------------------------------------------------------
 sc_event::sc_event() :
-    m_name(),
+    m_name(""),
     m_parent_p(NULL),
     m_simc( sc_get_curr_simcontext() ),
     m_trigger_stamp( ~sc_dt::UINT64_ZERO ),
     m_notify_type( NONE ),
     m_delta_event_index( -1 ),
     m_timed( 0 ),
-    m_methods_static(),
+    m_static( 0 ),
     m_methods_dynamic(),
-    m_threads_static(),
     m_threads_dynamic()
 {
     register_event( NULL );
@@ -331,16 +464,15 @@ sc_event::sc_event() :
 // | do NOT add it to the object hierarchy.
 // +----------------------------------------------------------------------------
 sc_event::sc_event( kernel_tag, const char* name ) :
-    m_name(),
+    m_name(""),
     m_parent_p(NULL),
     m_simc( sc_get_curr_simcontext() ),
     m_trigger_stamp( ~sc_dt::UINT64_ZERO ),
     m_notify_type( NONE ),
     m_delta_event_index( -1 ),
     m_timed( 0 ),
-    m_methods_static(),
+    m_static( 0 ),
     m_methods_dynamic(),
-    m_threads_static(),
     m_threads_dynamic()
 {
     register_event( name, /* is_kernel_event = */ true );
@@ -356,7 +488,7 @@ sc_event::sc_event( kernel_tag, const char* name ) :
 sc_event::~sc_event()
 {
     cancel();
-    if ( m_name.length() != 0 )
+    if ( in_hierarchy() )
     {
 	sc_object_manager* object_manager_p = m_simc->get_object_manager();
 	object_manager_p->remove_event( m_name );
@@ -365,11 +497,15 @@ sc_event::~sc_event()
     for(size_t i = 0; i < m_threads_dynamic.size(); ++i ) {
         if( m_threads_dynamic[i]->m_event_p == this )
             m_threads_dynamic[i]->m_event_p = 0;
+        m_threads_dynamic[i]->unbind_event( this );
     }
     for(size_t i = 0; i < m_methods_dynamic.size(); ++i ) {
         if( m_methods_dynamic[i]->m_event_p == this )
             m_methods_dynamic[i]->m_event_p = 0;
+        m_methods_dynamic[i]->unbind_event( this );
     }
+
+    sc_event_fanout::destroy( m_static );
 }
 
 // +----------------------------------------------------------------------------
@@ -391,16 +527,22 @@ sc_event::trigger()
     int       size;   // size of vector now accessing.
 
 
-    // trigger the static sensitive methods
+    // trigger the static sensitive methods and threads, latest first
 
-    if( ( size = m_methods_static.size() ) != 0 )
+    if( m_static != 0 )
     {
-        sc_method_handle* l_methods_static = &m_methods_static[0];
-        int i = size - 1;
-        do {
-            sc_method_handle method_h = l_methods_static[i];
-            method_h->trigger_static();
-        } while( -- i >= 0 );
+        sc_process_b*  curr_proc_p = m_simc->get_curr_proc_info()->process_handle;
+        sc_process_b** l_procs = m_static->procs();
+        int            capacity = m_static->m_capacity;
+
+        for( int i = m_static->m_methods_n - 1; i >= 0; -- i ) {
+            static_cast<sc_method_handle>( l_procs[i] )
+              ->trigger_static( curr_proc_p );
+        }
+        for( int i = capacity - m_static->m_threads_n; i < capacity; ++ i ) {
+            static_cast<sc_thread_handle>( l_procs[i] )
+              ->trigger_static( curr_proc_p );
+        }
     }
 
     // trigger the dynamic sensitive methods
@@ -424,18 +566,6 @@ sc_event::trigger()
     }
 
 
-    // trigger the static sensitive threads
-
-    if( ( size = m_threads_static.size() ) != 0 )
-    {
-        sc_thread_handle* l_threads_static = &m_threads_static[0];
-        int i = size - 1;
-        do {
-            sc_thread_handle thread_h = l_threads_static[i];
-            thread_h->trigger_static();
-        } while( -- i >= 0 );
-    }
-
     // trigger the dynamic sensitive threads
 
     if( ( size = m_threads_dynamic.size() ) != 0 )
@@ -456,24 +586,80 @@ sc_event::trigger()
     }
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_event::awaited"
+// |
+// | This method returns true if a process currently waits for this object
+// | instance, either dynamically or through its static sensitivity. A
+// | statically sensitive process, which waits for something else, does not
+// | count until it returns to its static sensitivity, nor does a process
+// | that stays registered through a persistent event list, but currently
+// | waits for something else.
+// +----------------------------------------------------------------------------
+bool
+sc_event::awaited() const
+{
+    for( size_t i = 0; i < m_methods_dynamic.size(); ++i ) {
+        if( m_methods_dynamic[i]->awaits_dynamic( this ) )
+            return true;
+    }
+    for( size_t i = 0; i < m_threads_dynamic.size(); ++i ) {
+        if( m_threads_dynamic[i]->awaits_dynamic( this ) )
+            return true;
+    }
+    if( m_static == 0 )
+        return false;
+
+    sc_process_b** l_procs = m_static->procs();
+    int            capacity = m_static->m_capacity;
+    for( int i = 0; i < m_static->m_methods_n; ++i ) {
+        if( l_procs[i]->m_trigger_type == sc_process_b::STATIC )
+            return true;
+    }
+    for( int i = capacity - m_static->m_threads_n; i < capacity; ++i ) {
+        if( l_procs[i]->m_trigger_type == sc_process_b::STATIC )
+            return true;
+    }
+    return false;
+}
+
 bool sc_event::triggered() const
 {
     return m_trigger_stamp == m_simc->change_stamp();
 }
 
+void
+sc_event::add_static( sc_method_handle method_h ) const
+{
+    if( m_static == 0 || m_static->full() ) {
+        sc_event_fanout* fanout_p = sc_event_fanout::create( m_static );
+        sc_event_fanout::destroy( m_static );
+        m_static = fanout_p;
+    }
+    m_static->method( m_static->m_methods_n++ ) = method_h;
+}
+
+void
+sc_event::add_static( sc_thread_handle thread_h ) const
+{
+    if( m_static == 0 || m_static->full() ) {
+        sc_event_fanout* fanout_p = sc_event_fanout::create( m_static );
+        sc_event_fanout::destroy( m_static );
+        m_static = fanout_p;
+    }
+    m_static->thread( m_static->m_threads_n++ ) = thread_h;
+}
+
 bool
 sc_event::remove_static( sc_method_handle method_h_ ) const
 {
-    int size;
-    if ( ( size = m_methods_static.size() ) != 0 ) {
-      sc_method_handle* l_methods_static = &m_methods_static[0];
-      for( int i = size - 1; i >= 0; -- i ) {
-          if( l_methods_static[i] == method_h_ ) {
-              l_methods_static[i] = l_methods_static[size - 1];
-              m_methods_static.resize(size-1);
-              return true;
-          }
-      }
+    int size = m_static ? m_static->m_methods_n : 0;
+    for( int i = size - 1; i >= 0; -- i ) {
+        if( m_static->method( i ) == method_h_ ) {
+            m_static->method( i ) = m_static->method( size - 1 );
+            m_static->m_methods_n = size - 1;
+            return true;
+        }
     }
     return false;
 }
@@ -481,16 +667,13 @@ sc_event::remove_static( sc_method_handle method_h_ ) const
 bool
 sc_event::remove_static( sc_thread_handle thread_h_ ) const
 {
-    int size;
-    if ( ( size = m_threads_static.size() ) != 0 ) {
-      sc_thread_handle* l_threads_static = &m_threads_static[0];
-      for( int i = size - 1; i >= 0; -- i ) {
-          if( l_threads_static[i] == thread_h_ ) {
-              l_threads_static[i] = l_threads_static[size - 1];
-              m_threads_static.resize(size-1);
-              return true;
-          }
-      }
+    int size = m_static ? m_static->m_threads_n : 0;
+    for( int i = size - 1; i >= 0; -- i ) {
+        if( m_static->thread( i ) == thread_h_ ) {
+            m_static->thread( i ) = m_static->thread( size - 1 );
+            m_static->m_threads_n = size - 1;
+            return true;
+        }
     }
     return false;
 }
@@ -531,80 +714,106 @@ sc_event::remove_dynamic( sc_thread_handle thread_h_ ) const
 
 
 // ----------------------------------------------------------------------------
-//  CLASS : sc_event_timed
+//  CLASS : sc_event_list
 //
-//  Class for storing the time to notify a timed event.
+//  Base class for lists of events.
 // ----------------------------------------------------------------------------
 
-// dedicated memory management; not MT-Safe
-
-union sc_event_timed_u
+sc_event_list::~sc_event_list()
 {
-    sc_event_timed_u* next;
-    char              dummy[sizeof( sc_event_timed )];
-};
-
-static
-sc_event_timed_u* free_list = 0;
+    if( m_busy )
+        report_premature_destruction();
+    unbind();
+    if( m_events != m_inline )
+        sc_kernel_pool::release( m_events,
+                                 m_capacity * sizeof( const sc_event* ) );
+}
 
-void*
-sc_event_timed::allocate()
+//------------------------------------------------------------------------------
+//"sc_event_list::reserve"
+//
+// This method makes room for n events. The first inline_capacity events are
+// stored in the list itself, more in storage from the kernel pool, which
+// grows by doubling.
+//------------------------------------------------------------------------------
+void
+sc_event_list::reserve( int n )
 {
-    const int ALLOC_SIZE = 64;
+    if( n <= m_capacity )
+        return;
 
-    if( free_list == 0 ) {
-        free_list = (sc_event_timed_u*) malloc( ALLOC_SIZE *
-                                                sizeof( sc_event_timed_u ) );
-        int i = 0;
-        for( ; i < ALLOC_SIZE - 1; ++ i ) {
-            free_list[i].next = &free_list[i + 1];
-        }
-        free_list[i].next = 0;
-    }
+    int capacity = 2 * m_capacity;
+    while( capacity < n )
+        capacity *= 2;
+    const sc_event** events = static_cast<const sc_event**>(
+        sc_kernel_pool::allocate( capacity * sizeof( const sc_event* ) ) );
+    for( int i = 0; i < m_size; ++i )
+        events[i] = m_events[i];
+    if( m_events != m_inline )
+        sc_kernel_pool::release( m_events,
+                                 m_capacity * sizeof( const sc_event* ) );
+    m_events = events;
+    m_capacity = capacity;
+}
 
-    sc_event_timed_u* q = free_list;
-    free_list = free_list->next;
-    return q;
+void
+sc_event_list::assign( const sc_event_list& that )
+{
+    unbind();
+    reserve( that.m_size );
+    for( int i = 0; i < that.m_size; ++i )
+        m_events[i] = that.m_events[i];
+    m_size = that.m_size;
 }
 
 void
-sc_event_timed::deallocate( void* p )
+sc_event_list::swap( sc_event_list& that )
 {
-    if( p != 0 ) {
-        sc_event_timed_u* q = reinterpret_cast<sc_event_timed_u*>( p );
-        q->next = free_list;
-        free_list = q;
+    if( busy() || that.busy() )
+        report_invalid_modification();
+    unbind();
+    that.unbind();
+
+    // allocated storage changes hands, inline storage is exchanged
+
+    bool this_inline = ( m_events == m_inline );
+    bool that_inline = ( that.m_events == that.m_inline );
+    for( int i = 0; i < inline_capacity; ++i ) {
+        const sc_event* e = m_inline[i];
+        m_inline[i] = that.m_inline[i];
+        that.m_inline[i] = e;
     }
+    const sc_event** events = m_events;
+    m_events = that_inline ? m_inline : that.m_events;
+    that.m_events = this_inline ? that.m_inline : events;
+
+    int size = m_size;
+    m_size = that.m_size;
+    that.m_size = size;
+    int capacity = m_capacity;
+    m_capacity = that.m_capacity;
+    that.m_capacity = capacity;
 }
 
-
-// ----------------------------------------------------------------------------
-//  CLASS : sc_event_list
-//
-//  Base class for lists of events.
-// ----------------------------------------------------------------------------
-
 void
 sc_event_list::push_back( const sc_event& e )
 {
     // make sure e is not already in the list
-    if ( m_events.size() != 0 ) {
-      const sc_event** l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          if( &e == l_events[i] ) {
-              // event already in the list; ignore
-              return;
-          }
-      }
+    if( contains( &e ) ) {
+        // event already in the list; ignore
+        return;
     }
-    m_events.push_back( &e );
+    unbind();
+    if( m_size == m_capacity )
+        reserve( m_size + 1 );
+    m_events[m_size++] = &e;
 }
 
 void
 sc_event_list::push_back( const sc_event_list& el )
 {
-    m_events.reserve( size() + el.size() );
-    for ( int i = el.m_events.size() - 1; i >= 0; --i )
+    reserve( size() + el.size() );
+    for ( int i = el.m_size - 1; i >= 0; --i )
     {
         push_back( *el.m_events[i] );
     }
@@ -614,55 +823,128 @@ sc_event_list::push_back( const sc_event_list& el )
 void
 sc_event_list::add_dynamic( sc_method_handle method_h ) const
 {
+    if( m_bound_p == method_h ) {
+        m_busy++; // still registered with the events
+        return;
+    }
+    if( m_persistent && ! m_busy )
+        bind( method_h );
     m_busy++;
-    if ( m_events.size() != 0 ) {
-      const sc_event* const * l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          l_events[i]->add_dynamic( method_h );
-      }
-  }
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        m_events[i]->add_dynamic( method_h );
+    }
 }
 
 void
 sc_event_list::add_dynamic( sc_thread_handle thread_h ) const
 {
+    if( m_bound_p == thread_h ) {
+        m_busy++; // still registered with the events
+        return;
+    }
+    if( m_persistent && ! m_busy )
+        bind( thread_h );
     m_busy++;
-    if ( m_events.size() != 0 ) {
-      const sc_event* const* l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          l_events[i]->add_dynamic( thread_h );
-      }
-  }
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        m_events[i]->add_dynamic( thread_h );
+    }
 }
 
 void
 sc_event_list::remove_dynamic( sc_method_handle method_h,
                                const sc_event* e_not ) const
 {
-    if ( m_events.size() != 0 ) {
-      const sc_event* const* l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          const sc_event* e = l_events[i];
-          if( e != e_not ) {
-              e->remove_dynamic( method_h );
-          }
-      }
-  }
+    if( m_bound_p == method_h )
+        return; // stays registered for the next wait
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        const sc_event* e = m_events[i];
+        if( e != e_not ) {
+            e->remove_dynamic( method_h );
+        }
+    }
 }
 
 void
 sc_event_list::remove_dynamic( sc_thread_handle thread_h,
                                const sc_event* e_not ) const
 {
-    if ( m_events.size() != 0 ) {
-      const sc_event* const* l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          const sc_event* e = l_events[i];
-          if( e != e_not ) {
-              e->remove_dynamic( thread_h );
-          }
-      }
-  }
+    if( m_bound_p == thread_h )
+        return; // stays registered for the next wait
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        const sc_event* e = m_events[i];
+        if( e != e_not ) {
+            e->remove_dynamic( thread_h );
+        }
+    }
+}
+
+void
+sc_event_list::set_persistent( bool persistent_ )
+{
+    if( ! persistent_ ) {
+        if( busy() && m_bound_p != 0 )
+            report_invalid_modification();
+        unbind();
+    }
+    m_persistent = persistent_;
+}
+
+//------------------------------------------------------------------------------
+//"sc_event_list::bind"
+//
+// This method makes the supplied process the one whose registration with
+// the events of this persistent list outlives its waits. The process is
+// registered by the caller. A process is bound to at most one list, and a
+// list to at most one process: the previous bindings of both are undone.
+//------------------------------------------------------------------------------
+void
+sc_event_list::bind( sc_process_b* process_p ) const
+{
+    unbind();
+    if( process_p->m_bound_list_p != 0 )
+        process_p->m_bound_list_p->unbind();
+    m_bound_p = process_p;
+    process_p->m_bound_list_p = this;
+}
+
+//------------------------------------------------------------------------------
+//"sc_event_list::unbind"
+//
+// This method removes the registration of the bound process, if any, from
+// the events of this list. It is called before the list is modified or
+// destroyed, and when the process terminates.
+//------------------------------------------------------------------------------
+void
+sc_event_list::unbind() const
+{
+    sc_process_b* process_p = m_bound_p;
+    if( process_p == 0 )
+        return;
+    m_bound_p = 0;
+    process_p->m_bound_list_p = 0;
+
+    if( process_p->proc_kind() == SC_METHOD_PROC_ ) {
+        sc_method_handle method_h = static_cast<sc_method_handle>( process_p );
+        for( int i = m_size - 1; i >= 0; -- i )
+            m_events[i]->remove_dynamic( method_h );
+    } else {
+        sc_thread_handle thread_h = static_cast<sc_thread_handle>( process_p );
+        for( int i = m_size - 1; i >= 0; -- i )
+            m_events[i]->remove_dynamic( thread_h );
+    }
+}
+
+// remove an event being destroyed from the list
+void
+sc_event_list::remove_event( const sc_event* e )
+{
+    for( int i = 0; i < m_size; ++i ) {
+        if( m_events[i] == e ) {
+            for( --m_size; i < m_size; ++i )
+                m_events[i] = m_events[i + 1];
+            return;
+        }
+    }
 }
 
 void
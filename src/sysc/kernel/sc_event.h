@@ -32,6 +32,7 @@
 
 #include "sysc/kernel/sc_cmnhdr.h"
 #include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_kernel_pool.h"
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/communication/sc_writer_policy.h"
 
@@ -44,6 +45,7 @@ namespace sc_core {
 
 // forward declarations
 class sc_event;
+class sc_event_fanout;
 class sc_event_timed;
 class sc_event_list;
 class sc_event_or_list;
@@ -58,6 +60,12 @@ SC_API int sc_notify_time_compare( const void*, const void* );
 //  CLASS : sc_event_expr
 //
 //  The event expression class.
+//
+//  The list of an expression is held by value, so the expression, e.g.
+//  a | b | c, is built on the stack of the caller and a list of up to
+//  sc_event_list::inline_capacity events does not allocate. A thread
+//  waiting for the expression uses this list, since the expression lives
+//  until the wait returns; next_trigger() moves it to a list of its own.
 // ----------------------------------------------------------------------------
 
 template< typename T >
@@ -70,48 +78,38 @@ class sc_event_expr
     typedef T type;
 
     inline sc_event_expr()
-       : m_expr( new T(true) )
+       : m_expr( true, true )
     {}
 
 public:
 
     inline sc_event_expr( sc_event_expr const & e) // move semantics
-      : m_expr(e.m_expr)
+      : m_expr( true, true )
     {
-        e.m_expr = 0;
+        m_expr.swap( e.m_expr );
     }
 
     T const & release() const
     {
-        sc_assert( m_expr );
-        T* expr = m_expr;
-        m_expr=0;
-        return *expr;
+        return m_expr;
     }
 
     void push_back( sc_event const & e) const
     {
-        sc_assert( m_expr );
-        m_expr->push_back(e);
+        m_expr.push_back(e);
     }
 
     void push_back( type const & el) const
     {
-        sc_assert( m_expr );
-        m_expr->push_back(el);
+        m_expr.push_back(el);
     }
     operator T const &() const
     {
         return release();
     }
 
-    ~sc_event_expr()
-    {
-        delete m_expr;
-    }
-
 private:
-    mutable type * m_expr;
+    mutable type m_expr;
 
     // disabled
     void operator=( sc_event_expr const & );
@@ -124,7 +122,9 @@ private:
 // ----------------------------------------------------------------------------
 
 class SC_API sc_event_list
+: public sc_kernel_pool_object
 {
+    friend class sc_event;
     friend class sc_process_b;
     friend class sc_method_process;
     friend class sc_thread_process;
@@ -138,13 +138,17 @@ public:
     bool empty() const
       { return size() == 0; }
 
+    // number of events stored without allocation
+    enum { inline_capacity = 4 };
+
 protected:
 
     void push_back( const sc_event& );
     void push_back( const sc_event_list& );
 
     explicit
-    sc_event_list( bool and_list_, bool auto_delete_ = false );
+    sc_event_list( bool and_list_, bool auto_delete_ = false,
+                   bool in_expression_ = false );
 
     sc_event_list( const sc_event&,
                    bool and_list_,
@@ -156,25 +160,42 @@ protected:
     void move_from( const sc_event_list& );
 
     bool and_list() const;
+    bool contains( const sc_event* ) const;
 
     void add_dynamic( sc_method_handle ) const;
     void add_dynamic( sc_thread_handle ) const;
     void remove_dynamic( sc_method_handle, const sc_event* ) const;
     void remove_dynamic( sc_thread_handle, const sc_event* ) const;
 
-    bool busy()        const;
-    bool temporary()   const;
-    void auto_delete() const;
+    bool busy()          const;
+    bool temporary()     const;
+    bool in_expression() const;
+    void auto_delete()   const;
+
+    bool persistent() const;
+    void set_persistent( bool );
+    void bind( sc_process_b* ) const;
+    void unbind() const;
+    void remove_event( const sc_event* );
 
     void report_premature_destruction() const;
     void report_invalid_modification()  const;
 
 private:
 
-    std::vector<const sc_event*> m_events;
-    bool                         m_and_list;
-    bool                         m_auto_delete;
-    mutable unsigned             m_busy;
+    void reserve( int );
+    void assign( const sc_event_list& );
+
+    const sc_event**      m_events;     // m_inline or allocated storage.
+    int                   m_size;
+    int                   m_capacity;
+    bool                  m_and_list;
+    bool                  m_auto_delete;
+    bool                  m_in_expression; // part of an sc_event_expr.
+    bool                  m_persistent;
+    mutable unsigned      m_busy;
+    mutable sc_process_b* m_bound_p;    // process registered with the events.
+    const sc_event*       m_inline[inline_capacity];
 };
 
 
@@ -192,11 +213,18 @@ class SC_API sc_event_and_list
     friend class sc_process_b;
     friend class sc_method_process;
     friend class sc_thread_process;
+    friend void next_trigger( const sc_event_and_list&, sc_simcontext* );
+    friend void next_trigger( const sc_time&, const sc_event_and_list&,
+                              sc_simcontext* );
 
 protected:
 
     explicit
     sc_event_and_list( bool auto_delete_ );
+    sc_event_and_list( bool auto_delete_, bool in_expression_ );
+
+    // this list, or a list of its events that outlives the expression
+    const sc_event_and_list& outlive_expression() const;
 
 public:
 
@@ -217,6 +245,12 @@ typedef sc_event_expr<sc_event_and_list> sc_event_and_expr;
 //  CLASS : sc_event_or_list
 //
 //  OR list of events.
+//
+//  A persistent list stays registered with its events after a wait of a
+//  process has returned, so the next wait of the same process for it does
+//  not register again. The list is bound to the process that waited for
+//  it last; modifying or destroying the list, or terminating the process,
+//  removes the registration.
 // ----------------------------------------------------------------------------
 
 class SC_API sc_event_or_list
@@ -227,16 +261,28 @@ class SC_API sc_event_or_list
     friend class sc_process_b;
     friend class sc_method_process;
     friend class sc_thread_process;
+    friend void next_trigger( const sc_event_or_list&, sc_simcontext* );
+    friend void next_trigger( const sc_time&, const sc_event_or_list&,
+                              sc_simcontext* );
 
 protected:
 
     explicit
     sc_event_or_list( bool auto_delete_ );
+    sc_event_or_list( bool auto_delete_, bool in_expression_ );
+
+    // this list, or a list of its events that outlives the expression
+    const sc_event_or_list& outlive_expression() const;
 
 public:
     sc_event_or_list();
     sc_event_or_list( const sc_event& );
     void swap( sc_event_or_list& );
+
+    // keep the registration with the events across waits of a process
+    void set_persistent( bool persistent_ = true );
+    bool is_persistent() const;
+
     sc_event_or_list& operator |= ( const sc_event& );
     sc_event_or_list& operator |= ( const sc_event_or_list & );
     sc_event_expr<sc_event_or_list>  operator | ( const sc_event& ) const;
@@ -252,9 +298,11 @@ typedef sc_event_expr<sc_event_or_list> sc_event_or_expr;
 // ----------------------------------------------------------------------------
 
 class SC_API sc_event
+: public sc_kernel_pool_object
 {
     friend class sc_event_list;
     friend class sc_event_timed;
+    friend class sc_checkpoint;
     friend class sc_simcontext;
     friend class sc_object;
     friend class sc_process_b;
@@ -268,8 +316,10 @@ class SC_API sc_event
     template<typename IF> friend class sc_fifo;
     friend class sc_semaphore;
     friend class sc_mutex;
+    friend class sc_sync_channel_base;
     friend class sc_join;
     friend class sc_trace_file;
+    friend class sc_parallel_engine;
 
 public:
 
@@ -279,10 +329,10 @@ public:
 
     void cancel();
 
-    const char* name() const             { return m_name.c_str(); }
+    const char* name() const             { return m_name; }
     const char* basename() const;
     sc_object* get_parent_object() const { return m_parent_p; }
-    bool in_hierarchy() const            { return m_name.length() != 0; }
+    bool in_hierarchy() const            { return m_name[0] != '\0'; }
 
     void notify();
     void notify( const sc_time& );
@@ -318,6 +368,10 @@ private:
     bool remove_dynamic( sc_method_handle ) const;
     bool remove_dynamic( sc_thread_handle ) const;
 
+    bool awaited() const;
+    bool static_methods_only() const;
+    bool static_method( const sc_process_b* ) const;
+
     void register_event( const char* name, bool is_kernel_event = false );
     void reset();
 
@@ -327,7 +381,7 @@ private:
 
     enum notify_t { NONE, DELTA, TIMED };
 
-    std::string     m_name;     // name of object.
+    const char*     m_name;     // name, in the object manager, or "".
     sc_object*      m_parent_p; // parent sc_object for this event.
     sc_simcontext*  m_simc;
     sc_dt::uint64   m_trigger_stamp; // delta of last trigger
@@ -335,9 +389,8 @@ private:
     int             m_delta_event_index;
     sc_event_timed* m_timed;
 
-    mutable std::vector<sc_method_handle> m_methods_static;
+    mutable sc_event_fanout*              m_static; // static sensitivity.
     mutable std::vector<sc_method_handle> m_methods_dynamic;
-    mutable std::vector<sc_thread_handle> m_threads_static;
     mutable std::vector<sc_thread_handle> m_threads_dynamic;
 
 private:
@@ -356,16 +409,21 @@ private:
 // ----------------------------------------------------------------------------
 
 class SC_API sc_event_timed
+: public sc_kernel_pool_object
 {
     friend class sc_event;
+    friend class sc_checkpoint;
+    friend class sc_clock;
     friend class sc_simcontext;
+    friend class sc_timed_heap;
+    friend class sc_timed_calendar;
 
     friend SC_API int sc_notify_time_compare( const void*, const void* );
 
 private:
 
     sc_event_timed( sc_event* e, const sc_time& t )
-        : m_event( e ), m_notify_time( t )
+        : m_event( e ), m_notify_time( t ), m_prev_p( 0 ), m_next_p( 0 )
         {}
 
     ~sc_event_timed()
@@ -377,22 +435,12 @@ private:
     const sc_time& notify_time() const
         { return m_notify_time; }
 
-    static void* operator new( std::size_t )
-        { return allocate(); }
-
-    static void operator delete( void* p, std::size_t )
-        { deallocate( p ); }
-
 private:
 
-    // dedicated memory management
-    static void* allocate();
-    static void  deallocate( void* );
-
-private:
-
-    sc_event* m_event;
-    sc_time   m_notify_time;
+    sc_event*       m_event;
+    sc_time         m_notify_time;
+    sc_event_timed* m_prev_p;      // neighbours in a sc_timed_calendar bucket.
+    sc_event_timed* m_next_p;
 
 private:
 
@@ -419,9 +467,11 @@ sc_event::notify_internal( const sc_time& t )
 {
     if( t == SC_ZERO_TIME ) {
         // add this event to the delta events set
+        SC_KERNEL_STATS_( m_simc->kernel_stats().delta_notification() );
         m_delta_event_index = m_simc->add_delta_event( this );
         m_notify_type = DELTA;
     } else {
+        SC_KERNEL_STATS_( m_simc->kernel_stats().timed_notification() );
         sc_event_timed* et =
 		new sc_event_timed( this, m_simc->time_stamp() + t );
         m_simc->add_timed_event( et );
@@ -434,9 +484,14 @@ inline
 void
 sc_event::notify_next_delta()
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) ) {
+        m_simc->parallel_notify_next_delta( *this );
+        return;
+    }
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
     }
+    SC_KERNEL_STATS_( m_simc->kernel_stats().delta_notification() );
     // add this event to the delta events set
     m_delta_event_index = m_simc->add_delta_event( this );
     m_notify_type = DELTA;
@@ -450,20 +505,6 @@ sc_event::notify_delayed( double v, sc_time_unit tu )
 }
 
 
-inline
-void
-sc_event::add_static( sc_method_handle method_h ) const
-{
-    m_methods_static.push_back( method_h );
-}
-
-inline
-void
-sc_event::add_static( sc_thread_handle thread_h ) const
-{
-    m_threads_static.push_back( thread_h );
-}
-
 inline
 void
 sc_event::add_dynamic( sc_method_handle method_h ) const
@@ -491,11 +532,17 @@ extern void notify( double v, sc_time_unit tu, sc_event& e );
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
 
 inline
-sc_event_list::sc_event_list( bool and_list_, bool auto_delete_ ) 
-  : m_events() 
-  , m_and_list( and_list_ ) 
-  , m_auto_delete( auto_delete_ ) 
+sc_event_list::sc_event_list( bool and_list_, bool auto_delete_,
+                              bool in_expression_ )
+  : m_events( m_inline )
+  , m_size( 0 )
+  , m_capacity( inline_capacity )
+  , m_and_list( and_list_ )
+  , m_auto_delete( auto_delete_ )
+  , m_in_expression( in_expression_ )
+  , m_persistent( false )
   , m_busy( 0 )
+  , m_bound_p( 0 )
 {
 }
 
@@ -503,20 +550,30 @@ inline
 sc_event_list::sc_event_list( const sc_event& e,
                               bool and_list_,
                               bool auto_delete_ )
-  : m_events()
+  : m_events( m_inline )
+  , m_size( 1 )
+  , m_capacity( inline_capacity )
   , m_and_list( and_list_ )
   , m_auto_delete( auto_delete_ )
-  , m_busy(0)
+  , m_in_expression( false )
+  , m_persistent( false )
+  , m_busy( 0 )
+  , m_bound_p( 0 )
 {
-    m_events.push_back( &e );
+    m_inline[0] = &e;
 }
 
 inline
 sc_event_list::sc_event_list( sc_event_list const & that )
-  : m_events()
+  : m_events( m_inline )
+  , m_size( 0 )
+  , m_capacity( inline_capacity )
   , m_and_list( that.m_and_list )
   , m_auto_delete( false )
+  , m_in_expression( false )
+  , m_persistent( false )
   , m_busy( 0 )
+  , m_bound_p( 0 )
 {
     move_from( that );
     that.auto_delete(); // free automatic lists
@@ -537,22 +594,6 @@ sc_event_list::operator=( sc_event_list const & that )
     return *this;
 }
 
-inline
-sc_event_list::~sc_event_list()
-{
-    if( m_busy )
-        report_premature_destruction();
-}
-
-inline
-void
-sc_event_list::swap( sc_event_list& that )
-{
-    if( busy() || that.busy() )
-        report_invalid_modification();
-    m_events.swap( that.m_events );
-}
-
 inline
 void
 sc_event_list::move_from( sc_event_list const&  that )
@@ -560,7 +601,7 @@ sc_event_list::move_from( sc_event_list const&  that )
     if( that.temporary() ) {
         swap( const_cast<sc_event_list&>(that) ); // move from source
     } else {
-        m_events = that.m_events;                 // copy from source
+        assign( that );                           // copy from source
     }
 }
 
@@ -568,7 +609,7 @@ inline
 int
 sc_event_list::size() const
 {
-    return static_cast<int>(m_events.size());
+    return m_size;
 }
 
 inline
@@ -578,6 +619,17 @@ sc_event_list::and_list() const
     return m_and_list;
 }
 
+inline
+bool
+sc_event_list::contains( const sc_event* e ) const
+{
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        if( m_events[i] == e )
+            return true;
+    }
+    return false;
+}
+
 
 inline
 bool
@@ -594,6 +646,13 @@ sc_event_list::temporary() const
     return m_auto_delete && ! m_busy;
 }
 
+inline
+bool
+sc_event_list::in_expression() const
+{
+    return m_in_expression;
+}
+
 inline
 void
 sc_event_list::auto_delete() const
@@ -601,11 +660,18 @@ sc_event_list::auto_delete() const
     if( m_busy ) {
         --m_busy;
     }
-    if( ! m_busy && m_auto_delete ) {
+    if( ! m_busy && m_auto_delete && ! m_in_expression ) {
         delete this;
     }
 }
 
+inline
+bool
+sc_event_list::persistent() const
+{
+    return m_persistent;
+}
+
 
 
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
@@ -627,6 +693,36 @@ sc_event_or_list::sc_event_or_list( bool auto_delete_ )
 : sc_event_list( false, auto_delete_ )
 {}
 
+inline
+sc_event_or_list::sc_event_or_list( bool auto_delete_, bool in_expression_ )
+: sc_event_list( false, auto_delete_, in_expression_ )
+{}
+
+inline
+const sc_event_or_list&
+sc_event_or_list::outlive_expression() const
+{
+    if( ! in_expression() )
+        return *this;
+    sc_event_or_list* list_p = new sc_event_or_list( true );
+    list_p->move_from( *this );
+    return *list_p;
+}
+
+inline
+void
+sc_event_or_list::set_persistent( bool persistent_ )
+{
+    sc_event_list::set_persistent( persistent_ );
+}
+
+inline
+bool
+sc_event_or_list::is_persistent() const
+{
+    return persistent();
+}
+
 inline
 sc_event_or_list&
 sc_event_or_list::operator |= ( const sc_event& e )
@@ -738,6 +834,22 @@ sc_event_and_list::sc_event_and_list( bool auto_delete_ )
 : sc_event_list( true, auto_delete_ )
 {}
 
+inline
+sc_event_and_list::sc_event_and_list( bool auto_delete_, bool in_expression_ )
+: sc_event_list( true, auto_delete_, in_expression_ )
+{}
+
+inline
+const sc_event_and_list&
+sc_event_and_list::outlive_expression() const
+{
+    if( ! in_expression() )
+        return *this;
+    sc_event_and_list* list_p = new sc_event_and_list( true );
+    list_p->move_from( *this );
+    return *list_p;
+}
+
 inline
 void
 sc_event_and_list::swap( sc_event_and_list & that )
@@ -0,0 +1,167 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_host_thread.h -- A "real" thread of the underlying host system
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_HOST_THREAD_H_INCLUDED_
+#define SC_HOST_THREAD_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/utils/sc_report.h" // sc_assert
+
+#if SC_CPLUSPLUS >= 201103L
+# include <thread>
+#elif !defined(WIN32) && !defined(_WIN32) // use pthread
+# include <pthread.h>
+#else // use Windows thread
+# ifndef SC_INCLUDE_WINDOWS_H
+#   define SC_INCLUDE_WINDOWS_H // include Windows.h, if needed
+#   include "sysc/kernel/sc_cmnhdr.h"
+# endif
+#endif // SC_CPLUSPLUS
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_host_thread
+//
+//   Wrapping an OS thread on the simulation host. The thread executes
+//   fn(arg) and must be joined before the object is destroyed.
+// ----------------------------------------------------------------------------
+
+class sc_host_thread
+{
+public:
+
+    typedef void (*entry_fn)( void* );
+
+private:
+
+#if SC_CPLUSPLUS >= 201103L
+
+    typedef std::thread underlying_type;
+
+    void do_start()
+      { m_thread = std::thread( m_fn, m_arg ); }
+    void do_join()
+      { m_thread.join(); }
+
+#elif defined(WIN32) || defined(_WIN32) // use Windows thread
+
+    typedef HANDLE underlying_type;
+
+    static DWORD WINAPI invoke( LPVOID this_p )
+    {
+        sc_host_thread* thread_p = static_cast<sc_host_thread*>( this_p );
+        thread_p->m_fn( thread_p->m_arg );
+        return 0;
+    }
+
+    void do_start()
+    {
+        m_thread = CreateThread( NULL, 0, &invoke, this, 0, NULL );
+        sc_assert( m_thread != NULL );
+    }
+    void do_join()
+    {
+        WaitForSingleObject( m_thread, INFINITE );
+        CloseHandle( m_thread );
+    }
+
+#else // use pthread
+
+    typedef pthread_t underlying_type;
+
+    static void* invoke( void* this_p )
+    {
+        sc_host_thread* thread_p = static_cast<sc_host_thread*>( this_p );
+        thread_p->m_fn( thread_p->m_arg );
+        return NULL;
+    }
+
+    void do_start()
+    {
+        int thread_created = pthread_create( &m_thread, NULL, &invoke, this );
+        sc_assert( thread_created == 0 );
+    }
+    void do_join()
+      { pthread_join( m_thread, NULL ); }
+
+#endif // platform-specific implementation
+
+public:
+
+    sc_host_thread() : m_thread(), m_fn(0), m_arg(0), m_running(false)
+      {}
+    ~sc_host_thread()
+      { sc_assert( !m_running ); }
+
+    // start executing fn(arg) on a new host thread
+    void start( entry_fn fn, void* arg )
+    {
+        sc_assert( !m_running );
+        m_fn = fn;
+        m_arg = arg;
+        m_running = true;
+        do_start();
+    }
+
+    // wait for the host thread to return
+    void join()
+    {
+        if( m_running ) {
+            do_join();
+            m_running = false;
+        }
+    }
+
+    bool joinable() const
+      { return m_running; }
+
+private:
+    underlying_type m_thread;
+    entry_fn        m_fn;
+    void*           m_arg;
+    bool            m_running;
+
+private:
+    // disabled
+    sc_host_thread( const sc_host_thread& );
+    sc_host_thread& operator = ( const sc_host_thread& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_HOST_THREAD_H_INCLUDED_
+// Taf!
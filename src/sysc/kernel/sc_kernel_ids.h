@@ -201,6 +201,30 @@ SC_DEFINE_MESSAGE(SC_ID_RESET_PROCESS_WHILE_NOT_RUNNING_  , 573,
         "a process may not be asynchronously reset while the simulation is not running" )
 SC_DEFINE_MESSAGE(SC_ID_THROW_IT_WHILE_NOT_RUNNING_  , 574,
         "throw_it not allowed unless simulation is running " )
+SC_DEFINE_MESSAGE(SC_ID_PARALLEL_WORKERS_AFTER_START_  , 575,
+        "attempt to set the number of parallel workers after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_PARALLEL_SAFE_  , 576,
+        "parallel_safe() is only allowed for SC_METHODs" )
+SC_DEFINE_MESSAGE(SC_ID_PARALLEL_NOT_SUPPORTED_  , 577,
+        "parallel simulation is not supported by this SystemC library build" )
+SC_DEFINE_MESSAGE(SC_ID_TIMED_QUEUE_AFTER_START_  , 578,
+        "attempt to select the timed event queue after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_CO_WAIT_NOT_ALLOWED_  , 579,
+        "co_wait() is only allowed in coroutine processes" )
+SC_DEFINE_MESSAGE(SC_ID_STACK_USAGE_  , 580,
+        "stack usage" )
+SC_DEFINE_MESSAGE(SC_ID_SYNC_QUANTUM_AFTER_START_  , 581,
+        "attempt to set the synchronization quantum after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_SYNC_QUANTUM_ZERO_  , 582,
+        "synchronization domains require a non-zero quantum" )
+SC_DEFINE_MESSAGE(SC_ID_SYNC_DOMAIN_FAILED_  , 583,
+        "exception in synchronization domain" )
+SC_DEFINE_MESSAGE(SC_ID_CHECKPOINT_FAILED_  , 584,
+        "checkpoint failed" )
+SC_DEFINE_MESSAGE(SC_ID_CHECKPOINT_INCOMPLETE_  , 585,
+        "checkpoint incomplete" )
+SC_DEFINE_MESSAGE(SC_ID_CHECKPOINT_RESTORE_AFTER_START_  , 586,
+        "attempt to restore a checkpoint after start will be ignored" )
 
 
 /*****************************************************************************
@@ -0,0 +1,321 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_kernel_pool.cpp -- Slab allocator for the objects of the simulation
+                        kernel.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_kernel_pool.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/communication/sc_host_mutex.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+#if defined(WIN32) || defined(_WIN32)
+#   include <malloc.h>
+#endif
+
+namespace sc_core {
+
+// header at the start of each block, followed by the cells
+
+struct sc_kernel_pool::block
+{
+    sc_kernel_pool* pool;
+    block*          next;        // next block of the pool.
+    std::size_t     class_index; // size class of the cells.
+};
+
+const std::size_t sc_kernel_pool::header_size =
+    ( ( sizeof( block ) + cell_align - 1 ) / cell_align ) * cell_align;
+
+namespace {
+
+bool compute_enabled()
+{
+    const char* e = std::getenv( "SYSTEMC_MEMPOOL_DONT_USE" );
+    return !( ( e != 0 ) && ( std::atoi( e ) != 0 ) );
+}
+
+void* allocate_block()
+{
+    void* p = 0;
+#if defined(WIN32) || defined(_WIN32)
+    p = _aligned_malloc( sc_kernel_pool::block_size,
+                         sc_kernel_pool::block_size );
+#else
+    if( posix_memalign( &p, sc_kernel_pool::block_size,
+                        sc_kernel_pool::block_size ) != 0 )
+        p = 0;
+#endif
+    if( p == 0 )
+        throw std::bad_alloc();
+    return p;
+}
+
+void free_block( void* p )
+{
+#if defined(WIN32) || defined(_WIN32)
+    _aligned_free( p );
+#else
+    std::free( p );
+#endif
+}
+
+// locks the mutex, if any, for the lifetime of the object
+class pool_lock
+{
+public:
+    explicit pool_lock( sc_host_mutex* mutex_p )
+      : m_mutex_p( mutex_p )
+        { if( m_mutex_p ) m_mutex_p->lock(); }
+    ~pool_lock()
+        { if( m_mutex_p ) m_mutex_p->unlock(); }
+private:
+    sc_host_mutex* m_mutex_p;
+private:
+    // disabled
+    pool_lock( const pool_lock& );
+    pool_lock& operator = ( const pool_lock& );
+};
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_kernel_pool
+//
+//  Slab allocator for the objects of the simulation kernel.
+// ----------------------------------------------------------------------------
+
+sc_kernel_pool::sc_kernel_pool( sc_simcontext* simc_p )
+  : m_simc( simc_p ), m_mutex_p( new sc_host_mutex ), m_block_list( 0 ),
+    m_allocations( 0 ), m_releases( 0 ), m_recycled( 0 ),
+    m_heap_allocations( 0 ), m_blocks( 0 )
+{
+    for( int i = 0; i < classes_n; ++i ) {
+        m_classes[i].free_list = 0;
+        m_classes[i].next_avail = 0;
+        m_classes[i].end = 0;
+    }
+}
+
+sc_kernel_pool::~sc_kernel_pool()
+{
+    while( m_block_list ) {
+        block* block_p = m_block_list;
+        m_block_list = block_p->next;
+        free_block( block_p );
+    }
+    delete m_mutex_p;
+}
+
+bool
+sc_kernel_pool::enabled()
+{
+    static const bool use_pool = compute_enabled();
+    return use_pool;
+}
+
+void*
+sc_kernel_pool::allocate( std::size_t sz )
+{
+    if( sz > max_cell_size || !enabled() ) {
+        if( enabled() ) {
+            sc_kernel_pool& pool = sc_get_curr_simcontext()->kernel_pool();
+            pool_lock lock( SC_UNLIKELY_( pool.m_simc->parallel_phase() )
+                            ? pool.m_mutex_p : 0 );
+            ++pool.m_heap_allocations;
+        }
+        return ::operator new( sz );
+    }
+    return sc_get_curr_simcontext()->kernel_pool().allocate_cell( sz );
+}
+
+void
+sc_kernel_pool::release( void* p, std::size_t sz )
+{
+    if( p == 0 )
+        return;
+    if( sz > max_cell_size || !enabled() ) {
+        ::operator delete( p );
+        return;
+    }
+
+    // the block starts at the preceding multiple of its size
+
+    std::size_t offset = reinterpret_cast<std::size_t>( p ) % block_size;
+    block* block_p = reinterpret_cast<block*>( static_cast<char*>( p )
+                                               - offset );
+    block_p->pool->release_cell( block_p, p );
+}
+
+//------------------------------------------------------------------------------
+//"sc_kernel_pool::release"
+//
+// This method returns memory whose size is not known, which happens only if
+// the constructor of an object allocated with new (std::nothrow) throws.
+// The memory is a cell if it lies within a block of the pool of the current
+// simulation context, otherwise it was passed to the global allocator.
+//------------------------------------------------------------------------------
+void
+sc_kernel_pool::release( void* p )
+{
+    if( p == 0 )
+        return;
+    block* block_p = 0;
+    if( enabled() ) {
+        block_p = sc_get_curr_simcontext()->kernel_pool().find_block( p );
+    }
+    if( block_p == 0 ) {
+        ::operator delete( p );
+        return;
+    }
+    block_p->pool->release_cell( block_p, p );
+}
+
+void*
+sc_kernel_pool::allocate_cell( std::size_t sz )
+{
+    std::size_t class_index = sz ? ( sz - 1 ) / cell_align : 0;
+    size_class& sc = m_classes[class_index];
+
+    pool_lock lock( SC_UNLIKELY_( m_simc->parallel_phase() ) ? m_mutex_p
+                                                             : 0 );
+    ++m_allocations;
+    if( sc.free_list != 0 ) {
+        ++m_recycled;
+        cell* cell_p = sc.free_list;
+        sc.free_list = cell_p->next;
+        return cell_p;
+    }
+    if( sc.next_avail == 0 ) {
+        add_block( class_index );
+    }
+    void* result = sc.next_avail;
+    sc.next_avail += ( class_index + 1 ) * cell_align;
+    if( sc.next_avail + ( class_index + 1 ) * cell_align > sc.end ) {
+        sc.next_avail = 0;
+    }
+    return result;
+}
+
+void
+sc_kernel_pool::release_cell( block* block_p, void* p )
+{
+    bool last = false;
+    {
+        pool_lock lock( m_simc && SC_UNLIKELY_( m_simc->parallel_phase() )
+                        ? m_mutex_p : 0 );
+        cell* cell_p = static_cast<cell*>( p );
+        size_class& sc = m_classes[block_p->class_index];
+        cell_p->next = sc.free_list;
+        sc.free_list = cell_p;
+        ++m_releases;
+        last = ( m_simc == 0 && live() == 0 );
+    }
+    if( last ) {
+        delete this; // the last cell of a detached pool
+    }
+}
+
+sc_kernel_pool::block*
+sc_kernel_pool::find_block( void* p ) const
+{
+    pool_lock lock( SC_UNLIKELY_( m_simc->parallel_phase() ) ? m_mutex_p
+                                                             : 0 );
+    const char* c = static_cast<const char*>( p );
+    for( block* block_p = m_block_list; block_p; block_p = block_p->next ) {
+        const char* start = reinterpret_cast<const char*>( block_p );
+        if( c >= start && c < start + block_size )
+            return block_p;
+    }
+    return 0;
+}
+
+void
+sc_kernel_pool::add_block( std::size_t class_index )
+{
+    block* block_p = static_cast<block*>( allocate_block() );
+    block_p->pool = this;
+    block_p->next = m_block_list;
+    block_p->class_index = class_index;
+    m_block_list = block_p;
+    ++m_blocks;
+
+    size_class& sc = m_classes[class_index];
+    sc.next_avail = reinterpret_cast<char*>( block_p ) + header_size;
+    sc.end = reinterpret_cast<char*>( block_p ) + block_size;
+}
+
+//------------------------------------------------------------------------------
+//"sc_kernel_pool::detach"
+//
+// This method is called by the simulation context when it is destroyed.
+// The blocks are returned to the host right away, unless some objects are
+// still alive, in which case the pool lives on until the last of them is
+// released.
+//------------------------------------------------------------------------------
+void
+sc_kernel_pool::detach()
+{
+    m_simc = 0;
+    if( live() == 0 ) {
+        delete this;
+    }
+}
+
+void
+sc_kernel_pool::print( ::std::ostream& os ) const
+{
+    os << "Kernel pool" << ( enabled() ? "" : " (disabled)" ) << "\n"
+       << "  allocations          " << std::setw(14) << m_allocations << "\n"
+       << "    from free lists    " << std::setw(14) << m_recycled << "\n"
+       << "  releases             " << std::setw(14) << m_releases << "\n"
+       << "  live                 " << std::setw(14) << live() << "\n"
+       << "  blocks               " << std::setw(14) << m_blocks << "\n"
+       << "  bytes reserved       " << std::setw(14) << bytes_reserved()
+       << "\n"
+       << "  passed to the heap   " << std::setw(14) << m_heap_allocations
+       << "\n" << ::std::flush;
+}
+
+sc_kernel_pool&
+sc_get_kernel_pool()
+{
+    return sc_get_curr_simcontext()->kernel_pool();
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
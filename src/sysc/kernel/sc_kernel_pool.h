@@ -0,0 +1,202 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_kernel_pool.h -- Slab allocator for the objects of the simulation
+                      kernel.
+
+  Each simulation context owns a pool, from which the events, the timed
+  notifications, the event lists and the processes are allocated. The pool
+  carves blocks of block_size bytes, aligned to their size, into cells of
+  one size class each (multiples of 16 bytes up to max_cell_size) and
+  keeps a free list per size class, so once the simulation has reached
+  its steady state, notifying, waiting and spawning processes reuse the
+  cells released before, e.g. by the processes collected at the end of
+  each evaluation phase, instead of calling the global allocator.
+
+  A cell finds its block, and thereby its pool and size class, from its
+  address. The blocks are returned when the simulation context is
+  destroyed, or once the last of its cells is released if objects outlive
+  the context. Larger objects are passed to the global allocator. Set the
+  environment variable SYSTEMC_MEMPOOL_DONT_USE to 1 to pass all objects
+  to the global allocator, e.g. for memory checkers.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_KERNEL_POOL_H_INCLUDED_
+#define SC_KERNEL_POOL_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <iostream>
+#include <new>
+
+namespace sc_core {
+
+class sc_host_mutex;
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_kernel_pool
+//
+//  Slab allocator of a simulation context, see sc_get_kernel_pool().
+// ----------------------------------------------------------------------------
+
+class SC_API sc_kernel_pool
+{
+    friend class sc_simcontext;
+
+public:
+
+    typedef sc_dt::uint64 uint64;
+
+    enum {
+        block_size    = 64 * 1024,   // bytes per block, also its alignment.
+        cell_align    = 16,          // granularity of the size classes.
+        max_cell_size = 1024         // larger objects use the global heap.
+    };
+
+    // memory for sz bytes from the pool of the current simulation context
+    static void* allocate( std::size_t sz );
+
+    // return memory of sz bytes obtained from allocate()
+    static void release( void* p, std::size_t sz );
+
+    // return memory obtained from allocate(), of unknown size (slower)
+    static void release( void* p );
+
+    // are the pools used (see SYSTEMC_MEMPOOL_DONT_USE)?
+    static bool enabled();
+
+    uint64 allocations() const      { return m_allocations; }
+    uint64 releases() const         { return m_releases; }
+    uint64 recycled() const         { return m_recycled; }  // free list hits.
+    uint64 heap_allocations() const { return m_heap_allocations; }
+    uint64 live() const             { return m_allocations - m_releases; }
+    uint64 blocks() const           { return m_blocks; }
+    uint64 bytes_reserved() const   { return m_blocks * block_size; }
+
+    // print the counters
+    void print( ::std::ostream& os = ::std::cout ) const;
+
+private:
+
+    struct block;
+    struct cell { cell* next; };
+
+    // cells of one size class
+    struct size_class
+    {
+        cell* free_list;  // released cells.
+        char* next_avail; // unused part of the newest block, or 0.
+        char* end;        // end of the newest block.
+    };
+
+    enum { classes_n = max_cell_size / cell_align };
+
+    static const std::size_t header_size; // offset of the first cell.
+
+    explicit sc_kernel_pool( sc_simcontext* simc_p );
+    ~sc_kernel_pool();
+
+    // called when the simulation context is destroyed
+    void detach();
+
+    void* allocate_cell( std::size_t sz );
+    void release_cell( block* block_p, void* p );
+    block* find_block( void* p ) const;
+    void add_block( std::size_t class_index );
+
+private:
+    sc_simcontext* m_simc;             // owner, or 0 once detached.
+    sc_host_mutex* m_mutex_p;          // serializes the parallel phase.
+    block*         m_block_list;       // all blocks of the pool.
+    size_class     m_classes[classes_n];
+
+    uint64         m_allocations;
+    uint64         m_releases;
+    uint64         m_recycled;
+    uint64         m_heap_allocations;
+    uint64         m_blocks;
+
+private:
+    // disabled
+    sc_kernel_pool( const sc_kernel_pool& );
+    sc_kernel_pool& operator = ( const sc_kernel_pool& );
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_kernel_pool_object
+//
+//  Base class of the kernel objects allocated from sc_kernel_pool.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_kernel_pool_object
+{
+public:
+
+    static void* operator new( std::size_t sz )
+        { return sc_kernel_pool::allocate( sz ); }
+
+    static void* operator new( std::size_t, void* p ) // placement new
+        { return p; }
+
+    static void operator delete( void* p, std::size_t sz )
+        { sc_kernel_pool::release( p, sz ); }
+
+    static void operator delete( void*, void* ) // placement delete
+        {}
+
+    static void* operator new( std::size_t sz, const std::nothrow_t& )
+        SC_NOEXCEPT_
+    {
+        try {
+            return sc_kernel_pool::allocate( sz );
+        } catch( ... ) {
+            return 0;
+        }
+    }
+
+    // only called if the constructor of an object from the nothrow new
+    // above throws, which doesn't pass the size of the object
+    static void operator delete( void* p, const std::nothrow_t& )
+        SC_NOEXCEPT_
+        { sc_kernel_pool::release( p ); }
+};
+
+// the pool of the current simulation context
+SC_API sc_kernel_pool& sc_get_kernel_pool();
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_KERNEL_POOL_H_INCLUDED_
+// Taf!
@@ -0,0 +1,321 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_kernel_stats.cpp -- Performance counters of the simulation kernel.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_kernel_stats.h"
+#include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_simcontext.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+
+#if defined(WIN32) || defined(_WIN32)
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#else
+#   include <time.h>
+#endif
+
+namespace sc_core {
+
+namespace {
+
+bool by_host_time( const sc_kernel_stats::process_info& a,
+                   const sc_kernel_stats::process_info& b )
+{
+    if ( a.host_time != b.host_time )
+        return a.host_time > b.host_time;
+    return a.name < b.name;
+}
+
+// appends the processes below the given objects
+void collect_processes( const std::vector<sc_object*>& objects,
+                        std::vector<sc_process_b*>& processes )
+{
+    for ( std::size_t i = 0; i < objects.size(); ++i )
+    {
+        sc_process_b* process_p = dynamic_cast<sc_process_b*>( objects[i] );
+        if ( process_p )
+            processes.push_back( process_p );
+        collect_processes( objects[i]->get_child_objects(), processes );
+    }
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_kernel_stats
+//
+//  Performance counters of the simulation kernel.
+// ----------------------------------------------------------------------------
+
+sc_kernel_stats::sc_kernel_stats( sc_simcontext* simc_p )
+  : m_simc( simc_p ), m_dump( false )
+{
+    clear();
+}
+
+bool
+sc_kernel_stats::enabled()
+{
+#if defined(SC_ENABLE_KERNEL_STATS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+sc_kernel_stats::uint64
+sc_kernel_stats::host_time_ns()
+{
+#if defined(WIN32) || defined(_WIN32)
+    static LARGE_INTEGER frequency = { { 0, 0 } };
+    if ( frequency.QuadPart == 0 )
+        QueryPerformanceFrequency( &frequency );
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter( &counter );
+    return static_cast<uint64>( counter.QuadPart / frequency.QuadPart )
+           * 1000000000ULL
+         + static_cast<uint64>( counter.QuadPart % frequency.QuadPart )
+           * 1000000000ULL / frequency.QuadPart;
+#else
+    timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    return static_cast<uint64>( now.tv_sec ) * 1000000000ULL
+         + static_cast<uint64>( now.tv_nsec );
+#endif
+}
+
+void
+sc_kernel_stats::clear()
+{
+    m_running_p = 0;
+    m_switch_ns = 0;
+
+    m_delta_cycles = 0;
+    m_time_steps = 0;
+    m_method_runs = 0;
+    m_thread_runs = 0;
+    m_delta_methods = 0;
+    m_delta_threads = 0;
+    m_max_methods_per_delta = 0;
+    m_max_threads_per_delta = 0;
+    m_context_switches = 0;
+
+    m_update_phases = 0;
+    m_channel_updates = 0;
+    m_max_updates_per_phase = 0;
+    m_update_host_ns = 0;
+
+    m_timed_queue_samples = 0;
+    m_max_timed_queue_depth = 0;
+
+    m_immediate_notifications = 0;
+    m_delta_notifications = 0;
+    m_timed_notifications = 0;
+    m_cancellations = 0;
+}
+
+void
+sc_kernel_stats::reset()
+{
+    sc_process_b* running_p = m_running_p;
+    clear();
+    std::vector<sc_process_b*> procs;
+    collect_processes( sc_get_top_level_objects( m_simc ), procs );
+    for ( std::size_t i = 0; i < procs.size(); ++i )
+    {
+        procs[i]->m_stats_host_ns = 0;
+        procs[i]->m_stats_runs = 0;
+    }
+    if ( running_p )
+    {
+        m_running_p = running_p;
+        m_switch_ns = host_time_ns();
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_kernel_stats::switch_to"
+//
+// This method charges the host time since the last switch to the process
+// that was running, and starts charging next_p. A new run of next_p is
+// counted unless it merely continues after a preempting process.
+//------------------------------------------------------------------------------
+void
+sc_kernel_stats::switch_to( sc_process_b* next_p, bool new_run )
+{
+    uint64 now = host_time_ns();
+    if ( m_running_p )
+        m_running_p->m_stats_host_ns += now - m_switch_ns;
+    m_running_p = next_p;
+    m_switch_ns = now;
+
+    if ( next_p == 0 || !new_run )
+        return;
+    ++next_p->m_stats_runs;
+    if ( next_p->proc_kind() == SC_METHOD_PROC_ )
+    {
+        ++m_method_runs;
+        ++m_delta_methods;
+    }
+    else
+    {
+        ++m_thread_runs;
+        ++m_delta_threads;
+    }
+}
+
+void
+sc_kernel_stats::end_of_delta()
+{
+    ++m_delta_cycles;
+    if ( m_delta_methods > m_max_methods_per_delta )
+        m_max_methods_per_delta = m_delta_methods;
+    if ( m_delta_threads > m_max_threads_per_delta )
+        m_max_threads_per_delta = m_delta_threads;
+    m_delta_methods = 0;
+    m_delta_threads = 0;
+}
+
+void
+sc_kernel_stats::time_step( std::size_t timed_queue_depth )
+{
+    ++m_time_steps;
+    m_timed_queue_samples += timed_queue_depth;
+    if ( timed_queue_depth > m_max_timed_queue_depth )
+        m_max_timed_queue_depth = timed_queue_depth;
+}
+
+void
+sc_kernel_stats::update_phase( std::size_t updates_n, uint64 host_ns )
+{
+    ++m_update_phases;
+    m_channel_updates += updates_n;
+    if ( updates_n > m_max_updates_per_phase )
+        m_max_updates_per_phase = updates_n;
+    m_update_host_ns += host_ns;
+}
+
+double
+sc_kernel_stats::avg_timed_queue_depth() const
+{
+    if ( m_time_steps == 0 )
+        return 0.0;
+    return static_cast<double>( m_timed_queue_samples ) / m_time_steps;
+}
+
+std::vector<sc_kernel_stats::process_info>
+sc_kernel_stats::processes() const
+{
+    std::vector<sc_process_b*> procs;
+    collect_processes( sc_get_top_level_objects( m_simc ), procs );
+
+    std::vector<process_info> result( procs.size() );
+    for ( std::size_t i = 0; i < procs.size(); ++i )
+    {
+        result[i].name = procs[i]->name();
+        result[i].kind = procs[i]->kind();
+        result[i].runs = procs[i]->m_stats_runs;
+        result[i].host_time = 1e-9 * procs[i]->m_stats_host_ns;
+    }
+    std::sort( result.begin(), result.end(), &by_host_time );
+    return result;
+}
+
+void
+sc_kernel_stats::print( ::std::ostream& os, std::size_t top_n ) const
+{
+    if ( !enabled() )
+    {
+        os << "Kernel statistics are not available, build the library "
+              "with ENABLE_KERNEL_STATS." << ::std::endl;
+        return;
+    }
+
+    os << "Kernel statistics\n"
+       << "  delta cycles             " << m_delta_cycles << "\n"
+       << "  time steps               " << m_time_steps << "\n"
+       << "  method runs              " << m_method_runs
+       << " (max " << m_max_methods_per_delta << " per delta cycle)\n"
+       << "  thread runs              " << m_thread_runs
+       << " (max " << m_max_threads_per_delta << " per delta cycle)\n"
+       << "  context switches         " << m_context_switches << "\n"
+       << "  update phases            " << m_update_phases << "\n"
+       << "  channel updates          " << m_channel_updates
+       << " (max " << m_max_updates_per_phase << " per phase, "
+       << update_host_time() << " s)\n"
+       << "  timed queue depth        " << avg_timed_queue_depth()
+       << " average, " << m_max_timed_queue_depth << " max\n"
+       << "  immediate notifications  " << m_immediate_notifications << "\n"
+       << "  delta notifications      " << m_delta_notifications << "\n"
+       << "  timed notifications      " << m_timed_notifications << "\n"
+       << "  cancellations            " << m_cancellations << "\n";
+
+    std::vector<process_info> procs = processes();
+    if ( top_n > procs.size() )
+        top_n = procs.size();
+    if ( top_n != 0 )
+    {
+        os << "  processes by host time\n";
+        for ( std::size_t i = 0; i < top_n; ++i )
+        {
+            os << "    " << std::setw(12) << procs[i].host_time << " s "
+               << std::setw(10) << procs[i].runs << " runs  "
+               << procs[i].name << " (" << procs[i].kind << ")\n";
+        }
+    }
+    os << ::std::flush;
+}
+
+void
+sc_kernel_stats::end_of_simulation() const
+{
+    if ( !enabled() )
+        return;
+    const char* env = std::getenv( "SC_KERNEL_STATS" );
+    if ( m_dump || ( env && std::atoi( env ) != 0 ) )
+        print();
+}
+
+sc_kernel_stats&
+sc_get_kernel_stats()
+{
+    return sc_get_curr_simcontext()->kernel_stats();
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
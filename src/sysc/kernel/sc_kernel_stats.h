@@ -0,0 +1,208 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_kernel_stats.h -- Performance counters of the simulation kernel.
+
+  The counters are only maintained if the library was built with
+  ENABLE_KERNEL_STATS (SC_ENABLE_KERNEL_STATS); otherwise the scheduler
+  contains no trace of them and all counters read zero. They cover the
+  delta cycles and time steps, the processes run per delta cycle, the
+  coroutine switches, the update phases, the depth of the timed event
+  queue and the event notifications by kind, plus the number of runs and
+  the host time of each process.
+
+  Method processes run on the worker pool of the parallel evaluation count
+  towards the totals only; neither their runs nor their host time are
+  attributed to the individual processes.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_KERNEL_STATS_H_INCLUDED_
+#define SC_KERNEL_STATS_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(SC_ENABLE_KERNEL_STATS)
+#   define SC_KERNEL_STATS_( statement ) statement
+#else
+#   define SC_KERNEL_STATS_( statement ) ((void)0)
+#endif
+
+namespace sc_core {
+
+class sc_process_b;
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_kernel_stats
+//
+//  Performance counters of the simulation kernel, see sc_get_kernel_stats().
+// ----------------------------------------------------------------------------
+
+class SC_API sc_kernel_stats
+{
+    friend class sc_simcontext;
+
+public:
+
+    // statistics of one process
+    struct process_info
+    {
+        std::string   name;
+        const char*   kind;
+        sc_dt::uint64 runs;       // number of times run (resumed).
+        double        host_time;  // seconds spent running on the host.
+    };
+
+    typedef sc_dt::uint64 uint64;
+
+    // were the counters compiled into the library?
+    static bool enabled();
+
+    // scheduler
+    uint64 delta_cycles() const           { return m_delta_cycles; }
+    uint64 time_steps() const             { return m_time_steps; }
+    uint64 method_runs() const            { return m_method_runs; }
+    uint64 thread_runs() const            { return m_thread_runs; }
+    uint64 max_methods_per_delta() const  { return m_max_methods_per_delta; }
+    uint64 max_threads_per_delta() const  { return m_max_threads_per_delta; }
+    uint64 context_switches() const       { return m_context_switches; }
+
+    // update phase
+    uint64 update_phases() const          { return m_update_phases; }
+    uint64 channel_updates() const        { return m_channel_updates; }
+    uint64 max_updates_per_phase() const  { return m_max_updates_per_phase; }
+    double update_host_time() const       { return 1e-9 * m_update_host_ns; }
+
+    // timed event queue, sampled at each time step
+    uint64 max_timed_queue_depth() const  { return m_max_timed_queue_depth; }
+    double avg_timed_queue_depth() const;
+
+    // sc_event::notify() and friends
+    uint64 immediate_notifications() const { return m_immediate_notifications; }
+    uint64 delta_notifications() const     { return m_delta_notifications; }
+    uint64 timed_notifications() const     { return m_timed_notifications; }
+    uint64 cancellations() const           { return m_cancellations; }
+
+    // the existing processes, with the largest host time first
+    std::vector<process_info> processes() const;
+
+    // restart counting, including the counters of the processes
+    void reset();
+
+    // print the counters and the top_n processes with the largest host time
+    void print( ::std::ostream& os = ::std::cout,
+                std::size_t top_n = 20 ) const;
+
+    // print the counters to std::cout at the end of the simulation (also
+    // selected by a non-zero SC_KERNEL_STATS environment variable)
+    void dump_at_end_of_simulation( bool dump )
+        { m_dump = dump; }
+
+public: // kernel internal, see SC_KERNEL_STATS_
+
+    void switch_to( sc_process_b* next_p, bool new_run = true );
+    void context_switch()
+        { ++m_context_switches; }
+    void end_of_delta();
+    void time_step( std::size_t timed_queue_depth );
+    void update_phase( std::size_t updates_n, uint64 host_ns );
+    void parallel_methods( std::size_t methods_n )
+        { m_method_runs += methods_n; m_delta_methods += methods_n; }
+    void immediate_notification()
+        { ++m_immediate_notifications; }
+    void delta_notification()
+        { ++m_delta_notifications; }
+    void timed_notification()
+        { ++m_timed_notifications; }
+    void cancellation()
+        { ++m_cancellations; }
+
+    // print the counters if selected by dump_at_end_of_simulation()
+    void end_of_simulation() const;
+
+    // monotonic host time in nanoseconds
+    static uint64 host_time_ns();
+
+private:
+
+    explicit sc_kernel_stats( sc_simcontext* simc_p );
+
+    void clear();
+
+private:
+    sc_simcontext* m_simc;
+    sc_process_b*  m_running_p;       // process charged for host time.
+    uint64         m_switch_ns;       // host time of the last switch.
+    bool           m_dump;            // print at the end of simulation.
+
+    uint64 m_delta_cycles;
+    uint64 m_time_steps;
+    uint64 m_method_runs;
+    uint64 m_thread_runs;
+    uint64 m_delta_methods;           // methods run in this delta cycle.
+    uint64 m_delta_threads;           // threads run in this delta cycle.
+    uint64 m_max_methods_per_delta;
+    uint64 m_max_threads_per_delta;
+    uint64 m_context_switches;
+
+    uint64 m_update_phases;
+    uint64 m_channel_updates;
+    uint64 m_max_updates_per_phase;
+    uint64 m_update_host_ns;
+
+    uint64 m_timed_queue_samples;     // sum of the sampled depths.
+    uint64 m_max_timed_queue_depth;
+
+    uint64 m_immediate_notifications;
+    uint64 m_delta_notifications;
+    uint64 m_timed_notifications;
+    uint64 m_cancellations;
+
+private:
+    // disabled
+    sc_kernel_stats( const sc_kernel_stats& );
+    sc_kernel_stats& operator = ( const sc_kernel_stats& );
+};
+
+// the counters of the current simulation context
+SC_API sc_kernel_stats& sc_get_kernel_stats();
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_KERNEL_STATS_H_INCLUDED_
+// Taf!
@@ -31,6 +31,7 @@
 #include "sysc/kernel/sc_cmnhdr.h"
 #include "sysc/kernel/sc_externs.h"
 #include "sysc/kernel/sc_except.h"
+#include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_ver.h"
 #include "sysc/utils/sc_report.h"
 #include "sysc/utils/sc_report_handler.h"
@@ -88,6 +89,14 @@ sc_elab_and_sim( int argc, char* argv[] )
         std::vector<char*> argv_call = argv_copy;
         status = sc_main( argc, &argv_call[0] );
 
+        // a simulation ended without sc_stop() has no end of simulation
+        if ( sc_curr_simcontext && sc_start_of_simulation_invoked()
+             && !sc_end_of_simulation_invoked() )
+        {
+            sc_get_kernel_stats().end_of_simulation();
+            sc_get_process_profiler().end_of_simulation();
+        }
+
         // Perform cleanup here
         sc_in_action = false;
     }
@@ -106,6 +115,10 @@ sc_elab_and_sim( int argc, char* argv[] )
         delete err_p;
     }
 
+    // write the output of the trace files not closed, also after an error
+    if ( sc_curr_simcontext )
+        sc_curr_simcontext->flush_trace_files();
+
     for ( int i = 0; i < argc; ++i ) {
         delete[] argv_copy[i];
     }
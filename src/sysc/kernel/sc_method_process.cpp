@@ -307,7 +307,7 @@ sc_method_process::sc_method_process( const char* name_p,
     sc_process_b(
         name_p ? name_p : sc_gen_unique_name("method_p"),
         false, free_host, method_p, host_p, opt_p),
-	m_cor(0), m_stack_size(0), m_monitor_q()
+	m_cor(0), m_stack_size(0), m_monitor_q(), m_rank(0)
 {
 
     // CHECK IF THIS IS AN sc_module-BASED PROCESS AND SIMUALTION HAS STARTED:
@@ -325,6 +325,7 @@ sc_method_process::sc_method_process( const char* name_p,
     m_process_kind = SC_METHOD_PROC_;
     if (opt_p) {
         m_dont_init = opt_p->m_dont_initialize;
+        m_parallel_safe = opt_p->m_parallel_safe;
 
         // traverse event sensitivity list
         for (unsigned int i = 0; i < opt_p->m_sensitive_events.size(); i++) {
@@ -627,11 +628,37 @@ void sc_method_process::throw_user( const sc_throw_it_helper& helper,
 //------------------------------------------------------------------------------
 //"sc_method_process::trigger_dynamic"
 //
+// This method is called by an event this object instance is registered
+// with. The events of the persistent event list the method is bound to keep
+// the registration, whether the method currently waits for them or not, so
+// their triggers are passed on only while it does.
+//
+// Result is true if this process should be removed from the event's list,
+// false if not.
+//------------------------------------------------------------------------------
+bool sc_method_process::trigger_dynamic( sc_event* e )
+{
+    if ( SC_UNLIKELY_( m_bound_list_p != 0 ) && m_bound_list_p->contains( e ) )
+    {
+        if ( m_event_list_p == m_bound_list_p )
+        {
+            trigger_awaited( e );
+            return false;
+        }
+        if ( !awaits_dynamic( e ) )
+            return false;
+    }
+    return trigger_awaited( e );
+}
+
+//------------------------------------------------------------------------------
+//"sc_method_process::trigger_awaited"
+//
 // This method sets up a dynamic trigger on an event.
 //
 // Notes:
-//   (1) This method is identical to sc_thread_process::trigger_dynamic(),
-//       but they cannot be combined as sc_process_b::trigger_dynamic()
+//   (1) This method is identical to sc_thread_process::trigger_awaited(),
+//       but they cannot be combined as sc_process_b::trigger_awaited()
 //       because the signatures things like sc_event::remove_dynamic()
 //       have different overloads for sc_method_process* and sc_thread_process*.
 //       So if you change code here you'll also need to change it in
@@ -644,7 +671,7 @@ void sc_method_process::throw_user( const sc_throw_it_helper& helper,
 // ignored as well, unless SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 // is defined.
 //------------------------------------------------------------------------------
-bool sc_method_process::trigger_dynamic( sc_event* e )
+bool sc_method_process::trigger_awaited( sc_event* e )
 {
     // No time outs yet, and keep gcc happy.
 
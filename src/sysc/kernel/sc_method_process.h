@@ -110,6 +110,7 @@ class sc_method_process : public sc_process_b {
     friend class sc_process_table;
     friend class sc_process_handle;
     friend class sc_simcontext;
+    friend class sc_parallel_engine;
     friend class sc_runnable;
 
     friend void next_trigger( sc_simcontext* );
@@ -165,15 +166,17 @@ class sc_method_process : public sc_process_b {
     virtual void throw_reset( bool async );
     virtual void throw_user( const sc_throw_it_helper& helper,
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
+    bool trigger_awaited( sc_event* );
     bool trigger_dynamic( sc_event* );
-    inline void trigger_static();
+    inline void trigger_static( const sc_process_b* curr_proc_p );
 
   protected:
     sc_cor*                          m_cor;        // Thread's coroutine.
     std::size_t                      m_stack_size; // Thread stack size.
     std::vector<sc_process_monitor*> m_monitor_q;  // Thread monitors.
+    unsigned                         m_rank;       // Compressed chain level.
 
-  private:
+  protected:
     // may not be deleted manually (called from sc_process_b)
     virtual ~sc_method_process();
 
@@ -198,8 +201,9 @@ void
 sc_method_process::next_trigger( const sc_event_or_list& el )
 {
     clear_trigger();
-    el.add_dynamic( this );
-    m_event_list_p = &el;
+    const sc_event_or_list& list = el.outlive_expression();
+    list.add_dynamic( this );
+    m_event_list_p = &list;
     m_trigger_type = OR_LIST;
 }
 
@@ -208,9 +212,10 @@ void
 sc_method_process::next_trigger( const sc_event_and_list& el )
 {
     clear_trigger();
-    el.add_dynamic( this );
-    m_event_list_p = &el;
-    m_event_count = el.size();
+    const sc_event_and_list& list = el.outlive_expression();
+    list.add_dynamic( this );
+    m_event_list_p = &list;
+    m_event_count = list.size();
     m_trigger_type = AND_LIST;
 }
 
@@ -243,8 +248,9 @@ sc_method_process::next_trigger( const sc_time& t, const sc_event_or_list& el )
     clear_trigger();
     m_timeout_event_p->notify_internal( t );
     m_timeout_event_p->add_dynamic( this );
-    el.add_dynamic( this );
-    m_event_list_p = &el;
+    const sc_event_or_list& list = el.outlive_expression();
+    list.add_dynamic( this );
+    m_event_list_p = &list;
     m_trigger_type = OR_LIST_TIMEOUT;
 }
 
@@ -255,9 +261,10 @@ sc_method_process::next_trigger( const sc_time& t, const sc_event_and_list& el )
     clear_trigger();
     m_timeout_event_p->notify_internal( t );
     m_timeout_event_p->add_dynamic( this );
-    el.add_dynamic( this );
-    m_event_list_p = &el;
-    m_event_count = el.size();
+    const sc_event_and_list& list = el.outlive_expression();
+    list.add_dynamic( this );
+    m_event_list_p = &list;
+    m_event_count = list.size();
     m_trigger_type = AND_LIST_TIMEOUT;
 }
 
@@ -332,24 +339,26 @@ inline bool sc_method_process::run_process()
 //       dynamic event waits take priority.
 //
 //
-// If the triggering process is the same process, the trigger is
-// ignored as well, unless SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
+// If the triggering process curr_proc_p is the same process, the trigger
+// is ignored as well, unless SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 // is defined.
 //------------------------------------------------------------------------------
 inline
 void
-sc_method_process::trigger_static()
+sc_method_process::trigger_static( const sc_process_b* curr_proc_p )
 {
     if ( (m_state & ps_bit_disabled) || is_runnable() ||
           m_trigger_type != STATIC )
         return;
 
 #if ! defined( SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS )
-    if( SC_UNLIKELY_( sc_get_current_process_b() == this ) )
+    if( SC_UNLIKELY_( curr_proc_p == this ) )
     {
         report_immediate_self_notification();
         return;
     }
+#else
+    (void) curr_proc_p;
 #endif // SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 
     // If we get here then the method is has satisfied its wait, if its 
@@ -180,6 +180,7 @@ sc_module::sc_module()
   sensitive_pos(this),
   sensitive_neg(this),
   m_end_module_called(false),
+  m_delta_compression(false),
   m_port_vec(),
   m_port_index(0),
   m_name_gen(0),
@@ -207,6 +208,7 @@ sc_module::sc_module( const sc_module_name& )
   sensitive_pos(this),
   sensitive_neg(this),
   m_end_module_called(false),
+  m_delta_compression(false),
   m_port_vec(),
   m_port_index(0),
   m_name_gen(0),
@@ -240,6 +242,7 @@ sc_module::sc_module( const char* nm )
   sensitive_pos(this),
   sensitive_neg(this),
   m_end_module_called(false),
+  m_delta_compression(false),
   m_port_vec(),
   m_port_index(0),
   m_name_gen(0),
@@ -255,6 +258,7 @@ sc_module::sc_module( const std::string& s )
   sensitive_pos(this),
   sensitive_neg(this),
   m_end_module_called(false),
+  m_delta_compression(false),
   m_port_vec(),
   m_port_index(0),
   m_name_gen(0),
@@ -338,6 +342,15 @@ sc_module::dont_initialize()
     last_proc.dont_initialize( true );
 }
 
+// to allow evaluation of SC_METHODs on the parallel worker pool
+
+void
+sc_module::parallel_safe()
+{
+    sc_process_handle last_proc = sc_get_last_created_process_handle();
+    last_proc.parallel_safe( true );
+}
+
 // set SC_THREAD synchronous reset sensitivity
 
 void
@@ -148,6 +148,13 @@ public:
 
     const ::std::vector<sc_object*>& get_child_objects() const;
 
+    // update the signals of this module and its child modules within the
+    // delta cycle of the write (see sc_signal_channel::set_delta_compression)
+    void set_delta_compression( bool on = true )
+        { m_delta_compression = on; }
+    bool delta_compression() const
+        { return m_delta_compression; }
+
 protected:
 
     // this must be called by user-defined modules
@@ -157,6 +164,9 @@ protected:
     // to prevent initialization for SC_METHODs and SC_THREADs
     void dont_initialize();
 
+    // to allow evaluation of SC_METHODs on the parallel worker pool
+    void parallel_safe();
+
     // positional binding code - used by operator ()
 
     void positional_bind( sc_interface& );
@@ -307,6 +317,7 @@ private:
 private:
 
     bool                        m_end_module_called;
+    bool                        m_delta_compression;
     std::vector<sc_port_base*>* m_port_vec;
     int                         m_port_index;
     sc_name_gen*                m_name_gen;
@@ -45,6 +45,7 @@ sc_module_name::sc_module_name( const char* name_ )
   m_pushed( true )
 {
     m_simc->get_object_manager()->push_module_name( this );
+    m_simc->elab_profiler().module_begin();
 }
 
 sc_module_name::sc_module_name( const sc_module_name& name_ )
@@ -63,6 +64,7 @@ sc_module_name::~sc_module_name()
             SC_REPORT_ERROR( SC_ID_SC_MODULE_NAME_USE_, 0 );
         }
 	if ( m_module_p ) m_module_p->end_module();
+	m_simc->elab_profiler().module_end( m_module_p );
     }
 }
 
@@ -83,9 +83,8 @@ sc_object::add_child_object( sc_object* object_ )
 const char*
 sc_object::basename() const
 {
-    std::size_t pos; // position of last SC_HIERARCHY_CHAR.
-    pos = m_name.rfind( (char)SC_HIERARCHY_CHAR );
-    return ( pos == m_name.npos ) ? m_name.c_str() : &(m_name.c_str()[pos+1]);
+    const char* p = std::strrchr( m_name, (char)SC_HIERARCHY_CHAR );
+    return p ? (p + 1) : m_name;
 } 
 
 void
@@ -187,14 +186,14 @@ sc_object::sc_object_init(const char* nm)
 } 
 
 sc_object::sc_object() : 
-    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(),
+    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(""),
     m_parent(0), m_simc(0)
 {
     sc_object_init( sc_gen_unique_name("object") );
 }
 
 sc_object::sc_object( const sc_object& that ) : 
-    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(),
+    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(""),
     m_parent(0), m_simc(0)
 {
     sc_object_init( sc_gen_unique_name( that.basename() ) );
@@ -208,7 +207,7 @@ object_name_illegal_char(char ch)
 }
 
 sc_object::sc_object(const char* nm) : 
-    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(),
+    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(""),
     m_parent(0), m_simc(0)
 {
     int namebuf_alloc = 0;
@@ -221,26 +220,21 @@ sc_object::sc_object(const char* nm) :
         nm = sc_gen_unique_name("object");
     p = nm;
 
+    // only copy the name if characters must be substituted.
+
     if (nm && sc_enable_name_checking) {
-        namebuf_alloc = 1 + std::strlen(nm);
-        namebuf = (char*) sc_mempool::allocate(namebuf_alloc);
-        char* q = namebuf;
         const char* r = nm;
-        bool has_illegal_char = false;
-        while (*r) {
-            if (object_name_illegal_char(*r)) {
-                has_illegal_char = true;
-                *q = '_';
-            } else {
-                *q = *r;
-            }
+        while (*r && !object_name_illegal_char(*r))
             r++;
-            q++;
-        }
-        *q = '\0';
-        p = namebuf;
-        if (has_illegal_char)
-	{
+        if (*r) {
+            namebuf_alloc = 1 + std::strlen(nm);
+            namebuf = (char*) sc_mempool::allocate(namebuf_alloc);
+            char* q = namebuf;
+            for (r = nm; *r; r++, q++)
+                *q = object_name_illegal_char(*r) ? '_' : *r;
+            *q = '\0';
+            p = namebuf;
+
 	    std::string message = nm;
 	    message += " substituted by ";
 	    message += namebuf;
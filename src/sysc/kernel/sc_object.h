@@ -40,6 +40,7 @@
 
 namespace sc_core {
 
+class SC_API sc_checkpoint_archive;
 class SC_API sc_event;
 class SC_API sc_module;
 class sc_phase_callback_registry;
@@ -56,6 +57,7 @@ class SC_API sc_trace_file_base;
 
 class SC_API sc_object 
 {
+    friend class sc_checkpoint;
     friend class sc_event;
     friend class sc_module;
     friend struct sc_invoke_method;
@@ -71,7 +73,7 @@ public:
     typedef unsigned phase_cb_mask;
 
     const char* name() const
-        { return m_name.c_str(); }
+        { return m_name; }
 
     const char* basename() const;
 
@@ -135,6 +137,10 @@ protected:
     phase_cb_mask register_simulation_phase_callback( phase_cb_mask );
     phase_cb_mask unregister_simulation_phase_callback( phase_cb_mask );
 
+    // save or restore the state of this object in a checkpoint
+    virtual void checkpoint_state( sc_checkpoint_archive& )
+        {}
+
     class hierarchy_scope;
 
 private:
@@ -152,7 +158,7 @@ private:
     mutable sc_attr_cltn*   m_attr_cltn_p;   // attributes for this object.
     std::vector<sc_event*>  m_child_events;  // list of child events.
     std::vector<sc_object*> m_child_objects; // list of child objects.
-    std::string             m_name;          // name of this object.
+    const char*             m_name;          // name, in the object manager.
     sc_object*              m_parent;        // parent for this object.
     sc_simcontext*          m_simc;          // simcontext ptr / empty indicator
 };
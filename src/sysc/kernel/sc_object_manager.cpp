@@ -32,7 +32,7 @@
 #include <cassert>
 #include <cctype>
 #include <cstddef>
-#include <cctype>
+#include <cstring>
 #include <algorithm> // pick up std::sort.
 
 #include "sysc/kernel/sc_object.h"
@@ -49,6 +49,33 @@
 
 namespace sc_core {
 
+namespace {
+
+// FNV-1a hash, continued over the supplied characters, so that the hash of
+// a hierarchical name can be computed from the hash of its parent's name.
+
+const std::size_t name_hash_basis =
+    static_cast<std::size_t>(14695981039346656037ULL);
+const std::size_t name_hash_prime =
+    static_cast<std::size_t>(1099511628211ULL);
+
+inline std::size_t
+name_hash(std::size_t hash, const char* chars_p, std::size_t chars_n)
+{
+    for ( std::size_t i = 0; i < chars_n; ++i )
+    {
+        hash ^= static_cast<unsigned char>(chars_p[i]);
+        hash *= name_hash_prime;
+    }
+    return hash;
+}
+
+const std::size_t name_block_size = 64 * 1024; // size of the arena blocks.
+
+} // anonymous namespace
+
+const std::size_t sc_object_manager::npos;
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_object_manager
 //
@@ -56,11 +83,13 @@ namespace sc_core {
 // ----------------------------------------------------------------------------
 
 sc_object_manager::sc_object_manager() :
-    m_event_it(),
-    m_event_walk_ok(0),
+    m_buckets(),
+    m_name_blocks(),
+    m_name_free_p(0),
+    m_name_free_n(0),
     m_instance_table(),
     m_module_name_stack(0),
-    m_object_it(),
+    m_object_it(0),
     m_object_stack(),
     m_object_walk_ok()
 {
@@ -71,19 +100,29 @@ sc_object_manager::sc_object_manager() :
 // | 
 // | This is the object instance destructor for this class. It goes through
 // | each sc_object instance in the instance table and sets its m_simc field
-// | to NULL.
+// | to NULL. The arena of names is only released if no object or event
+// | refers to it any longer.
 // +----------------------------------------------------------------------------
 sc_object_manager::~sc_object_manager()
 {
-    instance_table_t::iterator it;     // instance table iterator.
+    bool names_in_use = false; // true if objects or events remain.
 
-    for ( it = m_instance_table.begin(); it != m_instance_table.end(); it++) 
+    for ( std::size_t i = 0; i < m_instance_table.size(); i++ ) 
     {
-        if(it->second.m_name_origin == SC_NAME_OBJECT) {
-            sc_object* obj_p = static_cast<sc_object*>(it->second.m_element_p);
+        table_entry& entry = m_instance_table[i];
+        if(entry.m_name_origin == SC_NAME_OBJECT) {
+            sc_object* obj_p = static_cast<sc_object*>(entry.m_element_p);
             obj_p->m_simc = 0;
+            names_in_use = true;
+        } else if(entry.m_name_origin == SC_NAME_EVENT) {
+            names_in_use = true;
         }
     }
+    if ( !names_in_use )
+    {
+        for ( std::size_t i = 0; i < m_name_blocks.size(); i++ )
+            delete [] m_name_blocks[i];
+    }
 }
 
 // +----------------------------------------------------------------------------
@@ -95,65 +134,41 @@ sc_object_manager::~sc_object_manager()
 // |
 // | Arguments:
 // |     leaf_name = name to use for the leaf of the hierarchy.
-// | Result is an std::string containing the name.
+// | Result is the name interned in the arena of this object manager.
 // +----------------------------------------------------------------------------
-std::string sc_object_manager::create_name(const char* leaf_name) 
+const char* sc_object_manager::create_name(const char* leaf_name) 
 { 
-    bool        clash;                  // true if path name exists in obj table
+    std::size_t entry;                  // entry of the name in the table.
     std::string leafname_string;        // string containing the leaf name.
-    std::string parentname_string;      // parent path name 
     sc_object*  parent_p;               // parent for this instance or NULL.
     std::string result_orig_string;     // save for warning message.
-    std::string result_string;          // name to return.
  
-    // CONSTRUCT PATHNAME TO THE NAME TO BE RETURNED:
-    // 
-    // If there is not a leaf name generate one. 
-
-    parent_p = sc_get_curr_simcontext()->active_object();
-    parentname_string = parent_p ? parent_p->name() : ""; 
-    leafname_string = leaf_name; 
-    if (parent_p) {
-        result_string = parentname_string;
-	result_string += SC_HIERARCHY_CHAR;
-	result_string += leafname_string;
-    } else { 
-        result_string = leafname_string;
-    } 
-
-    // SAVE the original path name 
-
-    result_orig_string = result_string;
-
     // MAKE SURE THE ENTITY NAME IS UNIQUE:
     // 
     // If not use unique name generator to make it unique. 
 
-    clash = false; 
-    for (;;)
+    parent_p = sc_get_curr_simcontext()->active_object();
+    entry = lookup(parent_p, leaf_name, true);
+    if ( m_instance_table[entry].m_name_origin == SC_NAME_NONE )
+    {
+        return m_instance_table[entry].m_name;
+    }
+
+    result_orig_string = m_instance_table[entry].m_name;
+    leafname_string = leaf_name; 
+    do
     {
-	    if ( !name_exists(result_string) )
-	    {
-	        break;
-	    }
-        clash = true; 
         leafname_string = sc_gen_unique_name(leafname_string.c_str(), false); 
-	if (parent_p) {
-	    result_string = parentname_string;
-	    result_string += SC_HIERARCHY_CHAR;
-	    result_string += leafname_string;
-	} else { 
-	    result_string = leafname_string;
-	} 
-    } 
-    if (clash) { 
-	std::string message = result_orig_string;
-	message += ". Latter declaration will be renamed to ";
-	message += result_string;
-        SC_REPORT_WARNING( SC_ID_INSTANCE_EXISTS_, message.c_str());
+        entry = lookup(parent_p, leafname_string.c_str(), true);
     } 
+    while ( m_instance_table[entry].m_name_origin != SC_NAME_NONE );
+
+    std::string message = result_orig_string;
+    message += ". Latter declaration will be renamed to ";
+    message += m_instance_table[entry].m_name;
+    SC_REPORT_WARNING( SC_ID_INSTANCE_EXISTS_, message.c_str());
 
-    return result_string;
+    return m_instance_table[entry].m_name;
 }
 
 // +----------------------------------------------------------------------------
@@ -163,15 +178,17 @@ std::string sc_object_manager::create_name(const char* leaf_name)
 // | or false if the element does not exist.
 // |
 // | Arguments:
-// |     name = name of the element
+// |     parent_p  -> parent of the element or NULL.
+// |     leaf_name =  leaf name of the element
 // | Result is a boolean
 // +----------------------------------------------------------------------------
 bool
-sc_object_manager::name_exists(const std::string& name)
+sc_object_manager::name_exists(const sc_object* parent_p,
+                               const char* leaf_name)
 {
-    instance_table_t::const_iterator it = m_instance_table.find(name);
-    return (it != m_instance_table.end()) &&
-           (it->second.m_name_origin != SC_NAME_NONE);
+    std::size_t entry = lookup(parent_p, leaf_name, false);
+    return (entry != npos) &&
+           (m_instance_table[entry].m_name_origin != SC_NAME_NONE);
 }
 
 // +----------------------------------------------------------------------------
@@ -181,21 +198,67 @@ sc_object_manager::name_exists(const std::string& name)
 // | hierarchy or NULL if it doesn't exist.
 // |
 // | Arguments:
-// |     name = name of the element
+// |     parent_p  -> parent of the element or NULL.
+// |     leaf_name =  leaf name of the element
 // | Result is a pointer to the name or NULL if it doesn't exist.
 // +----------------------------------------------------------------------------
 const char*
-sc_object_manager::get_name(const std::string& name)
+sc_object_manager::get_name(const sc_object* parent_p, const char* leaf_name)
 {
-    instance_table_t::iterator it = m_instance_table.find(name);
-    if (it != m_instance_table.end() &&
-        it->second.m_name_origin != SC_NAME_NONE) {
-        return it->first.c_str();
+    std::size_t entry = lookup(parent_p, leaf_name, false);
+    if (entry != npos &&
+        m_instance_table[entry].m_name_origin != SC_NAME_NONE) {
+        return m_instance_table[entry].m_name;
     } else {
         return NULL;
     }
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::find_entry"
+// | 
+// | This method returns the index of the entry with the supplied name in
+// | the instance table, or npos if there is none. The name is the parent
+// | name, if any, and the leaf name separated by SC_HIERARCHY_CHAR.
+// |
+// | Arguments:
+// |     parent_name = name of the parent or NULL.
+// |     parent_n    = length of the parent name.
+// |     leaf_name   = leaf name.
+// |     leaf_n      = length of the leaf name.
+// |     hash        = hash of the name.
+// | Result is the index of the entry or npos.
+// +----------------------------------------------------------------------------
+std::size_t
+sc_object_manager::find_entry(const char* parent_name, std::size_t parent_n,
+                              const char* leaf_name, std::size_t leaf_n,
+                              std::size_t hash) const
+{
+    if ( m_buckets.empty() ) return npos;
+
+    std::size_t length = parent_name ? parent_n + 1 + leaf_n : leaf_n;
+    std::size_t mask = m_buckets.size() - 1;
+    for ( std::size_t bucket = hash & mask; ; bucket = (bucket + 1) & mask )
+    {
+        std::size_t entry = m_buckets[bucket];
+        if ( entry == npos ) return npos;
+
+        const char*        name_p = m_instance_table[entry].m_name;
+        const name_record* record_p = record_of(name_p);
+        if ( record_p->m_hash != hash || record_p->m_length != length )
+            continue;
+        if ( parent_name )
+        {
+            if ( std::memcmp(name_p, parent_name, parent_n) != 0 ||
+                 name_p[parent_n] != SC_HIERARCHY_CHAR )
+                continue;
+            name_p += parent_n + 1;
+        }
+        if ( std::memcmp(name_p, leaf_name, leaf_n) == 0 )
+            return entry;
+    }
+}
+
 // +----------------------------------------------------------------------------
 // |"sc_object_manager::find_event"
 // | 
@@ -209,12 +272,11 @@ sc_object_manager::get_name(const std::string& name)
 sc_event*
 sc_object_manager::find_event(const char* name)
 {
-    instance_table_t::iterator it;
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EVENT)
+    std::size_t entry = lookup(NULL, name, false);
+    if(entry != npos
+       && m_instance_table[entry].m_name_origin == SC_NAME_EVENT)
     {
-        return static_cast<sc_event*>(it->second.m_element_p);
+        return static_cast<sc_event*>(m_instance_table[entry].m_element_p);
     } else {
         return NULL;
     }
@@ -233,12 +295,11 @@ sc_object_manager::find_event(const char* name)
 sc_object*
 sc_object_manager::find_object(const char* name)
 {
-    instance_table_t::iterator it;
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_OBJECT)
+    std::size_t entry = lookup(NULL, name, false);
+    if(entry != npos
+       && m_instance_table[entry].m_name_origin == SC_NAME_OBJECT)
     {
-        return static_cast<sc_object*>(it->second.m_element_p);
+        return static_cast<sc_object*>(m_instance_table[entry].m_element_p);
     } else {
         return NULL;
     }
@@ -250,7 +311,8 @@ sc_object_manager::find_object(const char* name)
 // | 
 // | This method initializes the object iterator to point to the first object
 // | in the instance table, and returns its address. If there are no objects
-// | in the table a NULL value is returned.
+// | in the table a NULL value is returned. The objects are visited in the
+// | order in which their names were first created.
 // +----------------------------------------------------------------------------
 sc_object*
 sc_object_manager::first_object()
@@ -259,12 +321,13 @@ sc_object_manager::first_object()
 
     m_object_walk_ok = true;
     result_p = NULL;
-    for ( m_object_it = m_instance_table.begin(); 
-          m_object_it != m_instance_table.end(); 
+    for ( m_object_it = 0; 
+          m_object_it != m_instance_table.size(); 
 	  m_object_it++ )
     {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
+        const table_entry& entry = m_instance_table[m_object_it];
+        if(entry.m_name_origin == SC_NAME_OBJECT) {
+            return static_cast<sc_object*>(entry.m_element_p);
         }
     }
     return result_p;
@@ -332,6 +395,7 @@ sc_object_manager::hierarchy_size()
     return m_object_stack.size();
 }
 
+
 // +----------------------------------------------------------------------------
 // |"sc_object_manager::insert_external_name"
 // |
@@ -339,19 +403,22 @@ sc_object_manager::hierarchy_size()
 // | the supplied name.
 // |
 // | Arguments:
-// |     name     =  external to be inserted.
+// |     parent_p  -> parent of the name or NULL.
+// |     leaf_name =  external to be inserted.
 // +----------------------------------------------------------------------------
 bool
-sc_object_manager::insert_external_name(const std::string& name)
+sc_object_manager::insert_external_name(const sc_object* parent_p,
+                                        const char* leaf_name)
 {
-    if(!name_exists(name)) {
-        m_instance_table[name].m_element_p = NULL;
-        m_instance_table[name].m_name_origin = SC_NAME_EXTERNAL;
+    std::size_t  entry = lookup(parent_p, leaf_name, true);
+    table_entry& element = m_instance_table[entry];
+    if(element.m_name_origin == SC_NAME_NONE) {
+        element.m_element_p = NULL;
+        element.m_name_origin = SC_NAME_EXTERNAL;
         return true;
     } else {
-        table_entry element = m_instance_table[name];
         std::stringstream msg;
-        msg << name << " ("
+        msg << element.m_name << " ("
             << ((element.m_name_origin == SC_NAME_OBJECT)
                 ? (static_cast<sc_object*>(element.m_element_p))->kind()
                 : (element.m_name_origin == SC_NAME_EVENT)
@@ -369,14 +436,15 @@ sc_object_manager::insert_external_name(const std::string& name)
 // | table using the supplied name.
 // |
 // | Arguments:
-// |     name    =  name of the event to be inserted.
+// |     name    =  name of the event to be inserted, from create_name().
 // |     event_p -> event to be inserted.
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
+sc_object_manager::insert_event(const char* name, sc_event* event_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(event_p);
-    m_instance_table[name].m_name_origin = SC_NAME_EVENT;
+    table_entry& entry = m_instance_table[record_of(name)->m_entry];
+    entry.m_element_p = static_cast<void*>(event_p);
+    entry.m_name_origin = SC_NAME_EVENT;
 }
 
 // +----------------------------------------------------------------------------
@@ -386,14 +454,134 @@ sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
 // | table using the supplied name.
 // |
 // | Arguments:
-// |     name     =  name of the event to be inserted.
+// |     name     =  name of the object to be inserted, from create_name().
 // |     object_p -> object to be inserted.
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::insert_object(const std::string& name, sc_object* object_p)
+sc_object_manager::insert_object(const char* name, sc_object* object_p)
+{
+    table_entry& entry = m_instance_table[record_of(name)->m_entry];
+    entry.m_element_p = static_cast<void*>(object_p);
+    entry.m_name_origin = SC_NAME_OBJECT;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::intern"
+// | 
+// | This method returns the index of the entry with the supplied name in
+// | the instance table, after creating the entry and copying the name into
+// | the arena if the name is new.
+// |
+// | Arguments:
+// |     see find_entry().
+// | Result is the index of the entry.
+// +----------------------------------------------------------------------------
+std::size_t
+sc_object_manager::intern(const char* parent_name, std::size_t parent_n,
+                          const char* leaf_name, std::size_t leaf_n,
+                          std::size_t hash)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(object_p);
-    m_instance_table[name].m_name_origin = SC_NAME_OBJECT;
+    std::size_t entry = find_entry(parent_name, parent_n,
+                                   leaf_name, leaf_n, hash);
+    if ( entry != npos ) return entry;
+
+    // ALLOCATE THE RECORD AND THE NAME FROM THE ARENA:
+
+    std::size_t length = parent_name ? parent_n + 1 + leaf_n : leaf_n;
+    std::size_t size = sizeof(name_record) + length + 1;
+    size = (size + sizeof(name_record) - 1)
+           / sizeof(name_record) * sizeof(name_record);
+    if ( size > m_name_free_n )
+    {
+        std::size_t block_size = std::max(size, name_block_size);
+        m_name_free_p = new char[block_size];
+        m_name_free_n = block_size;
+        m_name_blocks.push_back(m_name_free_p);
+    }
+    name_record* record_p = reinterpret_cast<name_record*>(m_name_free_p);
+    m_name_free_p += size;
+    m_name_free_n -= size;
+
+    entry = m_instance_table.size();
+    record_p->m_hash = hash;
+    record_p->m_length = length;
+    record_p->m_entry = entry;
+
+    char* name_p = reinterpret_cast<char*>(record_p + 1);
+    if ( parent_name )
+    {
+        std::memcpy(name_p, parent_name, parent_n);
+        name_p[parent_n] = SC_HIERARCHY_CHAR;
+        std::memcpy(name_p + parent_n + 1, leaf_name, leaf_n);
+    }
+    else
+    {
+        std::memcpy(name_p, leaf_name, leaf_n);
+    }
+    name_p[length] = '\0';
+
+    // ENTER THE NAME INTO THE TABLE, GROWING THE INDEX AT HALF LOAD:
+
+    m_instance_table.push_back(table_entry());
+    m_instance_table[entry].m_name = name_p;
+    if ( 2 * m_instance_table.size() > m_buckets.size() )
+    {
+        rehash(m_buckets.empty() ? 64 : 2 * m_buckets.size());
+    }
+    else
+    {
+        std::size_t mask = m_buckets.size() - 1;
+        std::size_t bucket = hash & mask;
+        while ( m_buckets[bucket] != npos )
+            bucket = (bucket + 1) & mask;
+        m_buckets[bucket] = entry;
+    }
+    return entry;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::lookup"
+// | 
+// | This method returns the index of the entry for the supplied leaf name
+// | below the supplied parent in the instance table. If the parent belongs
+// | to this object manager, the hash of the name is continued from the hash
+// | of the parent's name, otherwise it is computed from the parent's name.
+// |
+// | Arguments:
+// |     parent_p  -> parent of the element or NULL.
+// |     leaf_name =  leaf name of the element.
+// |     insert    =  true if the name is to be interned if it is new.
+// | Result is the index of the entry, or npos if it does not exist.
+// +----------------------------------------------------------------------------
+std::size_t
+sc_object_manager::lookup(const sc_object* parent_p, const char* leaf_name,
+                          bool insert)
+{
+    const char* parent_name = NULL;      // name of the parent or NULL.
+    std::size_t parent_n = 0;            // length of the parent name.
+    std::size_t hash = name_hash_basis;  // hash of the name.
+
+    if ( parent_p )
+    {
+        parent_name = parent_p->name();
+        if ( parent_p->m_simc &&
+             parent_p->m_simc->get_object_manager() == this )
+        {
+            parent_n = record_of(parent_name)->m_length;
+            hash = record_of(parent_name)->m_hash;
+        }
+        else
+        {
+            parent_n = std::strlen(parent_name);
+            hash = name_hash(hash, parent_name, parent_n);
+        }
+        hash = name_hash(hash, &SC_HIERARCHY_CHAR, 1);
+    }
+
+    std::size_t leaf_n = std::strlen(leaf_name);
+    hash = name_hash(hash, leaf_name, leaf_n);
+    return insert ? intern(parent_name, parent_n, leaf_name, leaf_n, hash)
+                  : find_entry(parent_name, parent_n, leaf_name, leaf_n, hash);
 }
 
 // +----------------------------------------------------------------------------
@@ -408,14 +596,15 @@ sc_object_manager::next_object()
 
     sc_assert( m_object_walk_ok );
 
-    if ( m_object_it == m_instance_table.end() ) return NULL;
+    if ( m_object_it == m_instance_table.size() ) return NULL;
     m_object_it++;
 
-    for ( result_p = NULL; m_object_it != m_instance_table.end(); 
+    for ( result_p = NULL; m_object_it != m_instance_table.size(); 
 	  m_object_it++ )
     {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
+        const table_entry& entry = m_instance_table[m_object_it];
+        if(entry.m_name_origin == SC_NAME_OBJECT) {
+            return static_cast<sc_object*>(entry.m_element_p);
         }
     }
     return result_p;
@@ -465,6 +654,32 @@ sc_object_manager::top_of_module_name_stack()
     return m_module_name_stack;
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::rehash"
+// | 
+// | This method rebuilds the hash index of the instance table with the
+// | supplied number of buckets, which must be a power of two.
+// |
+// | Arguments:
+// |     buckets_n = new number of buckets.
+// +----------------------------------------------------------------------------
+void
+sc_object_manager::rehash(std::size_t buckets_n)
+{
+    std::vector<std::size_t> buckets(buckets_n, npos);
+    std::size_t              mask = buckets_n - 1;
+
+    for ( std::size_t entry = 0; entry < m_instance_table.size(); entry++ )
+    {
+        std::size_t bucket =
+            record_of(m_instance_table[entry].m_name)->m_hash & mask;
+        while ( buckets[bucket] != npos )
+            bucket = (bucket + 1) & mask;
+        buckets[bucket] = entry;
+    }
+    m_buckets.swap(buckets);
+}
+
 // +----------------------------------------------------------------------------
 // |"sc_object_manager::remove_event"
 // | 
@@ -472,18 +687,16 @@ sc_object_manager::top_of_module_name_stack()
 // | the table of instances.
 // |
 // | Arguments:
-// |     name = name of the event to be removed.
+// |     name = name of the event to be removed, from create_name().
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::remove_event(const std::string& name)
+sc_object_manager::remove_event(const char* name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EVENT)
+    table_entry& entry = m_instance_table[record_of(name)->m_entry];
+    if(entry.m_name_origin == SC_NAME_EVENT)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        entry.m_element_p = NULL;
+        entry.m_name_origin = SC_NAME_NONE;
     }
 }
 
@@ -494,18 +707,16 @@ sc_object_manager::remove_event(const std::string& name)
 // | the table of instances.
 // |
 // | Arguments:
-// |     name = name of the object to be removed.
+// |     name = name of the object to be removed, from create_name().
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::remove_object(const std::string& name)
+sc_object_manager::remove_object(const char* name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_OBJECT)
+    table_entry& entry = m_instance_table[record_of(name)->m_entry];
+    if(entry.m_name_origin == SC_NAME_OBJECT)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        entry.m_element_p = NULL;
+        entry.m_name_origin = SC_NAME_NONE;
     }
 }
 
@@ -516,18 +727,19 @@ sc_object_manager::remove_object(const std::string& name)
 // | the table of instances.
 // |
 // | Arguments:
-// |     name = external name to be removed.
+// |     parent_p  -> parent of the name or NULL.
+// |     leaf_name =  external name to be removed.
 // +----------------------------------------------------------------------------
 bool
-sc_object_manager::remove_external_name(const std::string& name)
+sc_object_manager::remove_external_name(const sc_object* parent_p,
+                                        const char* leaf_name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EXTERNAL)
+    std::size_t entry = lookup(parent_p, leaf_name, false);
+    if(entry != npos
+       && m_instance_table[entry].m_name_origin == SC_NAME_EXTERNAL)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        m_instance_table[entry].m_element_p = NULL;
+        m_instance_table[entry].m_name_origin = SC_NAME_NONE;
         return true;
     } else {
         return false;
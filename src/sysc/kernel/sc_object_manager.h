@@ -30,7 +30,8 @@
 #ifndef SC_OBJECT_MANAGER_H
 #define SC_OBJECT_MANAGER_H
 
-#include <map>
+#include <cstddef>
+#include <string>
 #include <vector>
 
 namespace sc_core {
@@ -44,6 +45,15 @@ class sc_module_name;
 //  CLASS : sc_object_manager
 //
 //  Manager of objects.
+//
+//  The hierarchical names are interned in an arena owned by the manager,
+//  each preceded by a record holding its hash and its entry in the table
+//  of instances. The names of the objects and events point into the arena,
+//  so an object finds its entry without a lookup, and the name of a child
+//  is hashed from the record of its parent and its leaf name, without
+//  concatenating them. The table is an open addressing hash index over
+//  the entries, which are never removed, so that interned names stay
+//  valid for the lifetime of the manager.
 // ----------------------------------------------------------------------------
 
 class sc_object_manager
@@ -63,21 +73,30 @@ protected:
 
     struct table_entry
     {
-        table_entry() : m_element_p(NULL), m_name_origin(SC_NAME_NONE) {}
+        table_entry() : m_name(NULL), m_element_p(NULL),
+                        m_name_origin(SC_NAME_NONE) {}
 
-	    void*          m_element_p; // can be an sc_object or an sc_event
+        const char*    m_name;      // interned hierarchical name.
+        void*          m_element_p; // can be an sc_object or an sc_event
         sc_name_origin m_name_origin;
     };
 
+    struct name_record             // precedes each name in the arena.
+    {
+        std::size_t m_hash;        // hash of the name.
+        std::size_t m_length;      // length of the name.
+        std::size_t m_entry;       // index of the entry in the table.
+    };
+
 public:
-    typedef std::map<std::string,table_entry> instance_table_t;
+    typedef std::vector<table_entry>          instance_table_t;
     typedef std::vector<sc_object*>           object_vector_t;
 
     sc_object_manager();
     ~sc_object_manager();
 
-    bool name_exists(const std::string& name);
-    const char* get_name(const std::string& name);
+    bool name_exists(const sc_object* parent_p, const char* leaf_name);
+    const char* get_name(const sc_object* parent_p, const char* leaf_name);
 
     sc_event* find_event(const char* name);
 
@@ -96,21 +115,40 @@ public:
 
 
 private:
-    std::string create_name( const char* leaf_name );
-    void insert_event(const std::string& name, sc_event* obj);
-    void insert_object(const std::string& name, sc_object* obj);
-    bool insert_external_name(const std::string& name);
-    void remove_event(const std::string& name);
-    void remove_object(const std::string& name);
-    bool remove_external_name(const std::string& name);
+    const char* create_name( const char* leaf_name );
+    void insert_event(const char* name, sc_event* obj);
+    void insert_object(const char* name, sc_object* obj);
+    bool insert_external_name(const sc_object* parent_p,
+                              const char* leaf_name);
+    void remove_event(const char* name);
+    void remove_object(const char* name);
+    bool remove_external_name(const sc_object* parent_p,
+                              const char* leaf_name);
+
+    // name table
+    static const name_record* record_of(const char* name)
+        { return reinterpret_cast<const name_record*>(name) - 1; }
+    std::size_t find_entry(const char* parent_name, std::size_t parent_n,
+                           const char* leaf_name, std::size_t leaf_n,
+                           std::size_t hash) const;
+    std::size_t intern(const char* parent_name, std::size_t parent_n,
+                       const char* leaf_name, std::size_t leaf_n,
+                       std::size_t hash);
+    std::size_t lookup(const sc_object* parent_p, const char* leaf_name,
+                       bool insert);
+    void rehash(std::size_t buckets_n);
+
+    static const std::size_t npos = ~static_cast<std::size_t>(0);
 
 private:
 
-    instance_table_t::iterator m_event_it;          // event instance iterator.
-    bool                       m_event_walk_ok;     // true if can walk events.
+    std::vector<std::size_t>   m_buckets;           // hash index of entries.
+    std::vector<char*>         m_name_blocks;       // arena of names.
+    char*                      m_name_free_p;       // free space in arena.
+    std::size_t                m_name_free_n;       // bytes free in arena.
     instance_table_t           m_instance_table;    // table of instances.
     sc_module_name*            m_module_name_stack; // sc_module_name stack.
-    instance_table_t::iterator m_object_it;         // object instance iterator.
+    std::size_t                m_object_it;         // object instance index.
     object_vector_t            m_object_stack;      // sc_object stack.
     bool                       m_object_walk_ok;    // true if can walk objects.
 };
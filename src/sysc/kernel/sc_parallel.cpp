@@ -0,0 +1,543 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_parallel.cpp -- Host-parallel execution of simulation kernel work.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_parallel.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_except.h"
+#include "sysc/kernel/sc_host_thread.h"
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/kernel/sc_wait.h"
+#include "sysc/communication/sc_host_mutex.h"
+#include "sysc/communication/sc_host_semaphore.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/tracing/sc_trace_file_base.h"
+#include "sysc/utils/sc_report_handler.h"
+
+#if SC_CPLUSPLUS >= 201103L
+# define SC_THREAD_LOCAL_ thread_local
+#elif defined(_MSC_VER)
+# define SC_THREAD_LOCAL_ __declspec(thread)
+#else
+# define SC_THREAD_LOCAL_ __thread
+#endif
+
+namespace sc_core {
+
+// frame of the process executed by this host thread (0 if none).
+
+static SC_THREAD_LOCAL_ sc_parallel_frame* curr_frame_p = 0;
+
+// serializes error reports issued on the worker pool.
+
+static sc_host_mutex parallel_report_mutex;
+
+// number of consecutive update list entries executed as one block, and the
+// minimum number of blocks for the update phase to use the worker pool.
+
+static const std::size_t update_block_size = 256;
+static const std::size_t update_blocks_min = 4;
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_worker_pool
+//
+//  Fixed set of host threads executing the indices of a job.
+// ----------------------------------------------------------------------------
+
+sc_worker_pool::sc_worker_pool( unsigned threads_n )
+  : m_threads(), m_mutex_p(0), m_start_p(0), m_done_p(0), m_job_p(0),
+    m_next(0), m_count(0), m_chunk(1), m_shutdown(false)
+{
+#if !defined(SC_DISABLE_PARALLEL_SIMULATION)
+    if ( threads_n < 2 )
+        return;
+
+    m_mutex_p = new sc_host_mutex;
+    m_start_p = new sc_host_semaphore;
+    m_done_p = new sc_host_semaphore;
+    for ( unsigned i = 1; i < threads_n; ++i )
+    {
+        sc_host_thread* thread_p = new sc_host_thread;
+        m_threads.push_back( thread_p );
+        thread_p->start( &worker_main, this );
+    }
+#else
+    (void)threads_n;
+#endif // SC_DISABLE_PARALLEL_SIMULATION
+}
+
+sc_worker_pool::~sc_worker_pool()
+{
+    m_shutdown = true;
+    for ( std::size_t i = 0; i < m_threads.size(); ++i )
+        m_start_p->post();
+    for ( std::size_t i = 0; i < m_threads.size(); ++i )
+    {
+        m_threads[i]->join();
+        delete m_threads[i];
+    }
+    delete m_done_p;
+    delete m_start_p;
+    delete m_mutex_p;
+}
+
+//------------------------------------------------------------------------------
+//"sc_worker_pool::run"
+//
+// This method executes the supplied job for indices 0 to count-1 and returns
+// when all of them are done. The calling thread executes indices as well.
+// Indices are handed out in chunks of roughly a quarter of a thread's share,
+// so that threads finishing early take over the remaining work.
+//------------------------------------------------------------------------------
+void sc_worker_pool::run( sc_parallel_job& job, std::size_t count )
+{
+    if ( m_threads.empty() || count < 2 )
+    {
+        for ( std::size_t i = 0; i < count; ++i )
+            job.execute( i );
+        return;
+    }
+
+    std::size_t helpers_n = m_threads.size();
+    if ( helpers_n > count - 1 )
+        helpers_n = count - 1;
+
+    m_job_p = &job;
+    m_next = 0;
+    m_count = count;
+    m_chunk = count / ( 4 * ( helpers_n + 1 ) );
+    if ( m_chunk == 0 )
+        m_chunk = 1;
+
+    for ( std::size_t i = 0; i < helpers_n; ++i )
+        m_start_p->post();
+    drain();
+    for ( std::size_t i = 0; i < helpers_n; ++i )
+        m_done_p->wait();
+
+    m_job_p = 0;
+}
+
+void sc_worker_pool::drain()
+{
+    for ( ;; )
+    {
+        std::size_t begin, end;
+        {
+            sc_scoped_lock lock( *m_mutex_p );
+            if ( m_next >= m_count )
+                return;
+            begin = m_next;
+            end = begin + m_chunk;
+            if ( end > m_count )
+                end = m_count;
+            m_next = end;
+        }
+        for ( std::size_t i = begin; i < end; ++i )
+            m_job_p->execute( i );
+    }
+}
+
+void sc_worker_pool::worker_main( void* pool_p )
+{
+    sc_worker_pool* pool = static_cast<sc_worker_pool*>( pool_p );
+    for ( ;; )
+    {
+        pool->m_start_p->wait();
+        if ( pool->m_shutdown )
+            return;
+        pool->drain();
+        pool->m_done_p->post();
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_parallel_frame
+//
+//  Execution state and deferred kernel operations of one process.
+// ----------------------------------------------------------------------------
+
+sc_parallel_frame::sc_parallel_frame()
+  : m_proc_info(), m_writer_p(0), m_ops(), m_reports(), m_reports_n(0),
+    m_error_p(0)
+{}
+
+sc_parallel_frame::~sc_parallel_frame()
+{
+    delete m_error_p;
+}
+
+sc_parallel_frame* sc_parallel_frame::current()
+{
+    return curr_frame_p;
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_frame::reset"
+//
+// This method prepares this frame for the execution of the supplied process.
+// The buffers keep their capacity, so a steady state batch does not allocate.
+//------------------------------------------------------------------------------
+void sc_parallel_frame::reset( sc_process_b* process_p, bool write_check )
+{
+    m_proc_info.process_handle = process_p;
+    m_proc_info.kind = process_p ? process_p->proc_kind() : SC_NO_PROC_;
+    m_writer_p = write_check ? process_p : 0;
+    m_ops.clear();
+    m_reports_n = 0;
+    delete m_error_p;
+    m_error_p = 0;
+}
+
+void sc_parallel_frame::record_report( sc_severity severity,
+                                       const char* msg_type, const char* msg,
+                                       int verbosity,
+                                       const char* file, int line )
+{
+    if ( m_reports_n == m_reports.size() )
+        m_reports.push_back( report_info() );
+    report_info& info = m_reports[m_reports_n++];
+    info.severity = severity;
+    info.msg_type = msg_type ? msg_type : "";
+    info.msg = msg ? msg : "";
+    info.file = file ? file : "";
+    info.line = line;
+    info.verbosity = verbosity;
+    record( REPORT, 0 );
+}
+
+void sc_parallel_frame::set_error( sc_report* error_p )
+{
+    delete m_error_p;
+    m_error_p = error_p;
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_parallel_engine
+//
+//  Per-simcontext driver of the host-parallel evaluate phase.
+// ----------------------------------------------------------------------------
+
+sc_parallel_engine::sc_parallel_engine( sc_simcontext* simc_p,
+                                        unsigned threads_n )
+  : m_simc( simc_p ), m_pool( threads_n ), m_batch(), m_frames(),
+    m_updates(), m_updating( false )
+{}
+
+sc_parallel_engine::~sc_parallel_engine()
+{
+    for ( std::size_t i = 0; i < m_frames.size(); ++i )
+        delete m_frames[i];
+}
+
+sc_host_mutex& sc_parallel_engine::report_mutex()
+{
+    return parallel_report_mutex;
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_engine::evaluate_methods"
+//
+// This method executes the run of parallel-safe methods at the head of the
+// runnable queue on the worker pool. The methods stay queued while they
+// execute. Afterwards each of them is popped in queue order and its deferred
+// operations are replayed with it as the current process, which yields the
+// same kernel state as executing them one after the other.
+//
+// If a method fails, the methods queued behind it have been executed as
+// well, unlike in sequential mode, where the error would stop the evaluate
+// phase before them. Since their effects on the model cannot be undone,
+// their deferred operations are replayed and they are popped like the
+// others, so the kernel state matches what they did. The error of the first
+// failed method in queue order is raised, those of later ones are dropped.
+//
+// Result is the number of methods executed, 0 if there were fewer than two
+// candidates, and -1 if one of the methods raised an error.
+//------------------------------------------------------------------------------
+int sc_parallel_engine::evaluate_methods()
+{
+    sc_runnable* runnable_p = m_simc->m_runnable;
+
+    m_batch.clear();
+    for ( sc_method_handle method_h = runnable_p->peek_method();
+          method_h != 0 && method_h->parallel_safe();
+          method_h = runnable_p->peek_method( method_h ) )
+    {
+        m_batch.push_back( method_h );
+    }
+
+    std::size_t batch_n = m_batch.size();
+    if ( batch_n < 2 )
+        return 0;
+
+    while ( m_frames.size() < batch_n )
+        m_frames.push_back( new sc_parallel_frame );
+    bool write_check = m_simc->write_check();
+    for ( std::size_t i = 0; i < batch_n; ++i )
+        m_frames[i]->reset( m_batch[i], write_check );
+
+    // EXECUTE THE BATCH:
+
+    m_simc->m_parallel_phase = true;
+    m_pool.run( *this, batch_n );
+    m_simc->m_parallel_phase = false;
+
+    // MERGE THE RESULTS IN QUEUE ORDER:
+
+    sc_report* error_p = 0;
+    for ( std::size_t i = 0; i < batch_n; ++i )
+    {
+        sc_parallel_frame& frame = *m_frames[i];
+        sc_method_handle method_h = m_simc->pop_runnable_method();
+        sc_assert( method_h == m_batch[i] );
+        replay( frame );
+        if ( frame.m_error_p && error_p == 0 )
+        {
+            error_p = frame.m_error_p;
+            frame.m_error_p = 0;
+        }
+    }
+    if ( error_p )
+    {
+        m_simc->set_error( error_p );
+        return -1;
+    }
+    return static_cast<int>( batch_n );
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_engine::perform_updates"
+//
+// This method executes the update phase for the supplied update list. The
+// list is split into blocks of consecutive entries, which are executed on
+// the worker pool. Within a block, only channels marked as parallel-safe are
+// updated on the pool; the others are deferred like any other kernel
+// operation. Replaying the blocks in list order then yields the same delta
+// event order as the sequential update phase.
+//
+// An error raised by an update is rethrown once the blocks before it have
+// been replayed, so it leaves perform_update() as it would sequentially.
+//------------------------------------------------------------------------------
+std::size_t sc_parallel_engine::perform_updates( sc_prim_channel* list_p )
+{
+    sc_prim_channel* const list_end =
+        reinterpret_cast<sc_prim_channel*>( sc_prim_channel::list_end );
+
+    m_updates.clear();
+    std::size_t safe_n = 0;
+    for ( sc_prim_channel* now_p = list_p; now_p != list_end;
+          now_p = now_p->m_update_next_p )
+    {
+        m_updates.push_back( now_p );
+        if ( now_p->parallel_update_safe() )
+            ++safe_n;
+    }
+
+    std::size_t updates_n = m_updates.size();
+    if ( m_pool.size() < 2 || safe_n < update_block_size * update_blocks_min )
+    {
+        for ( std::size_t i = 0; i < updates_n; ++i )
+            m_updates[i]->perform_update();
+        return updates_n;
+    }
+
+    std::size_t blocks_n = ( updates_n + update_block_size - 1 )
+                         / update_block_size;
+    while ( m_frames.size() < blocks_n )
+        m_frames.push_back( new sc_parallel_frame );
+    for ( std::size_t i = 0; i < blocks_n; ++i )
+        m_frames[i]->reset( 0, false );
+
+    // EXECUTE THE BLOCKS:
+
+    m_simc->m_parallel_phase = true;
+    m_updating = true;
+    m_pool.run( *this, blocks_n );
+    m_updating = false;
+    m_simc->m_parallel_phase = false;
+
+    // MERGE THE RESULTS IN LIST ORDER:
+
+    for ( std::size_t i = 0; i < blocks_n; ++i )
+    {
+        sc_parallel_frame& frame = *m_frames[i];
+        replay( frame );
+        if ( frame.m_error_p )
+        {
+            sc_report error( *frame.m_error_p );
+            throw error;
+        }
+    }
+    return updates_n;
+}
+
+void sc_parallel_engine::execute( std::size_t index )
+{
+    if ( m_updating )
+    {
+        execute_updates( index );
+        return;
+    }
+
+    curr_frame_p = m_frames[index];
+    m_batch[index]->run_process(); // errors end up in the frame.
+    curr_frame_p = 0;
+}
+
+void sc_parallel_engine::execute_updates( std::size_t block )
+{
+    sc_parallel_frame& frame = *m_frames[block];
+    std::size_t begin = block * update_block_size;
+    std::size_t end = begin + update_block_size;
+    if ( end > m_updates.size() )
+        end = m_updates.size();
+
+    curr_frame_p = &frame;
+    for ( std::size_t i = begin; i < end; ++i )
+    {
+        sc_prim_channel* channel_p = m_updates[i];
+        if ( !channel_p->parallel_update_safe() )
+        {
+            frame.record( sc_parallel_frame::PERFORM_UPDATE, channel_p );
+            continue;
+        }
+        try {
+            channel_p->perform_update();
+        }
+        catch( ... ) {
+            frame.set_error( sc_handle_exception() );
+            break;
+        }
+    }
+    curr_frame_p = 0;
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_engine::replay"
+//
+// This method performs the operations deferred in the supplied frame. The
+// frame's process must be the current process of the simulation context.
+//------------------------------------------------------------------------------
+void sc_parallel_engine::replay( sc_parallel_frame& frame )
+{
+    typedef std::vector<sc_parallel_frame::op>::const_iterator op_iterator;
+
+    std::size_t report_i = 0;
+    for ( op_iterator it = frame.m_ops.begin(); it != frame.m_ops.end(); ++it )
+    {
+        void*          object_p = const_cast<void*>( it->object_p );
+        sc_event*      event_p = static_cast<sc_event*>( object_p );
+        const sc_time& t = it->time;
+
+        switch( it->kind )
+        {
+          case sc_parallel_frame::REQUEST_UPDATE:
+            static_cast<sc_prim_channel*>( object_p )->request_update();
+            break;
+          case sc_parallel_frame::NOTIFY:
+            event_p->notify();
+            break;
+          case sc_parallel_frame::NOTIFY_TIMED:
+            event_p->notify( t );
+            break;
+          case sc_parallel_frame::NOTIFY_DELAYED:
+            event_p->notify_delayed();
+            break;
+          case sc_parallel_frame::NOTIFY_DELAYED_TIMED:
+            event_p->notify_delayed( t );
+            break;
+          case sc_parallel_frame::NOTIFY_NEXT_DELTA:
+            event_p->notify_next_delta();
+            break;
+          case sc_parallel_frame::CANCEL:
+            event_p->cancel();
+            break;
+          case sc_parallel_frame::NEXT_TRIGGER:
+            next_trigger( m_simc );
+            break;
+          case sc_parallel_frame::NEXT_TRIGGER_EVENT:
+            next_trigger( *event_p, m_simc );
+            break;
+          case sc_parallel_frame::NEXT_TRIGGER_OR_LIST:
+            next_trigger( *static_cast<sc_event_or_list*>( object_p ), m_simc );
+            break;
+          case sc_parallel_frame::NEXT_TRIGGER_AND_LIST:
+            next_trigger( *static_cast<sc_event_and_list*>( object_p ),
+                          m_simc );
+            break;
+          case sc_parallel_frame::NEXT_TRIGGER_TIMED:
+            next_trigger( t, m_simc );
+            break;
+          case sc_parallel_frame::NEXT_TRIGGER_TIMED_EVENT:
+            next_trigger( t, *event_p, m_simc );
+            break;
+          case sc_parallel_frame::NEXT_TRIGGER_TIMED_OR_LIST:
+            next_trigger( t, *static_cast<sc_event_or_list*>( object_p ),
+                          m_simc );
+            break;
+          case sc_parallel_frame::NEXT_TRIGGER_TIMED_AND_LIST:
+            next_trigger( t, *static_cast<sc_event_and_list*>( object_p ),
+                          m_simc );
+            break;
+          case sc_parallel_frame::REPORT:
+          {
+            const sc_parallel_frame::report_info& info =
+                frame.m_reports[report_i++];
+            if ( info.verbosity < 0 )
+                sc_report_handler::report( info.severity,
+                    info.msg_type.c_str(), info.msg.c_str(),
+                    info.file.c_str(), info.line );
+            else
+                sc_report_handler::report( info.severity,
+                    info.msg_type.c_str(), info.msg.c_str(), info.verbosity,
+                    info.file.c_str(), info.line );
+            break;
+          }
+          case sc_parallel_frame::PERFORM_UPDATE:
+            static_cast<sc_prim_channel*>( object_p )->perform_update();
+            break;
+          case sc_parallel_frame::MARK_TRACES:
+            static_cast<sc_trace_marker*>( object_p )->mark();
+            break;
+        }
+    }
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,273 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_parallel.h -- Host-parallel execution of simulation kernel work.
+
+  The evaluate phase may execute consecutive method processes that were
+  marked parallel_safe() on a pool of host threads. While such a batch is
+  running, every kernel operation with a visible side effect (update
+  requests, event notifications, next_trigger() calls, non-error reports)
+  is recorded into the frame of the issuing process instead of being
+  performed. Afterwards the simulation thread pops the batch from the
+  runnable queue one process at a time and replays each frame in order,
+  so the resulting kernel state is identical to a sequential execution.
+  The exception is an error raised by one of the methods: the methods
+  behind it in the batch have run already, whereas sequentially they
+  would not have.
+
+  Likewise, the update phase may execute the update() methods of primitive
+  channels marked parallel_update_safe() on the pool, in blocks of
+  consecutive entries of the update list. The event notifications of each
+  block are replayed in list order afterwards.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_PARALLEL_H_INCLUDED_
+#define SC_PARALLEL_H_INCLUDED_
+
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_time.h"
+#include "sysc/utils/sc_report.h"
+
+#include <string>
+#include <vector>
+
+namespace sc_core {
+
+class sc_host_mutex;
+class sc_host_semaphore;
+class sc_host_thread;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_parallel_job
+//
+//  Interface of work items executed by sc_worker_pool.
+// ----------------------------------------------------------------------------
+
+class sc_parallel_job
+{
+public:
+    virtual ~sc_parallel_job() {}
+
+    // must not throw
+    virtual void execute( std::size_t index ) = 0;
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_worker_pool
+//
+//  Fixed set of host threads executing the indices of a job. The calling
+//  thread takes part in the work; indices are handed out in chunks from a
+//  shared counter, so idle threads pick up whatever work is left.
+// ----------------------------------------------------------------------------
+
+class sc_worker_pool
+{
+public:
+
+    explicit sc_worker_pool( unsigned threads_n );
+    ~sc_worker_pool();
+
+    // number of host threads including the calling one
+    unsigned size() const
+        { return static_cast<unsigned>( m_threads.size() ) + 1; }
+
+    // execute job.execute(0) ... job.execute(count-1), return when all done
+    void run( sc_parallel_job& job, std::size_t count );
+
+private:
+
+    static void worker_main( void* pool_p );
+    void drain();
+
+private:
+    std::vector<sc_host_thread*> m_threads;
+    sc_host_mutex*               m_mutex_p;    // protects m_next.
+    sc_host_semaphore*           m_start_p;    // posted once per worker.
+    sc_host_semaphore*           m_done_p;     // posted by each worker.
+    sc_parallel_job*             m_job_p;      // job being executed.
+    std::size_t                  m_next;       // next index to hand out.
+    std::size_t                  m_count;      // number of indices.
+    std::size_t                  m_chunk;      // indices taken at once.
+    bool                         m_shutdown;   // workers should exit.
+
+private:
+    // disabled
+    sc_worker_pool( const sc_worker_pool& );
+    sc_worker_pool& operator = ( const sc_worker_pool& );
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_parallel_frame
+//
+//  Execution state and deferred kernel operations of one process, or of one
+//  block of channel updates, running on the worker pool.
+// ----------------------------------------------------------------------------
+
+class sc_parallel_frame
+{
+    friend class sc_parallel_engine;
+
+public:
+
+    enum op_kind {
+        REQUEST_UPDATE,              // sc_prim_channel::request_update()
+        NOTIFY,                      // sc_event::notify()
+        NOTIFY_TIMED,                // sc_event::notify( t )
+        NOTIFY_DELAYED,              // sc_event::notify_delayed()
+        NOTIFY_DELAYED_TIMED,        // sc_event::notify_delayed( t )
+        NOTIFY_NEXT_DELTA,           // sc_event::notify_next_delta()
+        CANCEL,                      // sc_event::cancel()
+        NEXT_TRIGGER,                // next_trigger()
+        NEXT_TRIGGER_EVENT,          // next_trigger( e )
+        NEXT_TRIGGER_OR_LIST,        // next_trigger( e1 | e2 )
+        NEXT_TRIGGER_AND_LIST,       // next_trigger( e1 & e2 )
+        NEXT_TRIGGER_TIMED,          // next_trigger( t )
+        NEXT_TRIGGER_TIMED_EVENT,    // next_trigger( t, e )
+        NEXT_TRIGGER_TIMED_OR_LIST,  // next_trigger( t, e1 | e2 )
+        NEXT_TRIGGER_TIMED_AND_LIST, // next_trigger( t, e1 & e2 )
+        REPORT,                      // sc_report_handler::report()
+        PERFORM_UPDATE,              // sc_prim_channel::perform_update()
+        MARK_TRACES                  // sc_trace_marker::mark()
+    };
+
+    // frame of the calling host thread, or 0 outside of a parallel batch
+    static sc_parallel_frame* current();
+
+    void record( op_kind kind, const void* object_p )
+        { m_ops.push_back( op( kind, object_p, SC_ZERO_TIME ) ); }
+    void record( op_kind kind, const void* object_p, const sc_time& t )
+        { m_ops.push_back( op( kind, object_p, t ) ); }
+    void record_report( sc_severity severity, const char* msg_type,
+                        const char* msg, int verbosity,
+                        const char* file, int line );
+
+    sc_curr_proc_handle curr_proc_info() const
+        { return &m_proc_info; }
+    sc_process_b* current_writer() const
+        { return m_writer_p; }
+    void set_error( sc_report* error_p );
+
+private:
+
+    sc_parallel_frame();
+    ~sc_parallel_frame();
+
+    void reset( sc_process_b* process_p, bool write_check );
+
+    struct op
+    {
+        op( op_kind k, const void* p, const sc_time& t )
+          : kind( k ), object_p( p ), time( t ) {}
+
+        op_kind     kind;
+        const void* object_p;
+        sc_time     time;
+    };
+
+    struct report_info
+    {
+        sc_severity severity;
+        std::string msg_type;
+        std::string msg;
+        std::string file;
+        int         line;
+        int         verbosity;   // < 0 if not given.
+    };
+
+    sc_curr_proc_info        m_proc_info;   // process executing this frame.
+    sc_process_b*            m_writer_p;    // for signal writer checks.
+    std::vector<op>          m_ops;         // deferred operations.
+    std::vector<report_info> m_reports;     // deferred report contents.
+    std::size_t              m_reports_n;   // used entries in m_reports.
+    sc_report*               m_error_p;     // error raised by the process.
+
+private:
+    // disabled
+    sc_parallel_frame( const sc_parallel_frame& );
+    sc_parallel_frame& operator = ( const sc_parallel_frame& );
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_parallel_engine
+//
+//  Per-simcontext driver of the host-parallel evaluate phase.
+// ----------------------------------------------------------------------------
+
+class sc_parallel_engine : private sc_parallel_job
+{
+public:
+
+    sc_parallel_engine( sc_simcontext* simc_p, unsigned threads_n );
+    virtual ~sc_parallel_engine();
+
+    unsigned size() const { return m_pool.size(); }
+
+    // execute the leading parallel-safe methods of the runnable queue,
+    // returns the number of methods executed or -1 if one of them failed
+    int evaluate_methods();
+
+    // execute the updates of the supplied update list, parallel-safe
+    // channels on the worker pool if the list is long enough, returns the
+    // number of updates performed
+    std::size_t perform_updates( sc_prim_channel* list_p );
+
+    // serializes error reports raised on the worker pool
+    static sc_host_mutex& report_mutex();
+
+private:
+
+    virtual void execute( std::size_t index );
+    void execute_updates( std::size_t block );
+    void replay( sc_parallel_frame& frame );
+
+private:
+    sc_simcontext*                  m_simc;
+    sc_worker_pool                  m_pool;
+    std::vector<sc_method_handle>   m_batch;   // methods of current batch.
+    std::vector<sc_parallel_frame*> m_frames;  // per batch entry or block.
+    std::vector<sc_prim_channel*>   m_updates; // channels of update phase.
+    bool                            m_updating; // executing m_updates.
+
+private:
+    // disabled
+    sc_parallel_engine( const sc_parallel_engine& );
+    sc_parallel_engine& operator = ( const sc_parallel_engine& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_PARALLEL_H_INCLUDED_
+// Taf!
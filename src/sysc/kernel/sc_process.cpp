@@ -53,6 +53,23 @@ sc_event                sc_process_handle::non_event( sc_event::kernel_event );
 
 sc_process_b* sc_process_b::m_last_created_process_p = 0;
 
+//------------------------------------------------------------------------------
+//"sc_process_b::awaits_dynamic"
+//
+// This method returns true if this object instance, which is registered
+// with the supplied event, currently waits for it. This is not the case
+// if it is registered only through the persistent event list it is bound
+// to, while waiting for something else.
+//------------------------------------------------------------------------------
+bool sc_process_b::awaits_dynamic( const sc_event* e ) const
+{
+    if ( m_bound_list_p == 0 || m_event_list_p == m_bound_list_p ||
+         !m_bound_list_p->contains( e ) )
+        return true;
+    return e == m_event_p ||
+           ( m_event_list_p && m_event_list_p->contains( e ) );
+}
+
 //------------------------------------------------------------------------------
 //"sc_process_b::add_static_event"
 //
@@ -135,6 +152,7 @@ void sc_process_b::disconnect_process()
 
     remove_dynamic_events();
     remove_static_events();
+    unbind_event_list();
 
     for ( std::vector<sc_reset*>::size_type rst_i = 0; rst_i < m_resets.size(); rst_i++ )
     {
@@ -199,6 +217,25 @@ void sc_process_b::dont_initialize( bool dont )
     m_dont_init = dont;
 }
 
+//------------------------------------------------------------------------------
+//"sc_process_b::parallel_safe"
+//
+// This method marks this object instance as safe for execution on the worker
+// pool together with other parallel-safe processes of the same evaluation.
+// Such a process may only communicate via channels and events; it must not
+// share unprotected data with other parallel-safe processes. Only method
+// processes are supported.
+//------------------------------------------------------------------------------
+void sc_process_b::parallel_safe( bool safe )
+{
+    if ( safe && m_process_kind != SC_METHOD_PROC_ )
+    {
+        SC_REPORT_WARNING( SC_ID_PARALLEL_SAFE_, name() );
+        return;
+    }
+    m_parallel_safe = safe;
+}
+
 //------------------------------------------------------------------------------
 //"sc_process_b::dump_state"
 //
@@ -337,6 +374,32 @@ sc_process_b::remove_static_events()
     }
 }
 
+//------------------------------------------------------------------------------
+//"sc_process_b::unbind_event"
+//
+// This method removes an event that is being destroyed from the persistent
+// event list this object instance is bound to, if the list contains it.
+//------------------------------------------------------------------------------
+void
+sc_process_b::unbind_event( const sc_event* e )
+{
+    if ( m_bound_list_p )
+        const_cast<sc_event_list*>( m_bound_list_p )->remove_event( e );
+}
+
+//------------------------------------------------------------------------------
+//"sc_process_b::unbind_event_list"
+//
+// This method removes the registration of this object instance with the
+// events of the persistent event list it is bound to, if any.
+//------------------------------------------------------------------------------
+void
+sc_process_b::unbind_event_list()
+{
+    if ( m_bound_list_p )
+        m_bound_list_p->unbind();
+}
+
 //------------------------------------------------------------------------------
 // "sc_process_b::report_error"
 //
@@ -552,6 +615,7 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
     proc_id( simcontext()->next_proc_id()),
     m_active_areset_n(0),
     m_active_reset_n(0),
+    m_bound_list_p(0),
     m_dont_init( false ),
     m_dynamic_proc(),
     m_event_p(0),
@@ -564,7 +628,9 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
     m_is_thread(is_thread),
     m_last_report_p(0),
     m_name_gen_p(0),
+    m_parallel_safe(false),
     m_process_kind(SC_NO_PROC_),
+    m_profile_index(-1),
     m_references_n(1),
     m_resets(),
     m_reset_event_p(0),
@@ -574,6 +640,8 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
     m_semantics_method_p ( method_p ),
     m_state(ps_normal),
     m_static_events(),
+    m_stats_host_ns(0),
+    m_stats_runs(0),
     m_sticky_reset(false),
     m_term_event_p(0),
     m_throw_helper_p(0),
@@ -618,6 +686,7 @@ sc_process_b::~sc_process_b()
 
     // REMOVE ANY STRUCTURES THAT MAY HAVE BEEN BUILT:
 
+    unbind_event_list();
     delete m_last_report_p;
     delete m_name_gen_p;
     delete m_reset_event_p;
@@ -31,9 +31,11 @@
 #if !defined(sc_process_h_INCLUDED)
 #define sc_process_h_INCLUDED
 
+#include "sysc/datatypes/int/sc_nbdefs.h"
 #include "sysc/kernel/sc_constants.h"
 #include "sysc/kernel/sc_object.h"
 #include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_kernel_pool.h"
 #include "sysc/communication/sc_export.h"
 
 #if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
@@ -270,7 +272,7 @@ class sc_throw_it : public sc_throw_it_helper
 //       method call: sync_reset_on - sync_reset_off.
 //
 //==============================================================================
-class SC_API sc_process_b : public sc_object {
+class SC_API sc_process_b : public sc_object, public sc_kernel_pool_object {
     friend class sc_simcontext;      // Allow static processes to have base.
     friend class sc_cthread_process; // Child can access parent.
     friend class sc_method_process;  // Child can access parent.
@@ -278,9 +280,13 @@ class SC_API sc_process_b : public sc_object {
     friend class sc_process_table;   // Allow process_table to modify ref. count.
     friend class sc_thread_process;  // Child can access parent.
 
+    friend class sc_checkpoint;
     friend class sc_event;
+    friend class sc_event_list;
+    friend class sc_kernel_stats;
     friend class sc_object;
     friend class sc_port_base;
+    friend class sc_process_profiler;
     friend class sc_runnable;
     friend class sc_sensitive;
     friend class sc_sensitive_pos;
@@ -351,6 +357,8 @@ class SC_API sc_process_b : public sc_object {
     inline int current_state() { return m_state; }
     bool dont_initialize() const { return m_dont_init; }
     virtual void dont_initialize( bool dont );
+    bool parallel_safe() const { return m_parallel_safe; }
+    void parallel_safe( bool safe );
     std::string dump_state() const;
     const ::std::vector<sc_object*>& get_child_objects() const;
     inline sc_curr_proc_kind proc_kind() const;
@@ -363,6 +371,7 @@ class SC_API sc_process_b : public sc_object {
   protected:
     virtual void add_child_object( sc_object* );
     void add_static_event( const sc_event& );
+    bool awaits_dynamic( const sc_event* ) const;
     bool dynamic() const { return m_dynamic_proc != SPAWN_ELAB; }
     const char* gen_unique_name( const char* basename_, bool preserve_first );
     inline sc_report* get_last_report() { return m_last_report_p; }
@@ -372,6 +381,8 @@ class SC_API sc_process_b : public sc_object {
     virtual bool remove_child_object( sc_object* );
     void remove_dynamic_events( bool skip_timeout = false );
     void remove_static_events();
+    void unbind_event( const sc_event* );
+    void unbind_event_list();
     inline void set_last_report( sc_report* last_p )
         {
             delete m_last_report_p;
@@ -424,6 +435,7 @@ class SC_API sc_process_b : public sc_object {
   protected:
     int                          m_active_areset_n; // number of aresets active.
     int                          m_active_reset_n;  // number of resets active.
+    const sc_event_list*         m_bound_list_p;    // persistent list bound to.
     bool                         m_dont_init;       // true: no initialize call.
     spawn_t                      m_dynamic_proc;    // SPAWN_ELAB, SPAWN_START, SPAWN_SIM
     const sc_event*              m_event_p;         // Dynamic event waiting on.
@@ -436,7 +448,9 @@ class SC_API sc_process_b : public sc_object {
     bool                         m_is_thread;       // true if this is thread.
     sc_report*                   m_last_report_p;   // last report this process.
     sc_name_gen*                 m_name_gen_p;      // subprocess name generator
+    bool                         m_parallel_safe;   // may run on worker pool.
     sc_curr_proc_kind            m_process_kind;    // type of process.
+    int                          m_profile_index;   // see sc_process_profiler.
     int                          m_references_n;    // outstanding handles.
     std::vector<sc_reset*>       m_resets;          // resets for process.
     sc_event*                    m_reset_event_p;   // reset event.
@@ -446,6 +460,8 @@ class SC_API sc_process_b : public sc_object {
     SC_ENTRY_FUNC                m_semantics_method_p; // method for semantics.
     int                          m_state;           // process state.
     std::vector<const sc_event*> m_static_events;   // static events waiting on.
+    sc_dt::uint64                m_stats_host_ns;   // host time, see sc_kernel_stats.
+    sc_dt::uint64                m_stats_runs;      // runs, see sc_kernel_stats.
     bool                         m_sticky_reset;    // see note 3 above.
     sc_event*                    m_term_event_p;    // terminated event.
     sc_throw_it_helper*          m_throw_helper_p;  // what to throw.
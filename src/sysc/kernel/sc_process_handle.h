@@ -135,6 +135,7 @@ class SC_API sc_process_handle {
     inline bool dont_initialize() const
         { return m_target_p ? m_target_p->dont_initialize() : false; }
     inline void dont_initialize( bool dont );
+    inline void parallel_safe( bool safe );
 
   public:
     operator sc_process_b* ()
@@ -284,6 +285,16 @@ inline void sc_process_handle::dont_initialize( bool dont )
         SC_REPORT_WARNING( SC_ID_EMPTY_PROCESS_HANDLE_, "dont_initialize()");
 }
 
+// call parallel_safe() on this object instance's target.
+
+inline void sc_process_handle::parallel_safe( bool safe )
+{
+    if ( m_target_p )
+        m_target_p->parallel_safe( safe );
+    else
+        SC_REPORT_WARNING( SC_ID_EMPTY_PROCESS_HANDLE_, "parallel_safe()");
+}
+
 // dump the status of this object instance's target:
 
 inline std::string sc_process_handle::dump_state() const
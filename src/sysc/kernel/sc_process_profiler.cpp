@@ -0,0 +1,353 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_process_profiler.cpp -- Host time of the processes, by process and
+                             module.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_process_profiler.h"
+#include "sysc/kernel/sc_kernel_stats.h"
+#include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_object.h"
+#include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_simcontext.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+#if defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+#   include <intrin.h>
+#   define SC_PROCESS_PROFILER_TSC_
+#elif defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#   include <x86intrin.h>
+#   define SC_PROCESS_PROFILER_TSC_
+#endif
+
+namespace sc_core {
+
+namespace {
+
+typedef sc_process_profiler::uint64 uint64;
+
+// time stamp counter, or host time in nanoseconds
+inline uint64 read_ticks()
+{
+#if defined(SC_PROCESS_PROFILER_TSC_)
+    return __rdtsc();
+#else
+    return sc_kernel_stats::host_time_ns();
+#endif
+}
+
+bool by_time( const sc_process_profiler::entry& a,
+              const sc_process_profiler::entry& b )
+{
+    if ( a.time != b.time )
+        return a.time > b.time;
+    return a.name < b.name;
+}
+
+void add_to( std::map<std::string, sc_process_profiler::entry>& entries,
+             const std::string& name,
+             const sc_process_profiler::entry& e )
+{
+    std::map<std::string, sc_process_profiler::entry>::iterator it =
+        entries.find( name );
+    if ( it == entries.end() )
+    {
+        sc_process_profiler::entry& added = entries[name];
+        added = e;
+        added.name = name;
+        return;
+    }
+    it->second.runs += e.runs;
+    it->second.sampled += e.sampled;
+    it->second.time += e.time;
+}
+
+std::vector<sc_process_profiler::entry>
+sorted( const std::map<std::string, sc_process_profiler::entry>& entries )
+{
+    std::vector<sc_process_profiler::entry> result;
+    result.reserve( entries.size() );
+    std::map<std::string, sc_process_profiler::entry>::const_iterator it;
+    for ( it = entries.begin(); it != entries.end(); ++it )
+        result.push_back( it->second );
+    std::sort( result.begin(), result.end(), &by_time );
+    return result;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_process_profiler
+//
+//  Host time of the processes, by process and module.
+// ----------------------------------------------------------------------------
+
+sc_process_profiler::sc_process_profiler( sc_simcontext* simc_p )
+  : m_simc( simc_p ), m_enabled( false ), m_sample_period( 1 ),
+    m_dump_file(), m_records(), m_index(), m_running( -1 ), m_switch_ticks( 0 ),
+    m_start_ticks( 0 ), m_start_ns( 0 )
+{
+    const char* env = std::getenv( "SC_PROCESS_PROFILE" );
+    if ( env && *env )
+    {
+        const char* period = std::getenv( "SC_PROCESS_PROFILE_SAMPLE" );
+        enable( true, period ? std::atoi( period ) : 1 );
+        m_dump_file = env;
+    }
+}
+
+void
+sc_process_profiler::enable( bool on, unsigned sample_period )
+{
+    if ( on && !m_enabled )
+    {
+        m_start_ns = sc_kernel_stats::host_time_ns();
+        m_start_ticks = read_ticks();
+    }
+    m_enabled = on;
+    m_sample_period = sample_period ? sample_period : 1;
+    m_running = -1;
+}
+
+//------------------------------------------------------------------------------
+//"sc_process_profiler::switch_to"
+//
+// This method charges the ticks since the last switch to the process that
+// was running, if its activation is sampled, and starts charging next_p.
+// A new activation of next_p is counted, and sampled every sample period,
+// unless it merely continues after a preempting process. The processes of
+// the same name share a record, so spawning dynamic processes over and over
+// does not add records.
+//------------------------------------------------------------------------------
+void
+sc_process_profiler::switch_to( sc_process_b* next_p, bool new_run )
+{
+    uint64 now = 0;
+    if ( m_running >= 0 )
+    {
+        now = read_ticks();
+        m_records[m_running].ticks += now - m_switch_ticks;
+        m_running = -1;
+    }
+    if ( next_p == 0 )
+        return;
+
+    if ( next_p->m_profile_index < 0 )
+    {
+        std::map<std::string, int>::iterator it =
+            m_index.find( next_p->name() );
+        if ( it != m_index.end() )
+            next_p->m_profile_index = it->second;
+    }
+    if ( next_p->m_profile_index < 0 )
+    {
+        record r;
+        r.name = next_p->name();
+        sc_object* parent_p = next_p->get_parent_object();
+        while ( parent_p && !dynamic_cast<sc_module*>( parent_p ) )
+            parent_p = parent_p->get_parent_object();
+        if ( parent_p )
+            r.module = parent_p->name();
+        r.runs = 0;
+        r.sampled = 0;
+        r.ticks = 0;
+        r.timing = false;
+        next_p->m_profile_index = static_cast<int>( m_records.size() );
+        m_index[r.name] = next_p->m_profile_index;
+        m_records.push_back( r );
+    }
+
+    record& r = m_records[next_p->m_profile_index];
+    if ( new_run )
+    {
+        r.timing = ( r.runs++ % m_sample_period ) == 0;
+        if ( r.timing )
+            ++r.sampled;
+    }
+    if ( r.timing )
+    {
+        m_running = next_p->m_profile_index;
+        m_switch_ticks = now != 0 ? now : read_ticks();
+    }
+}
+
+double
+sc_process_profiler::seconds_per_tick() const
+{
+#if defined(SC_PROCESS_PROFILER_TSC_)
+    uint64 ticks = read_ticks() - m_start_ticks;
+    uint64 ns = sc_kernel_stats::host_time_ns() - m_start_ns;
+    if ( ticks != 0 && ns != 0 )
+        return 1e-9 * static_cast<double>( ns ) / static_cast<double>( ticks );
+#endif
+    return 1e-9;
+}
+
+sc_process_profiler::entry
+sc_process_profiler::estimate( const record& r, double seconds_per_tick ) const
+{
+    entry e;
+    e.name = r.name;
+    e.runs = r.runs;
+    e.sampled = r.sampled;
+    e.time = seconds_per_tick * static_cast<double>( r.ticks );
+    if ( r.sampled != 0 )
+        e.time *= static_cast<double>( r.runs ) / r.sampled;
+    return e;
+}
+
+std::vector<sc_process_profiler::entry>
+sc_process_profiler::processes() const
+{
+    double scale = seconds_per_tick();
+    std::map<std::string, entry> entries;
+    for ( std::size_t i = 0; i < m_records.size(); ++i )
+    {
+        if ( m_records[i].runs != 0 )
+            add_to( entries, m_records[i].name,
+                    estimate( m_records[i], scale ) );
+    }
+    return sorted( entries );
+}
+
+std::vector<sc_process_profiler::entry>
+sc_process_profiler::modules() const
+{
+    double scale = seconds_per_tick();
+    std::map<std::string, entry> entries;
+    for ( std::size_t i = 0; i < m_records.size(); ++i )
+    {
+        const record& r = m_records[i];
+        if ( r.runs == 0 || r.module.empty() )
+            continue;
+        entry e = estimate( r, scale );
+        std::string::size_type pos = r.module.find( SC_HIERARCHY_CHAR );
+        while ( pos != std::string::npos )
+        {
+            add_to( entries, r.module.substr( 0, pos ), e );
+            pos = r.module.find( SC_HIERARCHY_CHAR, pos + 1 );
+        }
+        add_to( entries, r.module, e );
+    }
+    return sorted( entries );
+}
+
+void
+sc_process_profiler::reset()
+{
+    for ( std::size_t i = 0; i < m_records.size(); ++i )
+    {
+        m_records[i].runs = 0;
+        m_records[i].sampled = 0;
+        m_records[i].ticks = 0;
+        m_records[i].timing = false;
+    }
+    m_running = -1;
+    m_start_ns = sc_kernel_stats::host_time_ns();
+    m_start_ticks = read_ticks();
+}
+
+void
+sc_process_profiler::clear()
+{
+    m_records.clear();
+    m_index.clear();
+    reset();
+}
+
+void
+sc_process_profiler::print( ::std::ostream& os, std::size_t top_n ) const
+{
+    os << "Process profile (1 in " << m_sample_period
+       << " activations timed)\n";
+
+    const char* titles[] = { "processes by time", "modules by time" };
+    for ( int table = 0; table < 2; ++table )
+    {
+        std::vector<entry> entries = table ? modules() : processes();
+        std::size_t n = top_n < entries.size() ? top_n : entries.size();
+        os << "  " << std::left << std::setw(24) << titles[table]
+           << std::right << std::setw(12) << "runs" << std::setw(12)
+           << "sampled" << std::setw(14) << "time [s]" << "\n";
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            os << "    " << std::setw(34) << entries[i].runs
+               << std::setw(12) << entries[i].sampled
+               << std::setw(14) << entries[i].time
+               << "  " << entries[i].name << "\n";
+        }
+    }
+    os << ::std::flush;
+}
+
+void
+sc_process_profiler::print_folded( ::std::ostream& os ) const
+{
+    std::vector<entry> procs = processes();
+    for ( std::size_t i = 0; i < procs.size(); ++i )
+    {
+        const std::string& name = procs[i].name;
+        std::string::size_type pos = name.find( SC_HIERARCHY_CHAR );
+        while ( pos != std::string::npos )
+        {
+            os << name.substr( 0, pos ) << ';';
+            pos = name.find( SC_HIERARCHY_CHAR, pos + 1 );
+        }
+        os << name << ' '
+           << static_cast<uint64>( 1e9 * procs[i].time + 0.5 ) << '\n';
+    }
+    os << ::std::flush;
+}
+
+void
+sc_process_profiler::end_of_simulation() const
+{
+    if ( m_dump_file.empty() )
+        return;
+    std::ofstream os( m_dump_file.c_str() );
+    print_folded( os );
+}
+
+sc_process_profiler&
+sc_get_process_profiler()
+{
+    return sc_get_curr_simcontext()->process_profiler();
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,178 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_process_profiler.h -- Host time of the processes, by process and module.
+
+  Once enabled, the profiler counts the activations of each process, i.e.
+  the runs of a method and the resumptions of a thread, and measures the
+  host time until the scheduler switches to the next process with the
+  time stamp counter of the processor where available, the monotonic
+  clock elsewhere. With a sample period of n, only every n-th activation
+  of each process name is timed and the time of the others is estimated
+  from them. The processes are aggregated by name, so the dynamic
+  processes of the same name share one record, and by the modules they
+  are part of.
+
+  The profile is printed as a report or as folded stacks, one line per
+  process with the hierarchical names of its modules and itself separated
+  by semicolons, followed by its host time in nanoseconds, as read by the
+  flame graph tools. The profiler is enabled by enable(), or by the
+  SC_PROCESS_PROFILE environment variable, which names the file the
+  folded stacks are written to at the end of the simulation; the sample
+  period is taken from SC_PROCESS_PROFILE_SAMPLE then.
+
+  Method processes run on the worker pool of the parallel evaluation are
+  neither counted nor timed. While the profiler is disabled, the scheduler
+  only tests whether it is enabled.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_PROCESS_PROFILER_H_INCLUDED_
+#define SC_PROCESS_PROFILER_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sc_core {
+
+class sc_process_b;
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_process_profiler
+//
+//  Host time of the processes, see sc_get_process_profiler().
+// ----------------------------------------------------------------------------
+
+class SC_API sc_process_profiler
+{
+    friend class sc_simcontext;
+
+public:
+
+    typedef sc_dt::uint64 uint64;
+
+    // profile of one process name or module
+    struct entry
+    {
+        std::string name;
+        uint64      runs;     // activations.
+        uint64      sampled;  // activations timed.
+        double      time;     // seconds of host time, estimated.
+    };
+
+    // time every sample_period-th activation of each process
+    void enable( bool on = true, unsigned sample_period = 1 );
+    bool enabled() const
+        { return m_enabled; }
+    unsigned sample_period() const
+        { return m_sample_period; }
+
+    // the process names, with the largest host time first
+    std::vector<entry> processes() const;
+
+    // the modules, including their child modules, largest host time first
+    std::vector<entry> modules() const;
+
+    // forget the measurements
+    void reset();
+
+    // print the top_n processes and modules
+    void print( ::std::ostream& os = ::std::cout,
+                std::size_t top_n = 20 ) const;
+
+    // print the folded stacks of the processes
+    void print_folded( ::std::ostream& os ) const;
+
+    // write the folded stacks to a file at the end of the simulation (also
+    // selected by the SC_PROCESS_PROFILE environment variable)
+    void dump_folded_at_end_of_simulation( const std::string& file_name )
+        { m_dump_file = file_name; }
+
+public: // kernel internal
+
+    void switch_to( sc_process_b* next_p, bool new_run = true );
+
+    // write the folded stacks if selected
+    void end_of_simulation() const;
+
+private:
+
+    // measurements of one process
+    struct record
+    {
+        std::string name;
+        std::string module;   // name of the enclosing module, or empty.
+        uint64      runs;
+        uint64      sampled;
+        uint64      ticks;    // time stamp counter ticks of the samples.
+        bool        timing;   // the current activation is sampled.
+    };
+
+    explicit sc_process_profiler( sc_simcontext* simc_p );
+
+    // forget the processes as well
+    void clear();
+
+    double seconds_per_tick() const;
+    entry estimate( const record& r, double seconds_per_tick ) const;
+
+private:
+    sc_simcontext*      m_simc;
+    bool                m_enabled;
+    unsigned            m_sample_period;
+    std::string         m_dump_file;     // folded stacks, or empty.
+    std::vector<record> m_records;       // see sc_process_b::m_profile_index.
+    std::map<std::string, int> m_index;  // record of each process name.
+    int                 m_running;       // record charged, or -1.
+    uint64              m_switch_ticks;  // ticks at the last switch.
+    uint64              m_start_ticks;   // ticks when enabled.
+    uint64              m_start_ns;      // host time when enabled.
+
+private:
+    // disabled
+    sc_process_profiler( const sc_process_profiler& );
+    sc_process_profiler& operator = ( const sc_process_profiler& );
+};
+
+// the profiler of the current simulation context
+SC_API sc_process_profiler& sc_get_process_profiler();
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_PROCESS_PROFILER_H_INCLUDED_
+// Taf!
@@ -62,6 +62,7 @@ class SC_API sc_runnable
     inline void push_back_thread( sc_thread_handle );
     inline void push_front_method( sc_method_handle );
     inline void push_front_thread( sc_thread_handle );
+    inline void push_ranked_method( sc_method_handle );
 
     inline bool is_initialized() const;
     inline bool is_empty() const;
@@ -69,6 +70,8 @@ class SC_API sc_runnable
     inline sc_method_handle pop_method();
     inline sc_thread_handle pop_thread();
 
+    inline sc_method_handle peek_method( sc_method_handle prev_h = 0 ) const;
+
   public: // diagnostics:
     void dump() const;
 
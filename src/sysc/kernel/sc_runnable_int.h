@@ -266,6 +266,30 @@ inline void sc_runnable::push_front_thread( sc_thread_handle thread_h )
     }
 }
 
+//------------------------------------------------------------------------------
+//"sc_runnable::push_ranked_method"
+//
+// This method inserts the supplied method process into the queue of runnable
+// method processes before the first one of a higher rank, so the methods
+// triggered along a compressed signal chain run in topological order.
+//     method_h -> method process to add to the queue.
+//------------------------------------------------------------------------------
+inline void sc_runnable::push_ranked_method( sc_method_handle method_h )
+{
+    DEBUG_MSG(DEBUG_NAME,method_h,"pushing ranked method");
+    sc_method_handle prev_h = m_methods_push_head;
+    sc_method_handle next_h = prev_h->next_runnable();
+    while ( next_h != SC_NO_METHODS && next_h->m_rank <= method_h->m_rank )
+    {
+        prev_h = next_h;
+        next_h = next_h->next_runnable();
+    }
+    method_h->set_next_runnable(next_h);
+    prev_h->set_next_runnable(method_h);
+    if ( prev_h == m_methods_push_tail )
+        m_methods_push_tail = method_h;
+}
+
 //------------------------------------------------------------------------------
 //"sc_runnable::pop_method"
 //
@@ -291,6 +315,22 @@ inline sc_method_handle sc_runnable::pop_method()
 
 }
 
+//------------------------------------------------------------------------------
+//"sc_runnable::peek_method"
+//
+// This method returns the method process queued for execution after the
+// supplied one, without removing anything from the queue, or a null if there
+// is no such method process.
+//     prev_h -> method process in the pop queue, or 0 for the first one.
+//------------------------------------------------------------------------------
+inline sc_method_handle sc_runnable::peek_method( sc_method_handle prev_h ) const
+{
+    sc_method_handle result_p;
+
+    result_p = prev_h ? prev_h->next_runnable() : m_methods_pop;
+    return result_p != SC_NO_METHODS ? result_p : 0;
+}
+
 //------------------------------------------------------------------------------
 //"sc_runnable::pop_thread"
 //
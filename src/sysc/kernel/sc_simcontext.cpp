@@ -31,6 +31,8 @@
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 
+#include "sysc/kernel/sc_checkpoint.h"
+#include "sysc/kernel/sc_cor_fast.h"
 #include "sysc/kernel/sc_cor_fiber.h"
 #include "sysc/kernel/sc_cor_pthread.h"
 #include "sysc/kernel/sc_cor_qt.h"
@@ -40,20 +42,25 @@
 #include "sysc/kernel/sc_module_registry.h"
 #include "sysc/kernel/sc_name_gen.h"
 #include "sysc/kernel/sc_object_manager.h"
+#include "sysc/kernel/sc_parallel.h"
+#include "sysc/kernel/sc_timed_queue.h"
 #include "sysc/kernel/sc_cthread_process.h"
 #include "sysc/kernel/sc_method_process.h"
 #include "sysc/kernel/sc_thread_process.h"
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_reset.h"
+#include "sysc/kernel/sc_sync_domain.h"
 #include "sysc/kernel/sc_ver.h"
 #include "sysc/kernel/sc_dynamic_processes.h"
 #include "sysc/kernel/sc_phase_callback_registry.h"
+#include "sysc/communication/sc_clock.h"
 #include "sysc/communication/sc_port.h"
 #include "sysc/communication/sc_export.h"
 #include "sysc/communication/sc_prim_channel.h"
 #include "sysc/tracing/sc_trace.h"
 #include "sysc/utils/sc_mempool.h"
 #include "sysc/utils/sc_list.h"
+#include "sysc/utils/sc_report_writer.h"
 #include "sysc/utils/sc_string_view.h"
 #include "sysc/utils/sc_utils_ids.h"
 
@@ -102,6 +109,9 @@
 namespace sc_core {
 
 sc_stop_mode stop_mode = SC_STOP_FINISH_DELTA;
+static unsigned parallel_workers = 0; // 0: not set, use environment.
+static sc_timed_queue_kind timed_queue = SC_TIMED_QUEUE_HEAP;
+static int stack_usage_report = -1;    // -1: not set, use environment.
 
 // ----------------------------------------------------------------------------
 //  CLASS : sc_process_table
@@ -200,25 +210,6 @@ sc_simcontext::remove_process( sc_thread_handle handle )
     return m_process_table->remove(handle);
 }
 
-SC_API int
-sc_notify_time_compare( const void* p1, const void* p2 )
-{
-    const sc_event_timed* et1 = static_cast<const sc_event_timed*>( p1 );
-    const sc_event_timed* et2 = static_cast<const sc_event_timed*>( p2 );
-
-    const sc_time& t1 = et1->notify_time();
-    const sc_time& t2 = et2->notify_time();
-
-    if( t1 < t2 ) {
-	return 1;
-    } else if( t1 > t2 ) {
-	return -1;
-    } else {
-	return 0;
-    }
-}
-
-
 // +============================================================================
 // | CLASS sc_invoke_method - class to invoke sc_method's to support
 // |                          sc_simcontext::preempt_with().
@@ -338,9 +329,10 @@ sc_simcontext::init()
 
     reset_curr_proc();
     m_next_proc_id = -1;
-    m_timed_events = new sc_ppq<sc_event_timed*>( 128, sc_notify_time_compare );
+    m_timed_events = sc_timed_queue::create( SC_TIMED_QUEUE_HEAP );
     m_something_to_trace = false;
     m_runnable = new sc_runnable;
+    m_ranked_writer = 0;
     m_collectable = new sc_process_list;
     m_time_params = new sc_time_params;
     m_curr_time = SC_ZERO_TIME;
@@ -358,24 +350,40 @@ sc_simcontext::init()
     m_method_invoker_p = NULL;
     m_cor = 0;
     m_reset_finder_q = 0;
+    m_parallel = 0;
+    m_parallel_phase = false;
     m_in_simulator_control = false;
     m_start_of_simulation_called = false;
     m_end_of_simulation_called = false;
     m_simulation_status = SC_ELABORATION;
+    m_checkpoint_p = 0;
+    m_checkpoint_restored = false;
 }
 
 void
 sc_simcontext::clean()
 {
+    // the trace files may never be closed
+    flush_trace_files();
+
     // remove remaining zombie processes
     do_collect_processes();
 
     delete m_method_invoker_p;
+    delete m_checkpoint_p;
     delete m_error;
+    delete m_parallel;
     delete m_cor_pkg;
     delete m_time_params;
     delete m_collectable;
     delete m_runnable;
+
+    // drop the pending timed notifications
+    while( sc_event_timed* et = m_timed_events->extract_top() ) {
+        if( et->event() != 0 )
+            et->event()->m_notify_type = sc_event::NONE;
+        delete et;
+    }
     delete m_timed_events;
     delete m_process_table;
     delete m_name_gen;
@@ -389,6 +397,11 @@ sc_simcontext::clean()
     m_delta_events.clear();
     m_child_objects.clear();
     m_trace_files.clear();
+    m_idle_clocks.clear();
+    m_sync_domains.clear();
+    m_stats.clear();
+    m_elab_profiler.reset();
+    m_process_profiler.clear();
 
     while( m_reset_finder_q ) {
         sc_reset_finder* rf = m_reset_finder_q;
@@ -405,7 +418,8 @@ sc_simcontext::sc_simcontext() :
     m_process_table(0), m_curr_proc_info(), m_current_writer(0),
     m_write_check(SC_SIGNAL_WRITE_CHECK_DEFAULT_), m_next_proc_id(-1),
     m_child_events(), m_child_objects(), m_delta_events(), m_timed_events(0),
-    m_trace_files(), m_something_to_trace(false), m_runnable(0), m_collectable(0),
+    m_trace_files(), m_something_to_trace(false), m_runnable(0),
+    m_ranked_writer(0), m_collectable(0),
     m_time_params(), m_curr_time(SC_ZERO_TIME), m_max_time(SC_ZERO_TIME),
     m_change_stamp(0), m_delta_count(0), m_initial_delta_count_at_current_time(0),
     m_forced_stop(false), m_paused(false),
@@ -413,7 +427,12 @@ sc_simcontext::sc_simcontext() :
     m_execution_phase(phase_initialize), m_error(0),
     m_in_simulator_control(false), m_end_of_simulation_called(false),
     m_simulation_status(SC_ELABORATION), m_start_of_simulation_called(false),
-    m_cor_pkg(0), m_cor(0), m_reset_finder_q(0)
+    m_cor_pkg(0), m_cor(0), m_reset_finder_q(0),
+    m_parallel(0), m_parallel_phase(false), m_idle_clocks(),
+    m_sync_domains(), m_stats(this), m_elab_profiler(),
+    m_process_profiler(this),
+    m_kernel_pool( new sc_kernel_pool( this ) ),
+    m_checkpoint_p(0), m_checkpoint_restored(false)
 {
     init();
 }
@@ -421,6 +440,78 @@ sc_simcontext::sc_simcontext() :
 sc_simcontext::~sc_simcontext()
 {
     clean();
+    m_kernel_pool->detach();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::park_clock"
+// |
+// | These methods keep track of the clocks, which skip their edges while no
+// | process waits for them (see sc_clock::set_idle_skipping). After each
+// | evaluation phase, the parked clocks check whether they are awaited
+// | again. Clocks are not parked while signals are traced, since the trace
+// | files sample the values of the signals at each time step.
+// +----------------------------------------------------------------------------
+bool
+sc_simcontext::park_clock( sc_clock* clock_p )
+{
+    if( !m_trace_files.empty() )
+        return false;
+    m_idle_clocks.push_back( clock_p );
+    return true;
+}
+
+void
+sc_simcontext::unpark_clock( sc_clock* clock_p )
+{
+    std::vector<sc_clock*>::iterator it =
+      std::find( m_idle_clocks.begin(), m_idle_clocks.end(), clock_p );
+    if( it != m_idle_clocks.end() )
+        m_idle_clocks.erase( it );
+}
+
+void
+sc_simcontext::wake_idle_clocks()
+{
+    bool tracing = !m_trace_files.empty();
+    std::size_t kept_n = 0;
+    for( std::size_t i = 0; i < m_idle_clocks.size(); ++i )
+    {
+        sc_clock* clock_p = m_idle_clocks[i];
+        if( !clock_p->resume( tracing ) )
+            m_idle_clocks[kept_n++] = clock_p;
+    }
+    m_idle_clocks.resize( kept_n );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::add_sync_domain"
+// |
+// | These methods keep track of the synchronization domains. Each domain
+// | simulates the current window on its host thread while the kernel
+// | advances; when sc_start() returns, the domains finish their windows so
+// | that the model can be inspected or destroyed.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::add_sync_domain( sc_sync_domain* domain_p )
+{
+    m_sync_domains.push_back( domain_p );
+}
+
+void
+sc_simcontext::remove_sync_domain( sc_sync_domain* domain_p )
+{
+    std::vector<sc_sync_domain*>::iterator it =
+      std::find( m_sync_domains.begin(), m_sync_domains.end(), domain_p );
+    if( it != m_sync_domains.end() )
+        m_sync_domains.erase( it );
+}
+
+void
+sc_simcontext::pause_sync_domains()
+{
+    for( std::size_t i = 0; i < m_sync_domains.size(); ++i )
+        m_sync_domains[i]->pause();
 }
 
 // +----------------------------------------------------------------------------
@@ -442,6 +533,69 @@ sc_simcontext::active_object()
     return result_p;
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::parallel_curr_proc_info"
+// |
+// | These methods implement the process dependent parts of the simulation
+// | context while parallel-safe processes execute on the worker pool. They
+// | operate on the frame of the process executed by the calling host thread.
+// +----------------------------------------------------------------------------
+sc_curr_proc_handle
+sc_simcontext::parallel_curr_proc_info()
+{
+    sc_parallel_frame* frame_p = sc_parallel_frame::current();
+    return frame_p ? frame_p->curr_proc_info() : &m_curr_proc_info;
+}
+
+sc_process_b*
+sc_simcontext::parallel_current_writer() const
+{
+    sc_parallel_frame* frame_p = sc_parallel_frame::current();
+    return frame_p ? frame_p->current_writer() : m_current_writer;
+}
+
+void
+sc_simcontext::parallel_request_update( sc_prim_channel& prim_channel_ )
+{
+    sc_parallel_frame::current()->record( sc_parallel_frame::REQUEST_UPDATE,
+                                          &prim_channel_ );
+}
+
+void
+sc_simcontext::parallel_notify_next_delta( sc_event& e )
+{
+    sc_parallel_frame::current()->record( sc_parallel_frame::NOTIFY_NEXT_DELTA,
+                                          &e );
+}
+
+void
+sc_simcontext::parallel_mark_traces( sc_trace_marker& marker )
+{
+    sc_parallel_frame::current()->record( sc_parallel_frame::MARK_TRACES,
+                                          &marker );
+}
+
+void
+sc_simcontext::parallel_set_error( sc_report* err )
+{
+    sc_parallel_frame::current()->set_error( err );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::push_ranked_method"
+// |
+// | This method queues a method process triggered within the write of a
+// | compressed signal, see sc_signal_channel. The method is ranked after the
+// | writing method, and runs before the queued methods of a higher rank.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::push_ranked_method( sc_method_handle method_h )
+{
+    if( method_h->m_rank <= m_ranked_writer->m_rank )
+        method_h->m_rank = m_ranked_writer->m_rank + 1;
+    m_runnable->push_ranked_method( method_h );
+}
+
 // +----------------------------------------------------------------------------
 // |"sc_simcontext::crunch"
 // |
@@ -480,14 +634,38 @@ sc_simcontext::crunch( bool once )
 	    // execute method processes
 
 	    m_runnable->toggle_methods();
-	    sc_method_handle method_h = pop_runnable_method();
-	    while( method_h != 0 ) {
+	    while( true ) {
+
+		// leading parallel-safe methods go to the worker pool; the
+		// host time spent there is not charged to the last process
+
+		if ( m_parallel != 0 )
+		{
+		    switch_process( 0 );
+		    int executed_n = m_parallel->evaluate_methods();
+		    if ( executed_n < 0 )
+		    {
+			goto out;
+		    }
+		    if ( executed_n > 0 )
+		    {
+			empty_eval_phase = false;
+			SC_KERNEL_STATS_( m_stats.parallel_methods( executed_n ) );
+			continue;
+		    }
+		}
+
+		sc_method_handle method_h = pop_runnable_method();
+		if ( method_h == 0 )
+		{
+		    break;
+		}
 		empty_eval_phase = false;
+		switch_process( method_h );
 		if ( !method_h->run_process() )
 		{
 		    goto out;
 		}
-		method_h = pop_runnable_method();
 	    }
 
 	    // execute (c)thread processes
@@ -499,8 +677,10 @@ sc_simcontext::crunch( bool once )
 		thread_h = pop_runnable_thread();
 	    }
 
+	    switch_process( thread_h );
 	    if( thread_h != 0 ) {
 	        empty_eval_phase = false;
+		SC_KERNEL_STATS_( m_stats.context_switch() );
 		m_cor_pkg->yield( thread_h->m_cor_p );
 	    }
 	    if( m_error ) {
@@ -522,6 +702,10 @@ sc_simcontext::crunch( bool once )
         // remove finally dead zombies:
         do_collect_processes();
 
+        // restart the idle clocks someone waits for now:
+        if ( !m_idle_clocks.empty() )
+            wake_idle_clocks();
+
 
 	// UPDATE PHASE
 	//
@@ -534,7 +718,16 @@ sc_simcontext::crunch( bool once )
 //	    SC_DO_PHASE_CALLBACK_(evaluation_done);
 	    m_change_stamp++;
 	}
+#if defined(SC_ENABLE_KERNEL_STATS)
+	{
+	    sc_kernel_stats::uint64 start_ns = sc_kernel_stats::host_time_ns();
+	    std::size_t updates_n = m_prim_channel_registry->perform_update();
+	    m_stats.update_phase( updates_n,
+	                          sc_kernel_stats::host_time_ns() - start_ns );
+	}
+#else
 	m_prim_channel_registry->perform_update();
+#endif
 	SC_DO_PHASE_CALLBACK_(update_done);
 	m_execution_phase = phase_notify;
 
@@ -579,7 +772,10 @@ sc_simcontext::crunch( bool once )
 	}
 
 	if ( !empty_eval_phase )
+	{
 		m_delta_count ++;
+		SC_KERNEL_STATS_( m_stats.end_of_delta() );
+	}
 
 	if( m_runnable->is_empty() ) {
 	    // no more runnable processes
@@ -634,21 +830,25 @@ sc_simcontext::elaborate()
       new sc_invoke_method("$$$$kernel_module$$$$_invoke_method" );
 
     m_simulation_status = SC_BEFORE_END_OF_ELABORATION;
-    for( int cd = 0; cd != 4; /* empty */ )
     {
-        cd  = m_port_registry->construction_done();
-        cd += m_export_registry->construction_done();
-        cd += m_prim_channel_registry->construction_done();
-        cd += m_module_registry->construction_done();
+        sc_elab_profiler::scope phase( m_elab_profiler,
+                                       "before_end_of_elaboration" );
+        for( int cd = 0; cd != 4; /* empty */ )
+        {
+            cd  = m_port_registry->construction_done();
+            cd += m_export_registry->construction_done();
+            cd += m_prim_channel_registry->construction_done();
+            cd += m_module_registry->construction_done();
+
+            // check for call(s) to sc_stop
+            if( m_forced_stop ) {
+                do_sc_stop_action();
+                return;
+            }
 
-        // check for call(s) to sc_stop
-        if( m_forced_stop ) {
-            do_sc_stop_action();
-            return;
         }
-
+        SC_DO_PHASE_CALLBACK_(construction_done);
     }
-    SC_DO_PHASE_CALLBACK_(construction_done);
 
     // SIGNAL THAT ELABORATION IS DONE
     //
@@ -659,12 +859,20 @@ sc_simcontext::elaborate()
     m_elaboration_done = true;
     m_simulation_status = SC_END_OF_ELABORATION;
 
-    m_port_registry->elaboration_done();
-    m_export_registry->elaboration_done();
-    m_prim_channel_registry->elaboration_done();
-    m_module_registry->elaboration_done();
-    SC_DO_PHASE_CALLBACK_(elaboration_done);
-    sc_reset::reconcile_resets(m_reset_finder_q);
+    {
+        sc_elab_profiler::scope phase( m_elab_profiler,
+                                       "end_of_elaboration" );
+        m_port_registry->elaboration_done();
+        m_export_registry->elaboration_done();
+        m_prim_channel_registry->elaboration_done();
+        m_module_registry->elaboration_done();
+        SC_DO_PHASE_CALLBACK_(elaboration_done);
+        sc_reset::reconcile_resets(m_reset_finder_q);
+    }
+
+    // select the signals updated within the delta cycle of their writes
+    sc_signal_channel::select_delta_compression(
+        sc_get_top_level_objects( this ), false );
 
     // check for call(s) to sc_stop
     if( m_forced_stop ) {
@@ -687,14 +895,37 @@ sc_simcontext::prepare_to_simulate()
     m_cor_pkg = new sc_cor_pkg_t( this );
     m_cor = m_cor_pkg->get_main();
 
+    // start the worker pool for parallel-safe processes, if requested
+    unsigned workers_n = sc_get_parallel_workers();
+    if ( workers_n > 1 )
+        m_parallel = new sc_parallel_engine( this, workers_n );
+
+    // move notifications issued during elaboration to the selected queue
+    if ( m_timed_events->kind() != sc_get_timed_queue() )
+    {
+        sc_timed_queue* timed_events = sc_timed_queue::create( timed_queue );
+        while( sc_event_timed* et = m_timed_events->extract_top() ) {
+            if( et->event() != 0 )
+                timed_events->insert( et );
+            else
+                delete et;
+        }
+        delete m_timed_events;
+        m_timed_events = timed_events;
+    }
+
     // NOTIFY ALL OBJECTS THAT SIMULATION IS ABOUT TO START:
 
     m_simulation_status = SC_START_OF_SIMULATION;
-    m_port_registry->start_simulation();
-    m_export_registry->start_simulation();
-    m_prim_channel_registry->start_simulation();
-    m_module_registry->start_simulation();
-    SC_DO_PHASE_CALLBACK_(start_simulation);
+    {
+        sc_elab_profiler::scope phase( m_elab_profiler,
+                                       "start_of_simulation" );
+        m_port_registry->start_simulation();
+        m_export_registry->start_simulation();
+        m_prim_channel_registry->start_simulation();
+        m_module_registry->start_simulation();
+        SC_DO_PHASE_CALLBACK_(start_simulation);
+    }
     m_start_of_simulation_called = true;
 
     // CHECK FOR CALL(S) TO sc_stop
@@ -706,11 +937,16 @@ sc_simcontext::prepare_to_simulate()
 
     // PREPARE ALL (C)THREAD PROCESSES FOR SIMULATION:
 
-    for ( thread_p = m_process_table->thread_q_head();
-	  thread_p; thread_p = thread_p->next_exist() )
     {
-	thread_p->prepare_for_simulation();
+        sc_elab_profiler::scope phase( m_elab_profiler, "process creation" );
+        for ( thread_p = m_process_table->thread_q_head();
+	      thread_p; thread_p = thread_p->next_exist() )
+        {
+	    thread_p->prepare_for_simulation();
+        }
     }
+    sc_elab_profiler::scope initialization( m_elab_profiler,
+                                            "initialization" );
 
     m_simulation_status = SC_RUNNING;
     m_ready_to_simulate = true;
@@ -722,6 +958,16 @@ sc_simcontext::prepare_to_simulate()
     m_prim_channel_registry->perform_update();
     m_execution_phase = phase_notify;
 
+    // restore the checkpoint, if any, before the notifications issued
+    // during elaboration make processes runnable
+
+    if( m_checkpoint_p != 0 ) {
+        m_checkpoint_p->restore();
+        delete m_checkpoint_p;
+        m_checkpoint_p = 0;
+        m_checkpoint_restored = true;
+    }
+
     int size;
 
     // make all method processes runnable
@@ -817,6 +1063,7 @@ sc_simcontext::initialize( bool no_crunch )
     elaborate();
 
     prepare_to_simulate();
+    m_elab_profiler.start_of_simulation();
     initial_crunch(no_crunch);
     m_in_simulator_control = false;
 }
@@ -950,6 +1197,7 @@ sc_simcontext::do_timestep(const sc_time& t)
     }
 #endif
 
+    SC_KERNEL_STATS_( m_stats.time_step( m_timed_events->size() ) );
     m_curr_time = t;
     m_change_stamp++;
     m_initial_delta_count_at_current_time = m_delta_count;
@@ -1038,6 +1286,22 @@ sc_simcontext::end()
     m_module_registry->simulation_done();
     SC_DO_PHASE_CALLBACK_(simulation_done);
     m_end_of_simulation_called = true;
+
+    // the trace files may never be closed
+    flush_trace_files();
+
+    if ( sc_get_stack_usage_report() )
+    {
+        for ( sc_object* obj_p = first_object(); obj_p; obj_p = next_object() )
+        {
+            sc_thread_handle thread_h = dynamic_cast<sc_thread_handle>( obj_p );
+            if ( thread_h )
+                thread_h->report_stack_usage();
+        }
+    }
+
+    m_stats.end_of_simulation();
+    m_process_profiler.end_of_simulation();
 }
 
 void
@@ -1098,32 +1362,28 @@ bool
 sc_simcontext::register_hierarchical_name(const sc_object* parent,
                                           const std::string& name)
 {
-    return m_object_manager->insert_external_name(
-            construct_hierarchical_name(parent, name));
+    return m_object_manager->insert_external_name( parent, name.c_str() );
 }
 
 bool
 sc_simcontext::unregister_hierarchical_name(const sc_object* parent,
                                             const std::string& name)
 {
-    return m_object_manager->remove_external_name(
-            construct_hierarchical_name(parent, name));
+    return m_object_manager->remove_external_name( parent, name.c_str() );
 }
 
 bool
 sc_simcontext::hierarchical_name_exists(const sc_object* parent,
                                         const std::string& name)
 {
-    return m_object_manager->name_exists(
-            construct_hierarchical_name(parent, name));
+    return m_object_manager->name_exists( parent, name.c_str() );
 }
 
 const char*
 sc_simcontext::get_hierarchical_name(const sc_object* parent,
                                      const std::string& name)
 {
-    return m_object_manager->get_name(
-            construct_hierarchical_name(parent, name));
+    return m_object_manager->get_name( parent, name.c_str() );
 }
 
 // to generate unique names for objects in an MT-Safe way
@@ -1159,6 +1419,19 @@ sc_simcontext::create_method_process(
 {
     sc_method_handle handle =
         new sc_method_process(name_p, free_host, method_p, host_p, opt_p);
+    return add_method_process( handle );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::add_method_process"
+// |
+// | This method registers a newly constructed method process. Before the
+// | simulation starts it is added to the process table; afterwards it is
+// | queued for execution unless dont_initialize() was specified.
+// +----------------------------------------------------------------------------
+sc_process_handle
+sc_simcontext::add_method_process( sc_method_handle handle )
+{
     if ( m_ready_to_simulate ) { // dynamic process
 	if ( !handle->dont_initialize() )
         {
@@ -1248,6 +1521,13 @@ sc_simcontext::remove_trace_file( sc_trace_file* tf )
     m_something_to_trace = ( m_trace_files.size() > 0 );
 }
 
+void
+sc_simcontext::flush_trace_files()
+{
+    for( std::size_t i = 0; i < m_trace_files.size(); ++i )
+        m_trace_files[i]->flush();
+}
+
 sc_cor*
 sc_simcontext::next_cor()
 {
@@ -1261,6 +1541,7 @@ sc_simcontext::next_cor()
 	thread_h = pop_runnable_thread();
     }
 
+    switch_process( thread_h );
     if( thread_h != 0 ) {
 	return thread_h->m_cor_p;
     } else {
@@ -1397,6 +1678,18 @@ sc_simcontext::remove_delta_event( sc_event* e )
     e->m_delta_event_index = -1;
 }
 
+void
+sc_simcontext::add_timed_event( sc_event_timed* et )
+{
+    m_timed_events->insert( et );
+}
+
+void
+sc_simcontext::remove_timed_event( sc_event_timed* et )
+{
+    m_timed_events->remove( et );
+}
+
 // +----------------------------------------------------------------------------
 // |"sc_simcontext::preempt_with"
 // |
@@ -1715,7 +2008,14 @@ sc_start( const sc_time& duration, sc_starvation_policy p )
 
     // If the simulation status is good perform the simulation:
 
-    context_p->simulate( duration );
+    try {
+        context_p->simulate( duration );
+    }
+    catch( ... ) {
+        context_p->pause_sync_domains();
+        throw;
+    }
+    context_p->pause_sync_domains();
 
     // Re-check the status:
 
@@ -1757,6 +2057,7 @@ sc_start()
 SC_API void
 sc_stop()
 {
+    sc_report_writer::flush();
     sc_get_curr_simcontext()->stop();
 }
 
@@ -1870,6 +2171,104 @@ sc_get_stop_mode()
     return stop_mode;
 }
 
+//------------------------------------------------------------------------------
+//"sc_set_timed_queue"
+//
+// This function selects the implementation of the queue of timed event
+// notifications used once the simulation starts.
+//     kind = SC_TIMED_QUEUE_HEAP or SC_TIMED_QUEUE_CALENDAR.
+//------------------------------------------------------------------------------
+SC_API void sc_set_timed_queue( sc_timed_queue_kind kind )
+{
+    if ( sc_is_running() )
+    {
+        SC_REPORT_ERROR(SC_ID_TIMED_QUEUE_AFTER_START_,"");
+        return;
+    }
+
+    switch( kind )
+    {
+      case SC_TIMED_QUEUE_HEAP:
+      case SC_TIMED_QUEUE_CALENDAR:
+          timed_queue = kind;
+          break;
+      default:
+          break;
+    }
+}
+
+SC_API sc_timed_queue_kind
+sc_get_timed_queue()
+{
+    return timed_queue;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_stack_usage_report"
+//
+// This function switches the reporting of the stack usage of thread
+// processes on or off. Each thread process reports the high-water mark of
+// its stack once, when it is destroyed during simulation or at the end of
+// simulation. If it is never called, reporting is switched on by setting
+// the environment variable SC_STACK_USAGE_REPORT.
+//     enable = true to report the stack usage.
+//------------------------------------------------------------------------------
+SC_API void sc_set_stack_usage_report( bool enable )
+{
+    stack_usage_report = enable;
+}
+
+SC_API bool
+sc_get_stack_usage_report()
+{
+    if ( stack_usage_report < 0 )
+        stack_usage_report = ( std::getenv("SC_STACK_USAGE_REPORT") != NULL );
+    return stack_usage_report != 0;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_parallel_workers"
+//
+// This function sets the number of host threads, including the simulation
+// thread, that execute processes marked as parallel-safe and the updates of
+// parallel-safe primitive channels. A value of 0 or 1 selects sequential
+// execution. If it is never called, the value of the
+// environment variable SC_PARALLEL_WORKERS is used.
+//     workers = number of host threads.
+//------------------------------------------------------------------------------
+SC_API void sc_set_parallel_workers( unsigned workers )
+{
+    if ( sc_is_running() )
+    {
+        SC_REPORT_ERROR(SC_ID_PARALLEL_WORKERS_AFTER_START_,"");
+        return;
+    }
+#if defined(SC_DISABLE_PARALLEL_SIMULATION)
+    if ( workers > 1 )
+    {
+        SC_REPORT_WARNING(SC_ID_PARALLEL_NOT_SUPPORTED_,"");
+        workers = 1;
+    }
+#endif
+    parallel_workers = workers ? workers : 1;
+}
+
+SC_API unsigned
+sc_get_parallel_workers()
+{
+#if !defined(SC_DISABLE_PARALLEL_SIMULATION)
+    if ( parallel_workers == 0 )
+    {
+        const char* workers = std::getenv("SC_PARALLEL_WORKERS");
+        int workers_n = (workers != NULL) ? std::atoi(workers) : 0;
+        parallel_workers = ( workers_n > 1 ) ? workers_n : 1;
+    }
+    return parallel_workers;
+#else
+    return 1;
+#endif
+}
+
 SC_API bool sc_is_unwinding()
 {
     return sc_get_current_process_handle().is_unwinding();
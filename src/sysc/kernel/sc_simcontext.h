@@ -31,7 +31,11 @@
 #define SC_SIMCONTEXT_H
 
 #include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/kernel/sc_elab_profiler.h"
+#include "sysc/kernel/sc_kernel_pool.h"
+#include "sysc/kernel/sc_kernel_stats.h"
 #include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_process_profiler.h"
 #include "sysc/kernel/sc_status.h"
 #include "sysc/kernel/sc_time.h"
 #include "sysc/utils/sc_hash.h"
@@ -46,6 +50,8 @@ namespace sc_core {
 
 // forward declarations
 
+class sc_clock;
+class sc_sync_domain;
 class sc_cor;
 class sc_cor_pkg;
 class sc_event;
@@ -60,10 +66,15 @@ class sc_object_manager;
 class sc_phase_callback_registry;
 class sc_process_handle;
 class sc_port_registry;
+class sc_prim_channel;
 class sc_prim_channel_registry;
 class sc_process_table;
+class sc_parallel_engine;
+class sc_timed_queue;
+class sc_checkpoint;
 class sc_signal_bool_deval;
 class sc_trace_file;
+class sc_trace_marker;
 class sc_runnable;
 class sc_process_host;
 class sc_method_process;
@@ -91,6 +102,22 @@ enum sc_stop_mode {          // sc_stop modes:
 extern SC_API void sc_set_stop_mode( sc_stop_mode mode );
 extern SC_API sc_stop_mode sc_get_stop_mode();
 
+// number of host threads for parallel-safe processes/updates (1: sequential)
+extern SC_API void sc_set_parallel_workers( unsigned workers );
+extern SC_API unsigned sc_get_parallel_workers();
+
+enum sc_timed_queue_kind {   // implementations of the timed event queue:
+    SC_TIMED_QUEUE_HEAP,     // binary heap
+    SC_TIMED_QUEUE_CALENDAR  // calendar queue
+};
+extern SC_API void sc_set_timed_queue( sc_timed_queue_kind kind );
+extern SC_API sc_timed_queue_kind sc_get_timed_queue();
+
+// report the stack high-water mark of each thread process when it is
+// destroyed during simulation or at the end of simulation
+extern SC_API void sc_set_stack_usage_report( bool enable );
+extern SC_API bool sc_get_stack_usage_report();
+
 enum sc_starvation_policy 
 {
     SC_EXIT_ON_STARVATION,
@@ -151,6 +178,7 @@ class SC_API sc_simcontext
     friend class sc_time;
     friend class sc_time_tuple;
     friend class sc_clock;
+    friend class sc_sync_domain;
     friend class sc_method_process;
     friend class sc_phase_callback_registry;
     friend class sc_process_b;
@@ -158,6 +186,12 @@ class SC_API sc_simcontext
     friend class sc_prim_channel;
     friend class sc_cthread_process;
     friend class sc_thread_process;
+    friend class sc_parallel_engine;
+    friend class sc_coroutine_process;
+    friend class sc_checkpoint;
+    friend class sc_prim_channel_registry;
+    friend class sc_signal_channel;
+    friend class sc_trace_marker;
     friend SC_API sc_dt::uint64 sc_delta_count();
     friend SC_API const std::vector<sc_event*>& sc_get_top_level_events(
         const sc_simcontext* simc_p);
@@ -168,6 +202,8 @@ class SC_API sc_simcontext
     friend SC_API bool sc_end_of_simulation_invoked();
     friend SC_API void sc_start( const sc_time&, sc_starvation_policy );
     friend SC_API bool sc_start_of_simulation_invoked();
+    friend SC_API void sc_checkpoint_restore( const char* );
+    friend SC_API bool sc_checkpoint_restored();
     friend void sc_thread_cor_fn(void*);
     friend SC_API sc_time sc_time_to_pending_activity( const sc_simcontext* );
     friend SC_API bool sc_pending_activity_at_current_time( const sc_simcontext* );
@@ -259,6 +295,7 @@ public:
 
     void add_trace_file( sc_trace_file* );
     void remove_trace_file( sc_trace_file* );
+    void flush_trace_files();
 
     friend SC_API void    sc_set_time_resolution( double, sc_time_unit );
     friend SC_API sc_time sc_get_time_resolution();
@@ -276,6 +313,7 @@ public:
     bool is_running() const;
     bool update_phase() const;
     bool notify_phase() const;
+    bool parallel_phase() const;
     bool get_error();
     void set_error( sc_report* );
 
@@ -283,6 +321,15 @@ public:
         { return m_cor_pkg; }
     sc_cor* next_cor();
 
+    sc_kernel_stats& kernel_stats()
+        { return m_stats; }
+    sc_elab_profiler& elab_profiler()
+        { return m_elab_profiler; }
+    sc_process_profiler& process_profiler()
+        { return m_process_profiler; }
+    sc_kernel_pool& kernel_pool()
+        { return *m_kernel_pool; }
+
     void add_reset_finder( sc_reset_finder* );
 
     const ::std::vector<sc_object*>& get_child_objects() const;
@@ -305,12 +352,16 @@ private:
     int add_delta_event( sc_event* );
     void remove_delta_event( sc_event* );
     void add_timed_event( sc_event_timed* );
+    void remove_timed_event( sc_event_timed* );
 
     void trace_cycle( bool delta_cycle );
 
     void execute_method_next( sc_method_handle );
     void execute_thread_next( sc_thread_handle );
 
+    // the scheduler switches to next_p (0 if none): charge the host time
+    void switch_process( sc_process_b* next_p, bool new_run = true );
+
     sc_method_handle pop_runnable_method();
     sc_thread_handle pop_runnable_thread();
 
@@ -321,6 +372,7 @@ private:
     void push_runnable_thread( sc_thread_handle );
 
     void push_runnable_method_front( sc_method_handle );
+    void push_ranked_method( sc_method_handle );
     void push_runnable_thread_front( sc_thread_handle );
 
     void remove_runnable_method( sc_method_handle );
@@ -336,6 +388,22 @@ private:
 
     sc_method_handle remove_process( sc_method_handle );
     sc_thread_handle remove_process( sc_thread_handle );
+    sc_process_handle add_method_process( sc_method_handle );
+
+    sc_curr_proc_handle parallel_curr_proc_info();
+    sc_process_b* parallel_current_writer() const;
+    void parallel_request_update( sc_prim_channel& );
+    void parallel_notify_next_delta( sc_event& );
+    void parallel_mark_traces( sc_trace_marker& );
+    void parallel_set_error( sc_report* );
+
+    bool park_clock( sc_clock* );
+    void unpark_clock( sc_clock* );
+    void wake_idle_clocks();
+
+    void add_sync_domain( sc_sync_domain* );
+    void remove_sync_domain( sc_sync_domain* );
+    void pause_sync_domains();
 
 private:
 
@@ -367,12 +435,13 @@ private:
     std::vector<sc_object*>     m_child_objects;
 
     std::vector<sc_event*>      m_delta_events;
-    sc_ppq<sc_event_timed*>*    m_timed_events;
+    sc_timed_queue*             m_timed_events;
 
     std::vector<sc_trace_file*> m_trace_files;
     bool                        m_something_to_trace;
 
     sc_runnable*                m_runnable;
+    sc_method_handle            m_ranked_writer; // compressed signal writer.
     sc_process_list*            m_collectable;
 
     sc_time_params*             m_time_params;
@@ -399,6 +468,19 @@ private:
 
     sc_reset_finder*            m_reset_finder_q; // Q of reset finders to reconcile.
 
+    sc_parallel_engine*         m_parallel;       // host-parallel evaluation.
+    bool                        m_parallel_phase; // workers are executing.
+
+    std::vector<sc_clock*>      m_idle_clocks;    // clocks skipping edges.
+    std::vector<sc_sync_domain*> m_sync_domains;  // synchronization domains.
+
+    sc_kernel_stats             m_stats;          // performance counters.
+    sc_elab_profiler            m_elab_profiler;  // elaboration profile.
+    sc_process_profiler         m_process_profiler; // process host time.
+    sc_kernel_pool*             m_kernel_pool;    // kernel object memory.
+    sc_checkpoint*              m_checkpoint_p;   // checkpoint to restore.
+    bool                        m_checkpoint_restored;
+
 private:
 
     // disabled
@@ -503,6 +585,8 @@ inline
 sc_curr_proc_handle
 sc_simcontext::get_curr_proc_info()
 {
+    if( SC_UNLIKELY_( m_parallel_phase ) )
+        return parallel_curr_proc_info();
     return &m_curr_proc_info;
 }
 
@@ -576,10 +660,21 @@ sc_simcontext::notify_phase() const
     return m_execution_phase == phase_notify;
 }
 
+inline
+bool
+sc_simcontext::parallel_phase() const
+{
+    return m_parallel_phase;
+}
+
 inline
 void
 sc_simcontext::set_error( sc_report* err )
 {
+    if( SC_UNLIKELY_( m_parallel_phase ) ) {
+        parallel_set_error( err );
+        return;
+    }
     delete m_error;
     m_error = err;
 }
@@ -600,18 +695,13 @@ sc_simcontext::add_delta_event( sc_event* e )
     return static_cast<int>( m_delta_events.size() - 1 );
 }
 
-inline
-void
-sc_simcontext::add_timed_event( sc_event_timed* et )
-{
-    m_timed_events->insert( et );
-}
-
 // ----------------------------------------------------------------------------
 
 inline sc_process_b*
 sc_simcontext::get_current_writer() const
 {
+    if( SC_UNLIKELY_( m_parallel_phase ) )
+        return parallel_current_writer();
     return m_current_writer;
 }
 
@@ -102,6 +102,22 @@ sc_simcontext::reset_curr_proc()
     sc_process_b::m_last_created_process_p = 0;
 }
 
+//------------------------------------------------------------------------------
+//"sc_simcontext::switch_process"
+//
+// This method is the single hook the scheduler calls whenever it switches
+// to another process, or to none, for the kernel statistics and the process
+// profiler. A continuation after a preempting process is not a new run.
+//------------------------------------------------------------------------------
+inline
+void
+sc_simcontext::switch_process( sc_process_b* next_p, bool new_run )
+{
+    SC_KERNEL_STATS_( m_stats.switch_to( next_p, new_run ) );
+    if ( SC_UNLIKELY_( m_process_profiler.enabled() ) )
+	m_process_profiler.switch_to( next_p, new_run );
+}
+
 inline
 void
 sc_simcontext::execute_method_next( sc_method_handle method_h )
@@ -175,7 +191,10 @@ sc_simcontext::preempt_with( sc_thread_handle thread_h )
 	}
         DEBUG_MSG( DEBUG_NAME, thread_h, "preempting method with thread" );
 	set_curr_proc( (sc_process_b*)thread_h );
+	switch_process( thread_h );
+	SC_KERNEL_STATS_( m_stats.context_switch() );
 	m_cor_pkg->yield( thread_h->m_cor_p );
+	switch_process( method_p, false );
 	m_curr_proc_info = caller_info;
         DEBUG_MSG(DEBUG_NAME, thread_h, "back from preempting method w/thread");
 	method_p->check_for_throws();
@@ -217,7 +236,10 @@ inline
 void
 sc_simcontext::push_runnable_method( sc_method_handle method_h )
 {
-    m_runnable->push_back_method( method_h );
+    if( SC_UNLIKELY_( m_ranked_writer != 0 ) )
+        push_ranked_method( method_h );
+    else
+        m_runnable->push_back_method( method_h );
 }
 
 inline
@@ -0,0 +1,238 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_sync_domain.cpp -- Decoupled subsystems simulated on their own host
+                        threads.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_sync_domain.h"
+#include "sysc/kernel/sc_host_thread.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_wait.h"
+#include "sysc/communication/sc_host_semaphore.h"
+#include "sysc/communication/sc_sync_channel.h"
+
+#include <exception>
+
+// Host threads are only available together with async_request_update(),
+// which the synchronization channels need to reach the kernel.
+#if !defined(SC_DISABLE_PARALLEL_SIMULATION) && \
+    !defined(SC_DISABLE_ASYNC_UPDATES)
+#   define SC_SYNC_DOMAIN_THREADS_
+#endif
+
+namespace sc_core {
+
+static sc_time sync_quantum;
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_sync_domain
+//
+//  Base class of a subsystem simulated on its own host thread.
+// ----------------------------------------------------------------------------
+
+void sc_sync_domain::set_quantum( const sc_time& quantum_ )
+{
+    if ( sc_is_running() )
+    {
+        SC_REPORT_ERROR(SC_ID_SYNC_QUANTUM_AFTER_START_,"");
+        return;
+    }
+    sync_quantum = quantum_;
+}
+
+const sc_time& sc_sync_domain::quantum()
+{
+    return sync_quantum;
+}
+
+bool sc_sync_domain::concurrent()
+{
+#if defined(SC_SYNC_DOMAIN_THREADS_)
+    return true;
+#else
+    return false;
+#endif
+}
+
+sc_sync_domain::sc_sync_domain( const sc_module_name& name_ )
+  : sc_module( name_ ),
+    m_thread_p(0), m_start_p(0), m_done_p(0), m_from(), m_to(),
+    m_released(false), m_shutdown(false), m_error()
+{
+    SC_THREAD( synchronize );
+    simcontext()->add_sync_domain( this );
+}
+
+sc_sync_domain::~sc_sync_domain()
+{
+    shutdown();
+    simcontext()->remove_sync_domain( this );
+}
+
+void sc_sync_domain::start_of_simulation()
+{
+    if ( sync_quantum == SC_ZERO_TIME )
+    {
+        SC_REPORT_ERROR(SC_ID_SYNC_QUANTUM_ZERO_, name());
+        return;
+    }
+#if defined(SC_SYNC_DOMAIN_THREADS_)
+    if ( m_thread_p == 0 )
+    {
+        m_start_p = new sc_host_semaphore;
+        m_done_p = new sc_host_semaphore;
+        m_thread_p = new sc_host_thread;
+        m_thread_p->start( &thread_main, this );
+    }
+#endif // SC_SYNC_DOMAIN_THREADS_
+}
+
+//------------------------------------------------------------------------------
+//"sc_sync_domain::synchronize"
+//
+// This thread process drives the domain through the windows. All domains
+// share the quantum, so their threads wake up in the same delta cycle at
+// the end of a window. Each one first waits for its domain to finish the
+// window; the next window is released one delta cycle later, once every
+// domain has finished, so that no domain can start a window before the
+// messages it may read from the previous one have all been written. The
+// last thread to join publishes these messages to the kernel.
+//------------------------------------------------------------------------------
+void sc_sync_domain::synchronize()
+{
+    for ( ;; )
+    {
+        const sc_time from = sc_time_stamp();
+        release( from, from + sync_quantum );
+        wait( sync_quantum );
+        join();
+        wait( SC_ZERO_TIME );
+    }
+}
+
+void sc_sync_domain::release( const sc_time& from, const sc_time& to )
+{
+    m_from = from;
+    m_to = to;
+    m_released = true;
+    if ( m_thread_p )
+        m_start_p->post();
+}
+
+void sc_sync_domain::join()
+{
+    pause();
+
+    // the last domain to finish the window publishes the messages of all
+    const std::vector<sc_sync_domain*>& domains = simcontext()->m_sync_domains;
+    bool all_joined = true;
+    for ( std::size_t i = 0; i < domains.size() && all_joined; ++i )
+        all_joined = !domains[i]->m_released;
+    if ( all_joined )
+        sc_sync_channel_base::publish_written();
+
+    if ( !m_error.empty() )
+    {
+        std::string msg;
+        msg.swap( m_error );
+        SC_REPORT_ERROR(SC_ID_SYNC_DOMAIN_FAILED_,
+                        ( std::string( name() ) + ": " + msg ).c_str() );
+    }
+}
+
+void sc_sync_domain::run_window()
+{
+    try {
+        advance( m_from, m_to );
+    }
+    catch( const std::exception& x ) {
+        m_error = x.what();
+    }
+    catch( ... ) {
+        m_error = "unknown exception";
+    }
+}
+
+void sc_sync_domain::thread_main( void* domain_p )
+{
+    sc_sync_domain* domain = static_cast<sc_sync_domain*>( domain_p );
+    for ( ;; )
+    {
+        domain->m_start_p->wait();
+        if ( domain->m_shutdown )
+            break;
+        domain->run_window();
+        domain->m_done_p->post();
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_sync_domain::pause"
+//
+// This method finishes the released window. Besides at the end of the
+// window, it is called when sc_start() returns, so that the domain can be
+// inspected or destroyed; synchronize() then finds the window finished.
+//------------------------------------------------------------------------------
+void sc_sync_domain::pause()
+{
+    if ( !m_released )
+        return;
+    if ( m_thread_p )
+        m_done_p->wait();
+    else
+        run_window();
+    m_released = false;
+}
+
+void sc_sync_domain::shutdown()
+{
+    if ( m_thread_p == 0 )
+        return;
+    pause();
+    m_shutdown = true;
+    m_start_p->post();
+    m_thread_p->join();
+
+    delete m_thread_p;
+    delete m_done_p;
+    delete m_start_p;
+    m_thread_p = 0;
+    m_done_p = 0;
+    m_start_p = 0;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
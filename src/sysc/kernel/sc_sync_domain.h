@@ -0,0 +1,140 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_sync_domain.h -- Decoupled subsystems simulated on their own host
+                      threads.
+
+  A synchronization domain is a subsystem that advances its own local time
+  on a host thread of its own, without using the simulation kernel. All
+  domains and the kernel run concurrently through windows of one global
+  quantum: at the start of every window each domain is released to
+  simulate the window, and at its end the kernel waits until every domain
+  has finished it.
+
+  Domains communicate with each other and with kernel processes only
+  through sc_sync_channel instances. A message written in one window
+  arrives no earlier than the start of the next window (the quantum is the
+  lookahead), so every reader finds its input complete and the results do
+  not depend on the scheduling of the host threads.
+
+  Like a clock, a synchronization domain keeps the simulation alive; run
+  the simulation for a given time or stop it with sc_stop().
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_SYNC_DOMAIN_H_INCLUDED_
+#define SC_SYNC_DOMAIN_H_INCLUDED_
+
+#include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_time.h"
+
+#include <string>
+
+namespace sc_core {
+
+class sc_host_semaphore;
+class sc_host_thread;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_sync_domain
+//
+//  Base class of a subsystem simulated on its own host thread. Derived
+//  classes implement advance(), which must not call into the simulation
+//  kernel (no events, signals, waits, reports or sc_time_stamp()); its only
+//  link to the rest of the model are the sc_sync_channel instances it
+//  reads and writes with explicit local time stamps.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_sync_domain
+: public sc_module
+{
+    friend class sc_simcontext;
+
+public:
+
+    SC_HAS_PROCESS( sc_sync_domain );
+
+    // length of the synchronization windows, to be set before start
+    static void set_quantum( const sc_time& quantum );
+    static const sc_time& quantum();
+
+    // do the domains run on host threads of their own? (false if the
+    // library was built without parallel simulation or async updates, in
+    // which case each window is simulated on the simulation thread at its
+    // end)
+    static bool concurrent();
+
+    virtual const char* kind() const
+        { return "sc_sync_domain"; }
+
+protected:
+
+    explicit sc_sync_domain( const sc_module_name& name_ );
+    virtual ~sc_sync_domain();
+
+    // simulate the subsystem from local time 'from' up to, but excluding,
+    // local time 'to'; called once per window on the host thread
+    virtual void advance( const sc_time& from, const sc_time& to ) = 0;
+
+    virtual void start_of_simulation();
+
+private:
+
+    void synchronize();
+    void release( const sc_time& from, const sc_time& to );
+    void join();
+    void run_window();
+    void pause();
+    void shutdown();
+
+    static void thread_main( void* domain_p );
+
+private:
+    sc_host_thread*    m_thread_p;   // host thread, 0 if not concurrent.
+    sc_host_semaphore* m_start_p;    // posted to release a window.
+    sc_host_semaphore* m_done_p;     // posted when a window is finished.
+    sc_time            m_from;       // start of the released window.
+    sc_time            m_to;         // end of the released window.
+    bool               m_released;   // window released but not joined.
+    bool               m_shutdown;   // host thread should exit.
+    std::string        m_error;      // what() of an exception in advance().
+
+private:
+    // disabled
+    sc_sync_domain( const sc_sync_domain& );
+    sc_sync_domain& operator = ( const sc_sync_domain& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_SYNC_DOMAIN_H_INCLUDED_
+// Taf!
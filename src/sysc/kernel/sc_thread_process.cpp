@@ -34,6 +34,8 @@
 #include "sysc/kernel/sc_module.h"
 #include "sysc/utils/sc_machine.h"
 
+#include <sstream>
+
 // DEBUGGING MACROS:
 //
 // DEBUG_MSG(NAME,P,MSG)
@@ -154,6 +156,7 @@ void sc_thread_cor_fn( void* arg )
     {
 
         sc_core::sc_cor* x = simc_p->next_cor();
+	SC_KERNEL_STATS_( simc_p->kernel_stats().context_switch() );
 	simc_p->cor_pkg()->abort( x );
     }
 
@@ -337,6 +340,24 @@ void sc_thread_process::prepare_for_simulation()
 }
 
 
+//------------------------------------------------------------------------------
+//"sc_thread_process::report_stack_usage"
+//
+// This method reports the high-water mark of the stack of this object
+// instance, to help to choose its stack size.
+//------------------------------------------------------------------------------
+void sc_thread_process::report_stack_usage() const
+{
+    if ( m_cor_p == 0 )
+        return;
+
+    std::stringstream msg;
+    msg << name() << ": " << m_cor_p->stack_usage() << " of " << m_stack_size
+        << " bytes";
+    SC_REPORT_INFO( SC_ID_STACK_USAGE_, msg.str().c_str() );
+}
+
+
 //------------------------------------------------------------------------------
 //"sc_thread_process::resume_process"
 //
@@ -473,9 +494,15 @@ sc_thread_process::sc_thread_process( const char* name_p, bool free_host,
 sc_thread_process::~sc_thread_process()
 {
 
+    // RELEASE A PERSISTENT EVENT LIST, WHICH MAY LIVE ON THE STACK:
+
+    unbind_event_list();
+
     // DESTROY THE COROUTINE FOR THIS THREAD:
 
     if( m_cor_p != 0 ) {
+        if ( sc_get_stack_usage_report() && sc_is_running( simcontext() ) )
+            report_stack_usage();
         m_cor_p->stack_protect( false );
         delete m_cor_p;
         m_cor_p = 0;
@@ -692,11 +719,37 @@ void sc_thread_process::throw_user( const sc_throw_it_helper& helper,
 //------------------------------------------------------------------------------
 //"sc_thread_process::trigger_dynamic"
 //
+// This method is called by an event this object instance is registered
+// with. The events of the persistent event list the thread is bound to keep
+// the registration, whether the thread currently waits for them or not, so
+// their triggers are passed on only while it does.
+//
+// Result is true if this process should be removed from the event's list,
+// false if not.
+//------------------------------------------------------------------------------
+bool sc_thread_process::trigger_dynamic( sc_event* e )
+{
+    if ( SC_UNLIKELY_( m_bound_list_p != 0 ) && m_bound_list_p->contains( e ) )
+    {
+        if ( m_event_list_p == m_bound_list_p )
+        {
+            trigger_awaited( e );
+            return false;
+        }
+        if ( !awaits_dynamic( e ) )
+            return false;
+    }
+    return trigger_awaited( e );
+}
+
+//------------------------------------------------------------------------------
+//"sc_thread_process::trigger_awaited"
+//
 // This method sets up a dynamic trigger on an event.
 //
 // Notes:
-//   (1) This method is identical to sc_method_process::trigger_dynamic(),
-//       but they cannot be combined as sc_process_b::trigger_dynamic()
+//   (1) This method is identical to sc_method_process::trigger_awaited(),
+//       but they cannot be combined as sc_process_b::trigger_awaited()
 //       because the signatures things like sc_event::remove_dynamic()
 //       have different overloads for sc_thread_process* and sc_method_process*.
 //       So if you change code here you'll also need to change it in
@@ -705,7 +758,7 @@ void sc_thread_process::throw_user( const sc_throw_it_helper& helper,
 // Result is true if this process should be removed from the event's list,
 // false if not.
 //------------------------------------------------------------------------------
-bool sc_thread_process::trigger_dynamic( sc_event* e )
+bool sc_thread_process::trigger_awaited( sc_event* e )
 {
     // No time outs yet, and keep gcc happy.
 
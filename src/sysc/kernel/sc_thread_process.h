@@ -136,6 +136,7 @@ class sc_thread_process : public sc_process_b {
     sc_thread_handle next_exist();
     sc_thread_handle next_runnable();
     virtual void prepare_for_simulation();
+    void report_stack_usage() const;
     virtual void resume_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     void set_next_exist( sc_thread_handle next_p );
@@ -149,8 +150,9 @@ class sc_thread_process : public sc_process_b {
     virtual void throw_user( const sc_throw_it_helper& helper,
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
 
+    bool trigger_awaited( sc_event* );
     bool trigger_dynamic( sc_event* );
-    inline void trigger_static();
+    inline void trigger_static( const sc_process_b* curr_proc_p );
 
     void wait( const sc_event& );
     void wait( const sc_event_or_list& );
@@ -220,6 +222,7 @@ inline void sc_thread_process::suspend_me()
     if( m_cor_p != cor_p )
     {
         DEBUG_MSG( DEBUG_NAME , this, "suspending thread");
+        SC_KERNEL_STATS_( simc_p->kernel_stats().context_switch() );
         simc_p->cor_pkg()->yield( cor_p );
         DEBUG_MSG( DEBUG_NAME , this, "resuming thread");
     }
@@ -461,13 +464,13 @@ inline sc_cor* get_cor_pointer( sc_process_b* process_p )
 //       dynamic event waits take priority.
 //   (4) The process' static wait count is zero.
 //
-// If the triggering process is the same process, the trigger is
-// ignored as well, unless SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
+// If the triggering process curr_proc_p is the same process, the trigger
+// is ignored as well, unless SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 // is defined.
 //------------------------------------------------------------------------------
 inline
 void
-sc_thread_process::trigger_static()
+sc_thread_process::trigger_static( const sc_process_b* curr_proc_p )
 {
     // No need to try queueing this thread if one of the following is true:
     //    (a) it is disabled
@@ -480,11 +483,13 @@ sc_thread_process::trigger_static()
         return;
 
 #if ! defined( SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS )
-    if( SC_UNLIKELY_( sc_get_current_process_b() == this ) )
+    if( SC_UNLIKELY_( curr_proc_p == this ) )
     {
         report_immediate_self_notification();
         return;
     }
+#else
+    (void) curr_proc_p;
 #endif // SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 
     if ( m_wait_cycle_n > 0 && THROW_NONE == m_throw_status )
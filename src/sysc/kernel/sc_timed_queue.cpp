@@ -0,0 +1,316 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timed_queue.cpp -- Queues of pending timed event notifications.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_timed_queue.h"
+#include "sysc/kernel/sc_event.h"
+
+#include <algorithm>
+
+namespace sc_core {
+
+// the bucket ring never shrinks below this size.
+
+static const std::size_t calendar_buckets_min = 16;
+
+// number of earliest entries used to estimate the bucket width.
+
+static const std::size_t calendar_samples_n = 32;
+
+
+SC_API int
+sc_notify_time_compare( const void* p1, const void* p2 )
+{
+    const sc_event_timed* et1 = static_cast<const sc_event_timed*>( p1 );
+    const sc_event_timed* et2 = static_cast<const sc_event_timed*>( p2 );
+
+    const sc_time& t1 = et1->notify_time();
+    const sc_time& t2 = et2->notify_time();
+
+    if( t1 < t2 ) {
+	return 1;
+    } else if( t1 > t2 ) {
+	return -1;
+    } else {
+	return 0;
+    }
+}
+
+sc_timed_queue* sc_timed_queue::create( sc_timed_queue_kind kind )
+{
+    switch( kind )
+    {
+      case SC_TIMED_QUEUE_CALENDAR:
+        return new sc_timed_calendar;
+      case SC_TIMED_QUEUE_HEAP:
+      default:
+        return new sc_timed_heap;
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_heap
+//
+//  Binary heap of timed event notifications.
+// ----------------------------------------------------------------------------
+
+sc_timed_heap::sc_timed_heap()
+  : m_heap( 128, sc_notify_time_compare )
+{}
+
+// cancelled entries are dropped when they reach the top of the heap.
+
+void sc_timed_heap::remove( sc_event_timed* et )
+{
+    et->m_event = 0;
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_calendar
+//
+//  Calendar queue of timed event notifications.
+// ----------------------------------------------------------------------------
+
+sc_timed_calendar::sc_timed_calendar()
+  : m_buckets( calendar_buckets_min ), m_mask( calendar_buckets_min - 1 ),
+    m_width( 1 ), m_size( 0 ), m_curr( 0 ), m_curr_end( 1 ), m_samples()
+{}
+
+sc_timed_calendar::~sc_timed_calendar()
+{
+    for ( std::size_t i = 0; i < m_buckets.size(); ++i )
+    {
+        sc_event_timed* next_p;
+        for ( sc_event_timed* et = m_buckets[i].head_p; et; et = next_p )
+        {
+            next_p = et->m_next_p;
+            delete et;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_timed_calendar::top"
+//
+// This method returns the earliest entry. Starting with the bucket of the
+// previous result, the buckets are visited in ring order, each one for the
+// span of time it covers in the current "year". The first bucket holding an
+// entry within its span has the earliest one at its head. If a full year
+// passes without finding one, the queue is sparse and the heads of all
+// buckets are searched instead.
+//------------------------------------------------------------------------------
+sc_event_timed* sc_timed_calendar::top()
+{
+    if ( m_size == 0 )
+        return 0;
+
+    std::size_t i = m_curr;
+    value_type  end = m_curr_end;
+    for ( std::size_t n = 0; n <= m_mask; ++n )
+    {
+        sc_event_timed* et = m_buckets[i].head_p;
+        if ( et != 0 && et->notify_time().value() < end )
+        {
+            m_curr = i;
+            m_curr_end = end;
+            return et;
+        }
+        i = ( i + 1 ) & m_mask;
+        end += m_width;
+    }
+
+    sc_event_timed* top_p = 0;
+    for ( i = 0; i <= m_mask; ++i )
+    {
+        sc_event_timed* et = m_buckets[i].head_p;
+        if ( et != 0 && ( top_p == 0 ||
+                          et->notify_time() < top_p->notify_time() ) )
+            top_p = et;
+    }
+    start_at( top_p->notify_time().value() );
+    return top_p;
+}
+
+sc_event_timed* sc_timed_calendar::extract_top()
+{
+    sc_event_timed* et = top();
+    if ( et != 0 )
+    {
+        unlink( et );
+        if ( static_cast<std::size_t>( --m_size ) < m_buckets.size() / 2 &&
+             m_buckets.size() > calendar_buckets_min )
+            resize( m_buckets.size() / 2 );
+    }
+    return et;
+}
+
+void sc_timed_calendar::insert( sc_event_timed* et )
+{
+    link( et );
+    value_type t = et->notify_time().value();
+    if ( t < m_curr_end - m_width )
+        start_at( t );
+    if ( static_cast<std::size_t>( ++m_size ) > 2 * m_buckets.size() )
+        resize( 2 * m_buckets.size() );
+}
+
+void sc_timed_calendar::remove( sc_event_timed* et )
+{
+    unlink( et );
+    et->m_event = 0;
+    delete et;
+    if ( static_cast<std::size_t>( --m_size ) < m_buckets.size() / 2 &&
+         m_buckets.size() > calendar_buckets_min )
+        resize( m_buckets.size() / 2 );
+}
+
+// insert behind the last entry of the bucket that is not later, so entries
+// for the same time keep their insertion order.
+
+void sc_timed_calendar::link( sc_event_timed* et )
+{
+    value_type t = et->notify_time().value();
+    bucket&    b = m_buckets[index( t )];
+
+    sc_event_timed* prev_p = b.tail_p;
+    while ( prev_p != 0 && prev_p->notify_time().value() > t )
+        prev_p = prev_p->m_prev_p;
+
+    et->m_prev_p = prev_p;
+    if ( prev_p != 0 ) {
+        et->m_next_p = prev_p->m_next_p;
+        prev_p->m_next_p = et;
+    } else {
+        et->m_next_p = b.head_p;
+        b.head_p = et;
+    }
+    if ( et->m_next_p != 0 )
+        et->m_next_p->m_prev_p = et;
+    else
+        b.tail_p = et;
+}
+
+void sc_timed_calendar::unlink( sc_event_timed* et )
+{
+    bucket& b = m_buckets[index( et->notify_time().value() )];
+
+    if ( et->m_prev_p != 0 )
+        et->m_prev_p->m_next_p = et->m_next_p;
+    else
+        b.head_p = et->m_next_p;
+    if ( et->m_next_p != 0 )
+        et->m_next_p->m_prev_p = et->m_prev_p;
+    else
+        b.tail_p = et->m_prev_p;
+    et->m_prev_p = 0;
+    et->m_next_p = 0;
+}
+
+// make the bucket holding time t the one to search first.
+
+void sc_timed_calendar::start_at( value_type t )
+{
+    m_curr = index( t );
+    m_curr_end = ( t / m_width + 1 ) * m_width;
+}
+
+// The notifications for the same time are all in one bucket, in the order
+// of their insertion.
+
+void
+sc_timed_calendar::get_entries( std::vector<sc_event_timed*>& entries ) const
+{
+    for ( std::size_t i = 0; i <= m_mask; ++i )
+        for ( sc_event_timed* et = m_buckets[i].head_p; et; et = et->m_next_p )
+            entries.push_back( et );
+}
+
+//------------------------------------------------------------------------------
+//"sc_timed_calendar::resize"
+//
+// This method rebuilds the ring with the supplied number of buckets. The new
+// bucket width is three times the average distance of the earliest entries,
+// ignoring distances of more than twice the average, as proposed by Brown.
+//------------------------------------------------------------------------------
+void sc_timed_calendar::resize( std::size_t buckets_n )
+{
+    value_type start = m_curr_end - m_width;
+
+    m_samples.clear();
+    for ( std::size_t i = 0; i <= m_mask; ++i )
+        for ( sc_event_timed* et = m_buckets[i].head_p; et; et = et->m_next_p )
+            m_samples.push_back( et->notify_time().value() );
+
+    std::size_t samples_n = std::min( m_samples.size(), calendar_samples_n );
+    if ( samples_n > 1 )
+    {
+        std::partial_sort( m_samples.begin(), m_samples.begin() + samples_n,
+                           m_samples.end() );
+        value_type average = ( m_samples[samples_n - 1] - m_samples[0] )
+                           / ( samples_n - 1 );
+        value_type sum = 0;
+        value_type gaps_n = 0;
+        for ( std::size_t i = 1; i < samples_n; ++i )
+        {
+            value_type gap = m_samples[i] - m_samples[i - 1];
+            if ( gap <= 2 * average ) {
+                sum += gap;
+                ++gaps_n;
+            }
+        }
+        value_type width = 3 * sum / gaps_n;
+        if ( width != 0 )
+            m_width = width;
+    }
+
+    std::vector<bucket> buckets( buckets_n );
+    buckets.swap( m_buckets );
+    m_mask = buckets_n - 1;
+    for ( std::size_t i = 0; i < buckets.size(); ++i )
+    {
+        sc_event_timed* next_p;
+        for ( sc_event_timed* et = buckets[i].head_p; et; et = next_p )
+        {
+            next_p = et->m_next_p;
+            link( et );
+        }
+    }
+    start_at( start );
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,205 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timed_queue.h -- Queues of pending timed event notifications.
+
+  The simulation context keeps its timed notifications in one of the
+  following implementations, selected by sc_set_timed_queue():
+
+    - sc_timed_heap: binary heap (sc_ppq). Cancelled notifications stay in
+      the heap until they reach its top.
+    - sc_timed_calendar: calendar queue, R. Brown, "Calendar Queues: A Fast
+      O(1) Priority Queue Implementation for the Simulation Event Set
+      Problem", CACM 31(10), 1988. Notifications for the same time are
+      delivered in the order of their insertion, and cancelled ones are
+      unlinked and freed immediately.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_TIMED_QUEUE_H_INCLUDED_
+#define SC_TIMED_QUEUE_H_INCLUDED_
+
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/utils/sc_pq.h"
+
+#include <vector>
+
+namespace sc_core {
+
+class sc_event_timed;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_queue
+//
+//  Interface of the queue of timed event notifications.
+// ----------------------------------------------------------------------------
+
+class sc_timed_queue
+{
+public:
+
+    virtual ~sc_timed_queue() {}
+
+    // the notification with the earliest time, 0 if the queue is empty
+    virtual sc_event_timed* top() = 0;
+    virtual sc_event_timed* extract_top() = 0;
+
+    virtual void insert( sc_event_timed* et ) = 0;
+
+    // cancel a notification; it may be deleted right away or remain in the
+    // queue with its event reset to 0
+    virtual void remove( sc_event_timed* et ) = 0;
+
+    virtual int size() const = 0;
+    bool empty() const
+        { return size() == 0; }
+
+    // append the queued notifications in no particular order, except
+    // that those with the same time keep the order of their delivery if
+    // the queue defines one; the queue is not changed
+    virtual void get_entries( std::vector<sc_event_timed*>& entries ) const = 0;
+
+    virtual sc_timed_queue_kind kind() const = 0;
+
+    static sc_timed_queue* create( sc_timed_queue_kind kind );
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_heap
+//
+//  Binary heap of timed event notifications.
+// ----------------------------------------------------------------------------
+
+class sc_timed_heap : public sc_timed_queue
+{
+public:
+
+    sc_timed_heap();
+
+    virtual sc_event_timed* top()
+        { return m_heap.empty() ? 0 : m_heap.top(); }
+    virtual sc_event_timed* extract_top()
+        { return m_heap.empty() ? 0 : m_heap.extract_top(); }
+
+    virtual void insert( sc_event_timed* et )
+        { m_heap.insert( et ); }
+    virtual void remove( sc_event_timed* et );
+
+    virtual int size() const
+        { return m_heap.size(); }
+
+    virtual void get_entries( std::vector<sc_event_timed*>& entries ) const
+    {
+        for ( int i = 0; i < m_heap.size(); ++i )
+            entries.push_back( m_heap.get( i ) );
+    }
+
+    virtual sc_timed_queue_kind kind() const
+        { return SC_TIMED_QUEUE_HEAP; }
+
+private:
+    sc_ppq<sc_event_timed*> m_heap;
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_calendar
+//
+//  Calendar queue of timed event notifications. The notifications are
+//  hashed by time into a ring of buckets ("days") of equal width. Each
+//  bucket is a doubly linked list sorted by time. The number of buckets
+//  follows the number of queued notifications, and the bucket width is
+//  re-estimated from the spacing of the earliest notifications whenever
+//  the ring is resized.
+// ----------------------------------------------------------------------------
+
+class sc_timed_calendar : public sc_timed_queue
+{
+public:
+
+    sc_timed_calendar();
+    virtual ~sc_timed_calendar();
+
+    virtual sc_event_timed* top();
+    virtual sc_event_timed* extract_top();
+
+    virtual void insert( sc_event_timed* et );
+    virtual void remove( sc_event_timed* et );
+
+    virtual int size() const
+        { return m_size; }
+
+    virtual void get_entries( std::vector<sc_event_timed*>& entries ) const;
+
+    virtual sc_timed_queue_kind kind() const
+        { return SC_TIMED_QUEUE_CALENDAR; }
+
+private:
+
+    typedef sc_dt::uint64 value_type;
+
+    struct bucket
+    {
+        bucket() : head_p( 0 ), tail_p( 0 ) {}
+
+        sc_event_timed* head_p;
+        sc_event_timed* tail_p;
+    };
+
+    std::size_t index( value_type t ) const
+        { return static_cast<std::size_t>( t / m_width ) & m_mask; }
+
+    void link( sc_event_timed* et );
+    void unlink( sc_event_timed* et );
+    void resize( std::size_t buckets_n );
+    void start_at( value_type t );
+
+private:
+    std::vector<bucket>     m_buckets;     // ring of buckets.
+    std::size_t             m_mask;        // number of buckets - 1.
+    value_type              m_width;       // time span of a bucket.
+    int                     m_size;        // number of queued entries.
+    std::size_t             m_curr;        // bucket to search first.
+    value_type              m_curr_end;    // end of m_curr's current span.
+    std::vector<value_type> m_samples;     // scratch buffer for resize().
+
+private:
+    // disabled
+    sc_timed_calendar( const sc_timed_calendar& );
+    sc_timed_calendar& operator = ( const sc_timed_calendar& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_TIMED_QUEUE_H_INCLUDED_
+// Taf!
@@ -30,6 +30,7 @@
 
 #include "sysc/kernel/sc_except.h"
 #include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_parallel.h"
 #include "sysc/kernel/sc_cthread_process.h"
 #include "sysc/kernel/sc_thread_process.h"
 #include "sysc/kernel/sc_simcontext_int.h"
@@ -272,6 +273,12 @@ wait( const sc_time& t, const sc_event_and_list& el, sc_simcontext* simc )
 SC_API void
 next_trigger( sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record(
+            sc_parallel_frame::NEXT_TRIGGER, 0 );
+        return;
+    }
+
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
 	reinterpret_cast<sc_method_handle>( cpi->process_handle )->clear_trigger();
@@ -287,6 +294,12 @@ next_trigger( sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_event& e, sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record(
+            sc_parallel_frame::NEXT_TRIGGER_EVENT, &e );
+        return;
+    }
+
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
 	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( e );
@@ -299,6 +312,13 @@ next_trigger( const sc_event& e, sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_event_or_list& el, sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record(
+            sc_parallel_frame::NEXT_TRIGGER_OR_LIST,
+            &el.outlive_expression() );
+        return;
+    }
+
     if( el.empty() ) {
         SC_REPORT_ERROR( SC_ID_EVENT_LIST_FAILED_,
                          "next_trigger() on empty event list not allowed" );
@@ -317,6 +337,13 @@ next_trigger( const sc_event_or_list& el, sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_event_and_list& el, sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record(
+            sc_parallel_frame::NEXT_TRIGGER_AND_LIST,
+            &el.outlive_expression() );
+        return;
+    }
+
     if( el.empty() ) {
         SC_REPORT_ERROR( SC_ID_EVENT_LIST_FAILED_,
                          "next_trigger() on empty event list not allowed" );
@@ -335,6 +362,12 @@ next_trigger( const sc_event_and_list& el, sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_time& t, sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record(
+            sc_parallel_frame::NEXT_TRIGGER_TIMED, 0, t );
+        return;
+    }
+
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
 	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t );
@@ -347,6 +380,12 @@ next_trigger( const sc_time& t, sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_time& t, const sc_event& e, sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record(
+            sc_parallel_frame::NEXT_TRIGGER_TIMED_EVENT, &e, t );
+        return;
+    }
+
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
 	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, e );
@@ -359,6 +398,13 @@ next_trigger( const sc_time& t, const sc_event& e, sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_time& t, const sc_event_or_list& el, sc_simcontext* simc)
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record(
+            sc_parallel_frame::NEXT_TRIGGER_TIMED_OR_LIST,
+            &el.outlive_expression(), t );
+        return;
+    }
+
     if( el.empty() ) {
         SC_REPORT_ERROR( SC_ID_EVENT_LIST_FAILED_,
                          "next_trigger() on empty event list not allowed" );
@@ -377,6 +423,13 @@ next_trigger( const sc_time& t, const sc_event_or_list& el, sc_simcontext* simc)
 SC_API void
 next_trigger(const sc_time& t, const sc_event_and_list& el, sc_simcontext* simc)
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+        sc_parallel_frame::current()->record(
+            sc_parallel_frame::NEXT_TRIGGER_TIMED_AND_LIST,
+            &el.outlive_expression(), t );
+        return;
+    }
+
     if( el.empty() ) {
         SC_REPORT_ERROR( SC_ID_EVENT_LIST_FAILED_,
                          "next_trigger() on empty event list not allowed" );
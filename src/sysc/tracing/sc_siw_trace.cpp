@@ -0,0 +1,430 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_siw_trace.cpp - Implementation of indexed waveform (SIW) tracing.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/tracing/sc_siw_trace.h"
+#include "sysc/kernel/sc_ver.h"
+#include "sysc/utils/sc_report.h"
+
+#include <sstream>
+
+#if defined(SC_HAVE_ZLIB)
+#   include <zlib.h>
+#endif
+
+namespace sc_core {
+
+namespace {
+
+void append_varint( std::vector<unsigned char>& buf, sc_dt::uint64 v )
+{
+    while( v >= 0x80 ) {
+        buf.push_back( static_cast<unsigned char>( v | 0x80 ) );
+        v >>= 7;
+    }
+    buf.push_back( static_cast<unsigned char>( v ) );
+}
+
+unsigned bit_code( char c )
+{
+    switch( c ) {
+      case '0': return 0;
+      case '1': return 1;
+      case 'z':
+      case 'Z': return 3;
+      default:  return 2;
+    }
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+//  CLASS : siw_trace_file
+//
+//  Indexed waveform trace file.
+// ----------------------------------------------------------------------------
+
+siw_trace_file::siw_trace_file(const char* name, std::size_t block_size_)
+  : vcd_trace_file( name, "siw" )
+  , out_size(0)
+  , block_size(block_size_ ? block_size_ : 1)
+  , block_bytes(0)
+#if defined(SC_HAVE_ZLIB)
+  , compressed(true)
+#else
+  , compressed(false)
+#endif
+  , value_buf(0)
+  , encoded()
+  , now(0)
+  , block_start(0)
+  , signals()
+  , blocks()
+{}
+
+siw_trace_file::~siw_trace_file()
+{
+    if( fp ) {
+        // the last block, the index and the trailer
+        dump_ring_if_triggered();
+        write_block( now_in_units() );
+        sc_dt::uint64 index_offset = out_size;
+        put( "I", 1 );
+        put_varint( blocks.size() );
+        for( std::size_t i = 0; i < blocks.size(); ++i ) {
+            put_varint( blocks[i].start );
+            put_varint( blocks[i].end );
+            put_offset( blocks[i].offset );
+        }
+        put_offset( index_offset );
+        put( "SIWX", 4 );
+        delete fp;
+        fp = 0;
+    }
+    delete value_buf;
+}
+
+void
+siw_trace_file::output_compressed(bool flag)
+{
+    // The sections are compressed instead of the file, which could not be
+    // seeked otherwise
+    if( is_initialized() ) {
+        std::stringstream ss;
+        ss << filename() << "\n"
+           "\tThe compression cannot be changed once the file is open.";
+        SC_REPORT_ERROR( SC_ID_TRACING_ALREADY_INITIALIZED_
+                       , ss.str().c_str() );
+        return;
+    }
+#if defined(SC_HAVE_ZLIB)
+    compressed = flag;
+#else
+    if( flag )
+        SC_REPORT_WARNING( SC_ID_TRACING_COMPRESSION_UNAVAILABLE_
+                         , filename() );
+#endif
+}
+
+void
+siw_trace_file::do_initialize()
+{
+    value_buf = new sc_trace_output( 0, 1 << 12, 0 );
+    now = now_in_units();
+    block_start = now;
+    vcd_trace_file::do_initialize();
+
+    // The signals without an initial value start with none
+    for( std::size_t i = 0; i < signals.size(); ++i ) {
+        signal& s = signals[i];
+        if( s.section.empty() ) {
+            encoded.clear();
+            if( s.kind == VCD_REAL || s.width != 1 )
+                append_varint( encoded, 0 );
+            else
+                encoded.push_back( 'x' );
+            add_change( s, &encoded[0], encoded.size() );
+        }
+    }
+}
+
+void
+siw_trace_file::write_header()
+{
+    signals.resize( traces.size() );
+
+    put( "SIW\1", 4 );
+    put_varint( trace_unit_fs );
+    put_varint( compressed ? 1 : 0 );
+    put_string( localtime_string() );
+    put_string( sc_version() );
+    put_varint( signals.size() );
+    for( std::size_t i = 0; i < signals.size(); ++i ) {
+        signal& s = signals[i];
+        s.kind = trace_kind( static_cast<int>( i ) );
+        s.width = trace_width( static_cast<int>( i ) );
+        s.time = now;
+        put_string( trace_name( static_cast<int>( i ) ) );
+        unsigned char kind = static_cast<unsigned char>( s.kind );
+        put( &kind, 1 );
+        put_varint( s.width > 0 ? s.width : 0 );
+    }
+}
+
+void
+siw_trace_file::write_comment(const std::string&)
+{
+    /* Intentionally blank */
+}
+
+void
+siw_trace_file::write_time_stamp(unit_type now_units_high,
+                                 unit_type now_units_low)
+{
+    now = in_units( now_units_high, now_units_low );
+}
+
+bool
+siw_trace_file::write_value(sc_trace_output* f, int i)
+{
+    if( !encode_value( i ) )
+        return false;
+    f->put( reinterpret_cast<const char*>( &encoded[0] ), encoded.size() );
+    return true;
+}
+
+void
+siw_trace_file::write_change(int i)
+{
+    if( encode_value( i ) )
+        add_change( signals[i], &encoded[0], encoded.size() );
+}
+
+void
+siw_trace_file::write_kept_change(int i, const char* value, std::size_t length)
+{
+    add_change( signals[i], reinterpret_cast<const unsigned char*>( value ),
+                length );
+}
+
+void
+siw_trace_file::write_text(const char*)
+{
+    /* Intentionally blank */
+}
+
+void
+siw_trace_file::cycle(bool this_is_a_delta_cycle)
+{
+    vcd_trace_file::cycle(this_is_a_delta_cycle);
+
+    if( block_bytes >= block_size )
+        write_block(0);
+}
+
+// Pack the value of a trace, as formatted by its VCD trace, into encoded
+bool
+siw_trace_file::encode_value(int i)
+{
+    const char* value;
+    std::size_t length;
+    if( !value_text( value_buf, i, value, length ) )
+        return false;
+
+    const signal& s = signals[i];
+    encoded.clear();
+    if( s.kind == VCD_REAL ) {
+        append_varint( encoded, length );
+        encoded.insert( encoded.end(), value, value + length );
+    } else if( s.width == 1 ) {
+        encoded.push_back( value[0] );
+    } else {
+        append_varint( encoded, length );
+        unsigned byte = 0;
+        for( std::size_t k = 0; k < length; ++k ) {
+            byte |= bit_code( value[k] ) << ( 2 * ( k % 4 ) );
+            if( k % 4 == 3 || k + 1 == length ) {
+                encoded.push_back( static_cast<unsigned char>( byte ) );
+                byte = 0;
+            }
+        }
+    }
+    return true;
+}
+
+void
+siw_trace_file::add_change(signal& s, const unsigned char* value,
+                           std::size_t length)
+{
+    std::size_t size = s.section.size();
+
+    // the first value of the first section has no time delta
+    if( size > 0 ) {
+        append_varint( s.section, now - s.time );
+        s.time = now;
+    }
+    s.section.insert( s.section.end(), value, value + length );
+    s.value.assign( value, value + length );
+    block_bytes += s.section.size() - size;
+}
+
+//------------------------------------------------------------------------------
+//"siw_trace_file::write_block"
+//
+// This method writes the sections of the signals as a block, ending at
+// the last change or at end, whichever is later. The next block starts
+// with the current values.
+//------------------------------------------------------------------------------
+void
+siw_trace_file::write_block(sc_dt::uint64 end)
+{
+    block b;
+    b.start = block_start;
+    b.end = end > now ? end : now;
+    b.offset = out_size;
+    blocks.push_back( b );
+
+    if( compressed ) {
+        for( std::size_t i = 0; i < signals.size(); ++i )
+            compress_section( signals[i].section );
+    }
+
+    put( "B", 1 );
+    put_varint( b.start );
+    put_varint( b.end );
+    put_varint( signals.size() );
+    for( std::size_t i = 0; i < signals.size(); ++i )
+        put_varint( signals[i].section.size() );
+    for( std::size_t i = 0; i < signals.size(); ++i ) {
+        if( !signals[i].section.empty() )
+            put( &signals[i].section[0], signals[i].section.size() );
+    }
+
+    begin_block();
+}
+
+void
+siw_trace_file::begin_block()
+{
+    block_start = now;
+    block_bytes = 0;
+    for( std::size_t i = 0; i < signals.size(); ++i ) {
+        signal& s = signals[i];
+        s.section = s.value;
+        s.time = now;
+        block_bytes += s.section.size();
+    }
+}
+
+// The size of the section, followed by the section compressed, or the
+// section itself if that is not larger
+void
+siw_trace_file::compress_section(std::vector<unsigned char>& section)
+{
+#if defined(SC_HAVE_ZLIB)
+    std::vector<unsigned char> stored;
+    append_varint( stored, section.size() );
+    std::size_t head = stored.size();
+
+    uLongf length = compressBound( static_cast<uLong>( section.size() ) );
+    stored.resize( head + length );
+    if( compress( &stored[head], &length, &section[0],
+                  static_cast<uLong>( section.size() ) ) == Z_OK &&
+        length < section.size() ) {
+        stored.resize( head + length );
+    } else {
+        stored.resize( head );
+        stored.insert( stored.end(), section.begin(), section.end() );
+    }
+    section.swap( stored );
+#else
+    (void)section;
+#endif
+}
+
+void
+siw_trace_file::put(const void* data, std::size_t length)
+{
+    fp->put( static_cast<const char*>( data ), length );
+    out_size += length;
+}
+
+void
+siw_trace_file::put_varint(sc_dt::uint64 v)
+{
+    unsigned char buf[10];
+    std::size_t n = 0;
+    while( v >= 0x80 ) {
+        buf[n++] = static_cast<unsigned char>( v | 0x80 );
+        v >>= 7;
+    }
+    buf[n++] = static_cast<unsigned char>( v );
+    put( buf, n );
+}
+
+void
+siw_trace_file::put_offset(sc_dt::uint64 v)
+{
+    unsigned char buf[8];
+    for( int i = 0; i < 8; ++i )
+        buf[i] = static_cast<unsigned char>( v >> ( 8 * i ) );
+    put( buf, 8 );
+}
+
+void
+siw_trace_file::put_string(const std::string& s)
+{
+    put_varint( s.size() );
+    put( s.data(), s.size() );
+}
+
+sc_dt::uint64
+siw_trace_file::in_units(unit_type high, unit_type low) const
+{
+    if( !has_low_units() )
+        return high;
+
+    sc_dt::uint64 scale = 1;
+    for( int i = low_units_len(); i > 0; --i )
+        scale *= 10;
+    return high * scale + low;
+}
+
+sc_dt::uint64
+siw_trace_file::now_in_units() const
+{
+    unit_type high, low;
+    timestamp_in_trace_units( high, low );
+    return in_units( high, low );
+}
+
+// ----------------------------------------------------------------------------
+
+SC_API sc_trace_file*
+sc_create_siw_trace_file(const char* name, std::size_t block_size)
+{
+    sc_trace_file* tf = new siw_trace_file(name, block_size);
+    return tf;
+}
+
+SC_API void
+sc_close_siw_trace_file( sc_trace_file* tf )
+{
+    siw_trace_file* siw_tf = static_cast<siw_trace_file*>(tf);
+    delete siw_tf;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
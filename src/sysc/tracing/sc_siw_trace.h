@@ -0,0 +1,180 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_siw_trace.h - Implementation of indexed waveform (SIW) tracing.
+
+  A SIW file is a compact binary waveform file, which a tool can seek by
+  time and by signal without reading the rest of the file, e.g. to check
+  a time window of a few signals of a long regression run. Waveform
+  viewers read VCD files instead; SIW needs no writer library other than
+  the optional zlib, unlike FST. The traces and their change detection
+  are those of a VCD file. Each value change is formatted by its VCD
+  trace into a scratch buffer, packed into the section of its signal, and
+  the sections are written as a block of the SIW file whenever they
+  exceed the block size. All numbers are unsigned LEB128 varints, except
+  for the 8 byte little endian offsets, and all strings are a varint
+  length followed by the characters:
+
+    file    : "SIW" 1, header, block..., index,
+              offset of the index (8 bytes), "SIWX"
+    header  : time unit in fs, compression (0 none, 1 zlib), date,
+              version, number of signals,
+              { name, kind (0 wire, 1 real, 2 event, 3 time), width }...
+    block   : 'B', start time, end time, number of signals,
+              size of the section of each signal..., section...
+    section : value at the start time, { time delta, value }...
+    index   : 'I', number of blocks, { start time, end time, offset }...
+
+  The signals are in the order in which they were traced. The times are
+  in time units, and the time deltas of a section are relative to the
+  previous change of the signal, or the start time. A value of width 1 is
+  one VCD character, a real value is a string, and a vector is the
+  number of its bits followed by the bits, two per 0, 1, x and z, packed
+  from the least significant bits of each byte, with the leading bits
+  omitted as in VCD. A signal without a value yet starts with x, an empty
+  string, or an empty vector.
+
+  If the library is built with zlib, the sections are compressed: each
+  is the size of the section followed by the section compressed in the
+  zlib format, or by the section itself if that is not larger. The file
+  itself is not compressed, so that it can still be seeked.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_SIW_TRACE_H
+#define SC_SIW_TRACE_H
+
+#include "sysc/tracing/sc_vcd_trace.h"
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : siw_trace_file
+//
+//  Indexed waveform trace file, encoded from the VCD traces.
+// ----------------------------------------------------------------------------
+
+class siw_trace_file
+  : public vcd_trace_file
+{
+public:
+
+    // Create a SIW trace file.
+    // `Name' forms the base of the name to which `.siw' is added.
+    siw_trace_file(const char* name, std::size_t block_size);
+
+    // Flush the last block, write the index and close the file.
+    ~siw_trace_file();
+
+    // Compress the sections of the blocks, with zlib.
+    virtual void output_compressed(bool flag);
+
+protected:
+
+    // Comments are not kept in SIW files
+    void write_comment(const std::string& comment);
+
+    // Write trace info for cycle, and a block if it is full
+    void cycle(bool delta_cycle);
+
+private:
+
+    // a traced variable
+    struct signal
+    {
+        int                        kind;
+        int                        width;
+        std::vector<unsigned char> value;     // last value, encoded.
+        sc_dt::uint64              time;      // of the last change.
+        std::vector<unsigned char> section;   // changes of the block.
+    };
+
+    // a block of the index
+    struct block
+    {
+        sc_dt::uint64 start;
+        sc_dt::uint64 end;
+        sc_dt::uint64 offset;
+    };
+
+    virtual void do_initialize();
+
+    // The output of the VCD traces, encoded into the sections
+    virtual void write_header();
+    virtual void write_time_stamp(unit_type now_units_high,
+                                  unit_type now_units_low);
+    virtual bool write_value(sc_trace_output* f, int i);
+    virtual void write_change(int i);
+    virtual void write_kept_change(int i, const char* value,
+                                   std::size_t length);
+    virtual void write_text(const char* text);
+
+    // Encode the current value of trace i into encoded, returns false if
+    // there is none
+    bool encode_value(int i);
+
+    // Add an encoded value to the section of s, at the current time
+    void add_change(signal& s, const unsigned char* value,
+                    std::size_t length);
+
+    // Write the sections as a block, and start the next one
+    void write_block(sc_dt::uint64 end);
+    void begin_block();
+    void compress_section(std::vector<unsigned char>& section);
+
+    void put(const void* data, std::size_t length);
+    void put_varint(sc_dt::uint64 v);
+    void put_offset(sc_dt::uint64 v);
+    void put_string(const std::string& s);
+
+    // a time in time units, as printed in VCD
+    sc_dt::uint64 in_units(unit_type high, unit_type low) const;
+    sc_dt::uint64 now_in_units() const;
+
+    sc_dt::uint64         out_size;      // bytes written to fp.
+    std::size_t           block_size;    // of the sections of a block.
+    std::size_t           block_bytes;   // in the sections so far.
+    bool                  compressed;    // are the sections compressed?
+
+    sc_trace_output*      value_buf;     // VCD text of a value.
+    std::vector<unsigned char> encoded;  // the value encoded last.
+
+    sc_dt::uint64         now;           // time of the changes.
+    sc_dt::uint64         block_start;   // start time of the block.
+    std::vector<signal>   signals;       // in the order of the traces.
+    std::vector<block>    blocks;        // written so far.
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_SIW_TRACE_H
+// Taf!
@@ -86,6 +86,41 @@ void sc_trace_file::delta_cycles(bool)
   /* Intentionally blank */
 }
 
+void sc_trace_file::change_driven(bool)
+{
+  /* Intentionally blank */
+}
+
+void sc_trace_file::output_buffer(std::size_t, int)
+{
+  /* Intentionally blank */
+}
+
+void sc_trace_file::output_compressed(bool)
+{
+  /* Intentionally blank */
+}
+
+void sc_trace_file::enable_traces(const std::string&, bool, const sc_time&)
+{
+  /* Intentionally blank */
+}
+
+void sc_trace_file::ring_buffer(const sc_time&)
+{
+  /* Intentionally blank */
+}
+
+void sc_trace_file::trigger()
+{
+  /* Intentionally blank */
+}
+
+void sc_trace_file::flush()
+{
+  /* Intentionally blank */
+}
+
 const sc_dt::uint64&
 sc_trace_file::event_trigger_stamp(const sc_event& ev) const
 {
@@ -99,6 +134,7 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	sc_trace_source source( tf, object );
 	tf->trace( object.read(), name, width );
     }
 }
@@ -110,6 +146,7 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	sc_trace_source source( tf, object );
 	tf->trace( object.read(), name, width );
     }
 }
@@ -121,6 +158,7 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	sc_trace_source source( tf, object );
 	tf->trace( object.read(), name, width );
     }
 }
@@ -132,6 +170,7 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	sc_trace_source source( tf, object );
 	tf->trace( object.read(), name, width );
     }
 }
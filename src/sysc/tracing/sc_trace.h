@@ -74,7 +74,9 @@ namespace sc_dt
 namespace sc_core {
 
 class sc_event;
+class sc_interface;
 class sc_time;
+class sc_trace_file_base;
 
 template <class T> class sc_signal_in_if;
 
@@ -157,6 +159,35 @@ public:
     // Also trace transitions between delta cycles if flag is true.
     virtual void delta_cycles( bool flag );
 
+    // Only visit the traces of the channels updated since the last cycle
+    // if flag is true, and poll the other traces.
+    virtual void change_driven( bool flag );
+
+    // Buffer the output in blocks of block_size bytes, of which up to
+    // blocks wait for a host thread to write them, or none to write them
+    // on the simulation thread.
+    virtual void output_buffer( std::size_t block_size, int blocks );
+
+    // Compress the file in the gzip format if flag is true, when the
+    // library is built with zlib.
+    virtual void output_compressed( bool flag );
+
+    // Enable or disable the traces whose names match the glob pattern
+    // from time at on, or from the next cycle on if at has passed.
+    virtual void enable_traces( const std::string& pattern, bool enable,
+                                const sc_time& at );
+
+    // Keep the value changes of the last window in memory, and write them
+    // only when triggered.
+    virtual void ring_buffer( const sc_time& window );
+
+    // Write the value changes kept in memory at the end of the time step.
+    virtual void trigger();
+
+    // Write the buffered output to the file, with the value changes kept
+    // in memory if triggered.
+    virtual void flush();
+
     // Set time unit.
     virtual void set_time_unit( double v, sc_time_unit tu )=0;
 
@@ -259,6 +290,29 @@ DECL_TRACE_FUNC_A( sc_dt::sc_fxnum_fast )
 #undef DECL_TRACE_FUNC_B
 
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_source (implementation-defined)
+//
+//  The channel whose updates drive the traces added to a trace file during
+//  the lifetime of this object, see sc_trace_change_driven().
+// ----------------------------------------------------------------------------
+
+class SC_API sc_trace_source
+{
+public:
+    sc_trace_source( sc_trace_file* tf, const sc_interface& object );
+    ~sc_trace_source();
+
+private:
+    sc_trace_file_base* m_tf;
+
+private:
+    // disabled
+    sc_trace_source( const sc_trace_source& );
+    sc_trace_source& operator = ( const sc_trace_source& );
+};
+
+
 template <class T> 
 inline
 void
@@ -266,6 +320,7 @@ sc_trace( sc_trace_file* tf,
 	  const sc_signal_in_if<T>& object,
 	  const std::string& name )
 {
+    sc_trace_source source( tf, object );
     sc_trace( tf, object.read(), name );
 }
 
@@ -276,6 +331,7 @@ sc_trace( sc_trace_file* tf,
 	  const sc_signal_in_if<T>& object,
 	  const char* name )
 {
+    sc_trace_source source( tf, object );
     sc_trace( tf, object.read(), name );
 }
 
@@ -337,6 +393,91 @@ sc_trace_delta_cycles( sc_trace_file* tf, bool on = true )
 }
 
 
+// Turn on/off change driven tracing on trace file `tf': only the traces of
+// the signals updated since the last cycle are visited, while the other
+// traced objects are still polled. Default is to turn it on.
+
+inline
+SC_API void
+sc_trace_change_driven( sc_trace_file* tf, bool on = true )
+{
+    if( tf ) tf->change_driven( on );
+}
+
+
+// Set the output buffer of trace file `tf': the output is formatted into
+// blocks of block_size bytes, which a host thread writes to the file while
+// the simulation continues. At most `blocks' full blocks wait to be
+// written before the simulation waits for the writer. With no blocks, the
+// full blocks are written on the simulation thread.
+
+inline
+SC_API void
+sc_trace_output_buffer( sc_trace_file* tf, std::size_t block_size,
+                        int blocks = 4 )
+{
+    if( tf ) tf->output_buffer( block_size, blocks );
+}
+
+
+// Turn on/off the compression of trace file `tf' in the gzip format, before
+// the file is opened. The file name gets the suffix `.gz', and the blocks
+// of the output buffer are compressed where they are written. If the
+// library is built without zlib, a warning is given and the file is written
+// uncompressed. SIW files compress their sections instead, which they do
+// by default with zlib. Default is to turn it on.
+
+inline
+SC_API void
+sc_trace_output_compressed( sc_trace_file* tf, bool on = true )
+{
+    if( tf ) tf->output_compressed( on );
+}
+
+
+// Enable or disable the tracing into trace file `tf' at time `at', or at
+// the next cycle if `at' has passed, only of the traces whose names match
+// the glob pattern, where `*' matches any characters and `?' any one. The
+// rules take effect in the order of their times, and of the calls for the
+// same time. A disabled trace is written as unknown, except for real
+// values, and an enabled one with its current value. Supported by VCD
+// trace files.
+
+inline
+SC_API void
+sc_trace_enable( sc_trace_file* tf, bool on,
+                 const sc_time& at = SC_ZERO_TIME,
+                 const std::string& pattern = "*" )
+{
+    if( tf ) tf->enable_traces( pattern, on, at );
+}
+
+
+// Turn on ring buffer tracing on trace file `tf': the value changes of the
+// last `window' of time are kept in memory, and only written with the
+// values at the start of the window after an error report or a call of
+// sc_trace_trigger(). Supported by VCD trace files.
+
+inline
+SC_API void
+sc_trace_ring_buffer( sc_trace_file* tf, const sc_time& window )
+{
+    if( tf ) tf->ring_buffer( window );
+}
+
+
+// Write the value changes kept by trace file `tf' in ring buffer mode at
+// the end of the current time step, or when it is closed or flushed at the
+// end of simulation.
+
+inline
+SC_API void
+sc_trace_trigger( sc_trace_file* tf )
+{
+    if( tf ) tf->trigger();
+}
+
+
 // Output a comment to the trace file
 
 inline
@@ -362,6 +503,13 @@ extern SC_API void sc_close_vcd_trace_file( sc_trace_file* tf );
 extern SC_API sc_trace_file *sc_create_wif_trace_file(const char *name);
 extern SC_API void sc_close_wif_trace_file( sc_trace_file* tf );
 
+
+// ----------------------------------------------------------------------------
+// Create indexed waveform (SIW) file, written in blocks of the given size
+extern SC_API sc_trace_file *sc_create_siw_trace_file(const char *name,
+                                          std::size_t block_size = 1 << 22);
+extern SC_API void sc_close_siw_trace_file( sc_trace_file* tf );
+
 } // namespace sc_core
 
 #endif // SC_TRACE_H
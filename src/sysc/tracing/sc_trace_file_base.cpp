@@ -37,10 +37,12 @@
 
  *****************************************************************************/
 
+#include <algorithm>
 #include <ctime>
 #include <sstream>
 
 #include "sysc/tracing/sc_trace_file_base.h"
+#include "sysc/communication/sc_signal.h"
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 
@@ -58,6 +60,84 @@
 
 namespace sc_core {
 
+namespace {
+
+// drop a reference to a list of changed traces
+void release( sc_trace_marker::dirty_list* list )
+{
+    if( --list->refs == 0 )
+        delete list;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_marker
+//
+//  Marks the traces of a channel as changed.
+// ----------------------------------------------------------------------------
+
+sc_trace_marker::~sc_trace_marker()
+{
+    for( std::size_t i = 0; i < m_entries.size(); ++i )
+        release( m_entries[i].list );
+}
+
+// The lists are shared by all channels, so an update on the worker pool
+// leaves the marking to the replay of its block, which keeps the order.
+
+void
+sc_trace_marker::mark_entries()
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if( SC_UNLIKELY_( simc_p->parallel_phase() ) ) {
+        simc_p->parallel_mark_traces( *this );
+        return;
+    }
+
+    std::vector<entry>::const_iterator it = m_entries.begin();
+    for( ; it != m_entries.end(); ++it )
+    {
+        dirty_list* list = it->list;
+        if( list->active && !list->pending[it->index] )
+        {
+            list->pending[it->index] = true;
+            list->indices.push_back( it->index );
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_source
+//
+//  The channel whose updates drive the traces added to a trace file.
+// ----------------------------------------------------------------------------
+
+sc_trace_source::sc_trace_source( sc_trace_file* tf,
+                                  const sc_interface& object )
+  : m_tf( dynamic_cast<sc_trace_file_base*>( tf ) )
+{
+    const sc_signal_channel* channel_p =
+        dynamic_cast<const sc_signal_channel*>( &object );
+
+    // keep the outermost source of nested sc_trace calls
+    if( !m_tf || !channel_p || m_tf->trace_source_ ) {
+        m_tf = 0;
+        return;
+    }
+    if( !channel_p->m_trace_marker_p )
+        channel_p->m_trace_marker_p = new sc_trace_marker;
+    m_tf->trace_source_ = channel_p->m_trace_marker_p;
+}
+
+sc_trace_source::~sc_trace_source()
+{
+    if( m_tf )
+        m_tf->trace_source_ = 0;
+}
+
+// ----------------------------------------------------------------------------
+
 bool sc_trace_file_base::tracing_initialized_ = false;
 
 
@@ -73,6 +153,17 @@ sc_trace_file_base::sc_trace_file_base( const char* name, const char* extension
   , filename_()
   , initialized_(false)
   , trace_delta_cycles_(false)
+  , change_driven_(false)
+  , output_block_size_(1 << 20)
+  , output_blocks_(4)
+  , output_compressed_(false)
+  , trace_rules_()
+  , ring_window_()
+  , ring_trigger_(false)
+  , ring_errors_(0)
+  , trace_source_(0)
+  , dirty_(0)
+  , driven_()
 {
     if( !name || !*name ) {
         SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, "no name given" );
@@ -88,9 +179,10 @@ sc_trace_file_base::sc_trace_file_base( const char* name, const char* extension
     sc_object::detach();
     // register regular (non-delta) callbacks
     sc_object::register_simulation_phase_callback( SC_BEFORE_TIMESTEP );
-#else // explicitly register with simcontext
-    sc_get_curr_simcontext()->add_trace_file( this );
 #endif
+    // register with simcontext, which cycles the file without callbacks,
+    // and flushes it at the end of simulation
+    sc_get_curr_simcontext()->add_trace_file( this );
 }
 
 sc_trace_file_base::~sc_trace_file_base()
@@ -98,13 +190,15 @@ sc_trace_file_base::~sc_trace_file_base()
     if( !is_initialized() )
         SC_REPORT_WARNING( SC_ID_TRACING_CLOSE_EMPTY_FILE_, filename() );
 
-    if( fp )
-        fclose(fp);
+    delete fp;
+
+    if( dirty_ ) {
+        dirty_->active = false;
+        release( dirty_ );
+    }
 
-#if SC_TRACING_PHASE_CALLBACKS_ == 0
     // unregister from simcontext
     sc_get_curr_simcontext()->remove_trace_file( this );
-#endif
 }
 
 /*****************************************************************************/
@@ -168,9 +262,17 @@ sc_trace_file_base::initialize()
                       , ss.str().c_str() );
     }
 
+    // error reports from now on trigger the ring buffer
+    ring_errors_ = sc_report_handler::get_count( SC_ERROR )
+                 + sc_report_handler::get_count( SC_FATAL );
+
     // initialize derived tracing implementation class (VCD/WIF)
     do_initialize();
 
+    // collect the changed traces from now on
+    if( dirty_ )
+        dirty_->active = change_driven_;
+
     return initialized_;
 }
 
@@ -178,11 +280,16 @@ void
 sc_trace_file_base::open_fp()
 {
     sc_assert( !fp && filename() );
-    fp = fopen( filename(), "w" );
-    if( !fp ) {
-        SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, filename() );
+    std::string name = filename();
+    if( output_compressed_ )
+        name += ".gz";
+    FILE* file = fopen( name.c_str(), output_compressed_ ? "wb" : "w" );
+    if( !file ) {
+        SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, name.c_str() );
         sc_abort(); // can't recover from here
     }
+    fp = new sc_trace_output( file, output_block_size_, output_blocks_,
+                              output_compressed_ );
 }
 
 void
@@ -198,6 +305,102 @@ sc_trace_file_base::delta_cycles( bool flag )
 #endif
 }
 
+void
+sc_trace_file_base::change_driven( bool flag )
+{
+    if( initialized_ )
+    {
+        std::stringstream ss;
+        ss << filename_ << "\n"
+           "\tChange driven tracing cannot be selected once tracing has begun.";
+        SC_REPORT_ERROR( SC_ID_TRACING_ALREADY_INITIALIZED_
+                       , ss.str().c_str() );
+        return;
+    }
+    change_driven_ = flag;
+}
+
+void
+sc_trace_file_base::output_buffer( std::size_t block_size, int blocks )
+{
+    if( fp )
+    {
+        std::stringstream ss;
+        ss << filename_ << "\n"
+           "\tThe output buffer cannot be changed once the file is open.";
+        SC_REPORT_ERROR( SC_ID_TRACING_ALREADY_INITIALIZED_
+                       , ss.str().c_str() );
+        return;
+    }
+    output_block_size_ = block_size;
+    output_blocks_ = blocks;
+}
+
+void
+sc_trace_file_base::output_compressed( bool flag )
+{
+    if( fp )
+    {
+        std::stringstream ss;
+        ss << filename_ << "\n"
+           "\tThe compression cannot be changed once the file is open.";
+        SC_REPORT_ERROR( SC_ID_TRACING_ALREADY_INITIALIZED_
+                       , ss.str().c_str() );
+        return;
+    }
+#if defined(SC_HAVE_ZLIB)
+    output_compressed_ = flag;
+#else
+    if( flag )
+        SC_REPORT_WARNING( SC_ID_TRACING_COMPRESSION_UNAVAILABLE_
+                         , filename_.c_str() );
+#endif
+}
+
+void
+sc_trace_file_base::enable_traces( const std::string& pattern, bool enable,
+                                   const sc_time& at )
+{
+    trace_rule rule;
+    rule.at = at;
+    rule.pattern = pattern;
+    rule.enable = enable;
+
+    // after the rules of the same time
+    std::vector<trace_rule>::iterator it = trace_rules_.end();
+    while( it != trace_rules_.begin() && at < ( it - 1 )->at )
+        --it;
+    trace_rules_.insert( it, rule );
+}
+
+void
+sc_trace_file_base::ring_buffer( const sc_time& window )
+{
+    if( initialized_ )
+    {
+        std::stringstream ss;
+        ss << filename_ << "\n"
+           "\tRing buffer tracing cannot be selected once tracing has begun.";
+        SC_REPORT_ERROR( SC_ID_TRACING_ALREADY_INITIALIZED_
+                       , ss.str().c_str() );
+        return;
+    }
+    ring_window_ = window;
+}
+
+void
+sc_trace_file_base::trigger()
+{
+    ring_trigger_ = true;
+}
+
+void
+sc_trace_file_base::flush()
+{
+    if( fp )
+        fp->flush();
+}
+
 void
 sc_trace_file_base::set_time_unit( double v, sc_time_unit tu )
 {
@@ -242,6 +445,124 @@ sc_trace_file_base::add_trace_check( const std::string & name ) const
 }
 
 
+bool
+sc_trace_file_base::bind_trace_source( int index )
+{
+    if( !trace_source_ )
+        return false;
+
+    if( !dirty_ ) {
+        dirty_ = new sc_trace_marker::dirty_list;
+        dirty_->refs = 1;
+        dirty_->active = false;
+    }
+    if( static_cast<int>( dirty_->pending.size() ) <= index )
+        dirty_->pending.resize( index + 1, false );
+    if( static_cast<int>( driven_.size() ) <= index )
+        driven_.resize( index + 1, false );
+    driven_[index] = true;
+
+    sc_trace_marker::entry e = { dirty_, index };
+    trace_source_->m_entries.push_back( e );
+    ++dirty_->refs;
+    return true;
+}
+
+
+bool
+sc_trace_file_base::trace_driven( int index ) const
+{
+    return index < static_cast<int>( driven_.size() ) && driven_[index];
+}
+
+
+const std::vector<int>&
+sc_trace_file_base::changed_traces()
+{
+    static const std::vector<int> none;
+    if( !dirty_ )
+        return none;
+    std::sort( dirty_->indices.begin(), dirty_->indices.end() );
+    return dirty_->indices;
+}
+
+
+void
+sc_trace_file_base::clear_changed_traces()
+{
+    if( !dirty_ )
+        return;
+    for( std::size_t i = 0; i < dirty_->indices.size(); ++i )
+        dirty_->pending[ dirty_->indices[i] ] = false;
+    dirty_->indices.clear();
+}
+
+
+bool
+sc_trace_file_base::trace_rules_due() const
+{
+    return !trace_rules_.empty() && trace_rules_.front().at <= sc_time_stamp();
+}
+
+
+bool
+sc_trace_file_base::next_trace_rule( std::string& pattern, bool& enable )
+{
+    if( !trace_rules_due() )
+        return false;
+    pattern.swap( trace_rules_.front().pattern );
+    enable = trace_rules_.front().enable;
+    trace_rules_.erase( trace_rules_.begin() );
+    return true;
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_trace_file_base::trace_name_matches"
+//
+// This method matches the name against the glob pattern, where '*' matches
+// any characters and '?' any one character. After a mismatch, the last '*'
+// is retried one character further into the name.
+//------------------------------------------------------------------------------
+bool
+sc_trace_file_base::trace_name_matches( const std::string& pattern,
+                                        const std::string& name )
+{
+    std::size_t p = 0, n = 0;
+    std::size_t star = std::string::npos, star_n = 0;
+    while( n < name.size() ) {
+        if( p < pattern.size() &&
+            ( pattern[p] == '?' || pattern[p] == name[n] ) ) {
+            ++p;
+            ++n;
+        } else if( p < pattern.size() && pattern[p] == '*' ) {
+            star = p++;
+            star_n = n;
+        } else if( star != std::string::npos ) {
+            p = star + 1;
+            n = ++star_n;
+        } else {
+            return false;
+        }
+    }
+    while( p < pattern.size() && pattern[p] == '*' )
+        ++p;
+    return p == pattern.size();
+}
+
+
+bool
+sc_trace_file_base::ring_triggered()
+{
+    int errors = sc_report_handler::get_count( SC_ERROR )
+               + sc_report_handler::get_count( SC_FATAL );
+    bool triggered = ring_trigger_ || errors != ring_errors_;
+    ring_trigger_ = false;
+    ring_errors_ = errors;
+    return triggered;
+}
+
+
 bool
 sc_trace_file_base::has_low_units() const {
     return kernel_unit_fs > trace_unit_fs;
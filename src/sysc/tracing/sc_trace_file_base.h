@@ -51,8 +51,11 @@
 #endif
 
 #include "sysc/tracing/sc_trace.h"
+#include "sysc/tracing/sc_trace_output.h"
 #include "sysc/tracing/sc_tracing_ids.h"
 
+#include <vector>
+
 #if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
 #pragma warning(push)
 #pragma warning(disable: 4251) // DLL import for std::string
@@ -60,6 +63,62 @@
 
 namespace sc_core {
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_marker (implementation-defined)
+//
+//  Marks the traces of a channel as changed in the trace files that only
+//  visit the changed traces, see sc_trace_change_driven(). The channel
+//  calls mark() from its update. The lists of the changed traces are
+//  shared between the markers and their trace file, so either side may be
+//  destroyed first.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_trace_marker
+{
+    friend class sc_trace_file_base;
+
+public:
+
+    // the changed traces of a trace file
+    struct dirty_list
+    {
+        std::vector<int>  indices;  // changed traces, in the marking order.
+        std::vector<bool> pending;  // trace index is in indices.
+        int               refs;     // trace file and markers referring.
+        bool              active;   // changes are collected.
+    };
+
+    sc_trace_marker()
+      : m_entries()
+    {}
+
+    ~sc_trace_marker();
+
+    // mark the traces of this channel as changed
+    void mark()
+        { if( !m_entries.empty() ) mark_entries(); }
+
+private:
+
+    void mark_entries();
+
+    // a trace of this channel
+    struct entry
+    {
+        dirty_list* list;
+        int         index;
+    };
+
+    std::vector<entry> m_entries;
+
+private:
+    // disabled
+    sc_trace_marker( const sc_trace_marker& );
+    sc_trace_marker& operator = ( const sc_trace_marker& );
+};
+
+// ----------------------------------------------------------------------------
+
 // shared implementation of trace files
 class SC_API sc_trace_file_base
   : public sc_trace_file
@@ -79,6 +138,37 @@ public:
     // Also trace transitions between delta cycles if flag is true.
     virtual void delta_cycles(bool flag);
 
+    bool change_driven() const
+      { return change_driven_; }
+
+    // Only visit the changed traces of the channels if flag is true.
+    virtual void change_driven(bool flag);
+
+    // Buffer the output in blocks, written on a host thread.
+    virtual void output_buffer(std::size_t block_size, int blocks);
+
+    // Compress the file in the gzip format.
+    virtual void output_compressed(bool flag);
+
+    // Enable or disable the traces matching pattern from time at on.
+    virtual void enable_traces(const std::string& pattern, bool enable,
+                               const sc_time& at);
+
+    bool ring_buffered() const
+      { return ring_window_ != SC_ZERO_TIME; }
+
+    const sc_time& ring_window() const
+      { return ring_window_; }
+
+    // Keep the value changes of the last window in memory.
+    virtual void ring_buffer(const sc_time& window);
+
+    // Write the value changes kept in memory.
+    virtual void trigger();
+
+    // Write the buffered output to the file.
+    virtual void flush();
+
     // set a user-define timescale unit for the trace file
     virtual void set_time_unit( double v, sc_time_unit tu);
 
@@ -98,6 +188,31 @@ protected:
     // (i.e. trace file is not yet initialized)
     bool add_trace_check( const std::string& name ) const;
 
+    // let the updates of the current sc_trace_source drive the trace added
+    // at index, returns true if so
+    bool bind_trace_source( int index );
+
+    // is the trace at index driven by the updates of a channel?
+    bool trace_driven( int index ) const;
+
+    // the traces marked since the last clear_changed_traces(), sorted
+    const std::vector<int>& changed_traces();
+    void clear_changed_traces();
+
+    // is a rule of enable_traces() due at the current time?
+    bool trace_rules_due() const;
+
+    // take the next rule due, returns false if there is none
+    bool next_trace_rule( std::string& pattern, bool& enable );
+
+    // does the name match the glob pattern of enable_traces()?
+    static bool trace_name_matches( const std::string& pattern,
+                                    const std::string& name );
+
+    // were the value changes in memory triggered, by trigger() or by an
+    // error report, since the last call?
+    bool ring_triggered();
+
     // tracefile time unit < kernel unit, extra units will be placed in low part
     bool has_low_units() const;
 
@@ -120,7 +235,7 @@ private:
 #endif // SC_TRACING_PHASE_CALLBACKS_
 
 protected:
-    FILE* fp;                          // pointer to the trace file
+    sc_trace_output* fp;               // buffered output of the trace file
 
     unit_type   trace_unit_fs;         // tracefile timescale unit in femtoseconds
     unit_type   kernel_unit_fs;        // kernel timescale unit in femtoseconds
@@ -130,6 +245,29 @@ private:
     std::string filename_;             // name of the file (for reporting)
     bool        initialized_;          // tracing started?
     bool        trace_delta_cycles_;   // also trace delta transitions?
+    bool        change_driven_;        // only visit the changed traces?
+    std::size_t output_block_size_;    // of the output blocks in bytes.
+    int         output_blocks_;        // full blocks the writer may queue.
+    bool        output_compressed_;    // gzip the file, with zlib.
+
+    // a rule of enable_traces()
+    struct trace_rule
+    {
+        sc_time     at;
+        std::string pattern;
+        bool        enable;
+    };
+
+    std::vector<trace_rule> trace_rules_; // pending, in the order of time.
+    sc_time     ring_window_;          // of the ring buffer, or zero.
+    bool        ring_trigger_;         // trigger() was called.
+    int         ring_errors_;          // error reports seen so far.
+
+    sc_trace_marker*             trace_source_; // drives the traces added.
+    sc_trace_marker::dirty_list* dirty_;        // changed traces, or 0.
+    std::vector<bool>            driven_;       // traces bound to a channel.
+
+    friend class sc_trace_source;
 
     static bool tracing_initialized_;  // shared setup of tracing implementation
 
@@ -0,0 +1,429 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_trace_output.cpp - Buffered output of the trace files.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/tracing/sc_trace_output.h"
+#include "sysc/kernel/sc_host_thread.h"
+#include "sysc/communication/sc_host_mutex.h"
+#include "sysc/communication/sc_host_semaphore.h"
+
+#include <cstdarg>
+
+#if defined(SC_HAVE_ZLIB)
+#   include <zlib.h>
+#endif
+
+// The host threads are only linked in with parallel simulation, async
+// updates or POSIX threads; otherwise the blocks are written right away.
+#if !defined(SC_DISABLE_PARALLEL_SIMULATION) || \
+    !defined(SC_DISABLE_ASYNC_UPDATES) || defined(SC_USE_PTHREADS)
+#   define SC_TRACE_WRITER_THREAD_
+#endif
+
+#if defined(_MSC_VER)
+   // Windows provides safer implementation
+#  define sc_vsnprintf _vsnprintf
+#else
+#  define sc_vsnprintf vsnprintf
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_sink
+//
+//  The file of an output, written raw or compressed in the gzip format.
+//  The blocks are compressed into one stream, on the thread writing them.
+// ----------------------------------------------------------------------------
+
+class sc_trace_sink
+{
+public:
+
+    sc_trace_sink( std::FILE* file, bool compressed );
+
+    // end the compressed stream and close the file
+    ~sc_trace_sink();
+
+    void write( const char* data, std::size_t n );
+    void flush();
+
+private:
+
+#if defined(SC_HAVE_ZLIB)
+    void deflate_data( const char* data, std::size_t n, int mode );
+#endif
+
+private:
+    std::FILE*                 m_file;
+#if defined(SC_HAVE_ZLIB)
+    bool                       m_compressed;
+    z_stream                   m_stream;
+    std::vector<unsigned char> m_out;        // compressed data.
+#endif
+
+private: // disabled
+    sc_trace_sink( const sc_trace_sink& ) /* = delete */;
+    sc_trace_sink& operator=( const sc_trace_sink& ) /* = delete */;
+};
+
+sc_trace_sink::sc_trace_sink( std::FILE* file, bool compressed )
+  : m_file( file )
+#if defined(SC_HAVE_ZLIB)
+  , m_compressed( compressed ), m_stream(), m_out()
+{
+    if ( !m_compressed )
+        return;
+
+    // 15 window bits, plus 16 for the gzip header and trailer
+    if ( deflateInit2( &m_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                       15 + 16, 8, Z_DEFAULT_STRATEGY ) != Z_OK )
+        m_compressed = false;
+    else
+        m_out.resize( 1 << 16 );
+}
+#else
+{
+    (void) compressed;
+}
+#endif
+
+sc_trace_sink::~sc_trace_sink()
+{
+#if defined(SC_HAVE_ZLIB)
+    if ( m_compressed )
+    {
+        deflate_data( 0, 0, Z_FINISH );
+        deflateEnd( &m_stream );
+    }
+#endif
+    std::fclose( m_file );
+}
+
+void sc_trace_sink::write( const char* data, std::size_t n )
+{
+#if defined(SC_HAVE_ZLIB)
+    if ( m_compressed )
+    {
+        deflate_data( data, n, Z_NO_FLUSH );
+        return;
+    }
+#endif
+    std::fwrite( data, 1, n, m_file );
+}
+
+// the compressed data written so far can be decompressed completely
+
+void sc_trace_sink::flush()
+{
+#if defined(SC_HAVE_ZLIB)
+    if ( m_compressed )
+        deflate_data( 0, 0, Z_SYNC_FLUSH );
+#endif
+    std::fflush( m_file );
+}
+
+#if defined(SC_HAVE_ZLIB)
+
+void sc_trace_sink::deflate_data( const char* data, std::size_t n, int mode )
+{
+    m_stream.next_in = reinterpret_cast<Bytef*>( const_cast<char*>( data ) );
+    m_stream.avail_in = static_cast<uInt>( n );
+    do
+    {
+        m_stream.next_out = &m_out[0];
+        m_stream.avail_out = static_cast<uInt>( m_out.size() );
+        deflate( &m_stream, mode );
+        std::fwrite( &m_out[0], 1, m_out.size() - m_stream.avail_out,
+                     m_file );
+    }
+    while ( m_stream.avail_out == 0 );
+}
+
+#endif // SC_HAVE_ZLIB
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_writer
+//
+//  The ring of the full blocks of an output and the host thread writing
+//  them.
+// ----------------------------------------------------------------------------
+
+class sc_trace_writer
+{
+public:
+
+    sc_trace_writer( sc_trace_sink* sink, int blocks );
+    ~sc_trace_writer();
+
+    // pass a full block to the writer, and take an empty one back
+    void swap_block( std::vector<char>& block );
+    void flush();
+
+private:
+
+    static void thread_main( void* writer_p );
+    void run();
+
+private:
+    sc_trace_sink*    m_sink;
+    std::vector< std::vector<char> > m_blocks; // the ring.
+    std::size_t       m_tail;          // the oldest full block.
+    std::size_t       m_used;          // full blocks from the tail on.
+    bool              m_idle;          // the thread waits for work.
+    bool              m_space_waiting; // swap_block() waits for space.
+    int               m_flush_waiting; // flush() calls waiting.
+    bool              m_shutdown;
+
+    sc_host_mutex     m_mutex;         // protects the above.
+    sc_host_semaphore m_work;
+    sc_host_semaphore m_space;
+    sc_host_semaphore m_flushed;
+    sc_host_thread    m_thread;
+};
+
+sc_trace_writer::sc_trace_writer( sc_trace_sink* sink, int blocks )
+  : m_sink( sink ), m_blocks( blocks ), m_tail( 0 ), m_used( 0 ),
+    m_idle( true ), m_space_waiting( false ), m_flush_waiting( 0 ),
+    m_shutdown( false ),
+    m_mutex(), m_work( 0 ), m_space( 0 ), m_flushed( 0 ), m_thread()
+{
+    m_thread.start( &thread_main, this );
+}
+
+sc_trace_writer::~sc_trace_writer()
+{
+    flush();
+    {
+        sc_scoped_lock lock( m_mutex );
+        m_shutdown = true;
+        m_idle = false;
+    }
+    m_work.post();
+    m_thread.join();
+}
+
+//------------------------------------------------------------------------------
+//"sc_trace_writer::swap_block"
+//
+// This method puts the block at the head of the ring, waiting for the
+// writer to write the oldest block if the ring is full, and returns the
+// empty block found there.
+//------------------------------------------------------------------------------
+void sc_trace_writer::swap_block( std::vector<char>& block )
+{
+    sc_scoped_lock lock( m_mutex );
+
+    while ( m_used == m_blocks.size() )
+    {
+        m_space_waiting = true;
+        m_mutex.unlock();
+        m_space.wait();
+        m_mutex.lock();
+    }
+
+    m_blocks[ ( m_tail + m_used ) % m_blocks.size() ].swap( block );
+    ++m_used;
+    if ( m_idle )
+    {
+        m_idle = false;
+        m_work.post();
+    }
+}
+
+void sc_trace_writer::flush()
+{
+    {
+        sc_scoped_lock lock( m_mutex );
+        if ( m_idle )
+            return;
+        ++m_flush_waiting;
+    }
+    m_flushed.wait();
+}
+
+void sc_trace_writer::thread_main( void* writer_p )
+{
+    static_cast<sc_trace_writer*>( writer_p )->run();
+}
+
+//------------------------------------------------------------------------------
+//"sc_trace_writer::run"
+//
+// This method is the writer thread. It writes the oldest block without
+// holding the lock, since swap_block() does not touch the full blocks,
+// and flushes the file whenever the ring runs empty. The compression of
+// the blocks, if any, happens here as well.
+//------------------------------------------------------------------------------
+void sc_trace_writer::run()
+{
+    for ( ;; )
+    {
+        m_work.wait();
+        for ( ;; )
+        {
+            std::vector<char>* block = 0;
+            {
+                sc_scoped_lock lock( m_mutex );
+                if ( m_used == 0 )
+                {
+                    m_sink->flush();
+
+                    m_idle = true;
+                    for ( ; m_flush_waiting > 0; --m_flush_waiting )
+                        m_flushed.post();
+                    if ( m_shutdown )
+                        return;
+                    break;
+                }
+                block = &m_blocks[m_tail];
+            }
+
+            m_sink->write( &(*block)[0], block->size() );
+            block->clear();
+
+            sc_scoped_lock lock( m_mutex );
+            m_tail = ( m_tail + 1 ) % m_blocks.size();
+            --m_used;
+            if ( m_space_waiting )
+            {
+                m_space_waiting = false;
+                m_space.post();
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_output
+//
+//  Buffered output of a trace file, written in blocks on a host thread.
+// ----------------------------------------------------------------------------
+
+sc_trace_output::sc_trace_output( std::FILE* file, std::size_t block_size,
+                                  int blocks, bool compressed )
+  : m_sink( 0 ), m_block_size( block_size ? block_size : 1 ), m_block(),
+    m_writer( 0 )
+{
+    m_block.reserve( m_block_size );
+    if ( file )
+        m_sink = new sc_trace_sink( file, compressed );
+#if defined(SC_TRACE_WRITER_THREAD_)
+    if ( m_sink && blocks > 0 )
+        m_writer = new sc_trace_writer( m_sink, blocks );
+#else
+    (void) blocks;
+#endif
+}
+
+sc_trace_output::~sc_trace_output()
+{
+    if ( !m_sink )
+        return;
+    hand_over();
+    delete m_writer;
+    delete m_sink;
+}
+
+//------------------------------------------------------------------------------
+//"sc_trace_output::hand_over"
+//
+// This method empties the current block, by passing it to the writer or
+// by writing it right away. An output without file grows the block
+// instead.
+//------------------------------------------------------------------------------
+void sc_trace_output::hand_over()
+{
+    if ( !m_sink )
+    {
+        m_block_size = 2 * ( m_block.size() > m_block_size ? m_block.size()
+                                                           : m_block_size );
+        m_block.reserve( m_block_size );
+        return;
+    }
+    if ( m_block.empty() )
+        return;
+
+    if ( m_writer )
+        m_writer->swap_block( m_block );
+    else
+    {
+        m_sink->write( &m_block[0], m_block.size() );
+        m_block.clear();
+    }
+    m_block.reserve( m_block_size );
+}
+
+void sc_trace_output::print( const char* format, ... )
+{
+    char buffer[256];
+    std::va_list args;
+
+    va_start( args, format );
+    int n = sc_vsnprintf( buffer, sizeof(buffer), format, args );
+    va_end( args );
+    if ( n >= 0 && n < static_cast<int>( sizeof(buffer) ) )
+    {
+        put( buffer, n );
+        return;
+    }
+
+    // too long for the buffer, retry with enough space
+    std::vector<char> text( n >= 0 ? n + 1 : 2 * sizeof(buffer) );
+    for ( ;; )
+    {
+        va_start( args, format );
+        n = sc_vsnprintf( &text[0], text.size(), format, args );
+        va_end( args );
+        if ( n >= 0 && n < static_cast<int>( text.size() ) )
+            break;
+        text.resize( n >= 0 ? n + 1 : 2 * text.size() );
+    }
+    put( &text[0], n );
+}
+
+void sc_trace_output::flush()
+{
+    if ( !m_sink )
+        return;
+    hand_over();
+    if ( m_writer )
+        m_writer->flush();
+    else
+        m_sink->flush();
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,143 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_trace_output.h - Buffered output of the trace files.
+
+  The trace files format their text into a block in memory. A full block
+  is handed over to a host thread writing it to the file, and the tracing
+  continues in an empty block. At most the given number of blocks wait for
+  the writer; when they are all full, the simulation waits for the writer
+  to catch up, so the memory used stays bounded. Without host threads, or
+  with no blocks to hand over, the full blocks are written right away.
+
+  The file may be compressed in the gzip format, if the library is built
+  with zlib; the blocks are compressed where they are written.
+
+  An output without a file keeps all its text in memory, until it is
+  taken with clear() or erase().
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_TRACE_OUTPUT_H_INCLUDED_
+#define SC_TRACE_OUTPUT_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+namespace sc_core {
+
+class sc_trace_sink;
+class sc_trace_writer;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_output (implementation-defined)
+//
+//  Buffered output of a trace file, written in blocks on a host thread.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_trace_output
+{
+public:
+
+    // an output into file, which is closed with the output, or into
+    // memory if file is 0; compressed is ignored without zlib
+    sc_trace_output( std::FILE* file, std::size_t block_size,
+                     int blocks, bool compressed = false );
+
+    // write the buffered text and close the file
+    ~sc_trace_output();
+
+    void put( char c )
+    {
+        if( m_block.size() == m_block_size )
+            hand_over();
+        m_block.push_back( c );
+    }
+
+    void put( const char* s )
+        { put( s, std::strlen( s ) ); }
+
+    void put( const char* s, std::size_t n )
+    {
+        if( m_block.size() + n > m_block_size )
+            hand_over();
+        m_block.insert( m_block.end(), s, s + n );
+    }
+
+    // formatted like std::printf
+    void print( const char* format, ... );
+
+    // wait until the text put so far is written to the file
+    void flush();
+
+    // the text in memory, of an output without file
+    const char* data() const
+        { return m_block.empty() ? "" : &m_block[0]; }
+    std::size_t size() const
+        { return m_block.size(); }
+    void clear()
+        { m_block.clear(); }
+    void erase( std::size_t n )
+        { m_block.erase( m_block.begin(), m_block.begin() + n ); }
+
+private:
+
+    // write the current block, or pass it to the writer
+    void hand_over();
+
+private:
+    sc_trace_sink*    m_sink;       // the file, or 0.
+    std::size_t       m_block_size;
+    std::vector<char> m_block;      // the text not yet handed over.
+    sc_trace_writer*  m_writer;     // host thread writing, or 0.
+
+private: // disabled
+    sc_trace_output( const sc_trace_output& ) /* = delete */;
+    sc_trace_output& operator=( const sc_trace_output& ) /* = delete */;
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_TRACE_OUTPUT_H_INCLUDED_
+// Taf!
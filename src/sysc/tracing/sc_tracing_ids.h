@@ -53,7 +53,9 @@ SC_DEFINE_MESSAGE( SC_ID_TRACING_VCD_DELTA_CYCLE_,      704,
    "VCD delta cycle tracing with pseudo timesteps (1 unit)" )
 SC_DEFINE_MESSAGE( SC_ID_TRACING_INVALID_TIMESCALE_UNIT_, 705,
    "invalid tracing timescale unit set" )
-/* unused IDs 706-709 */
+SC_DEFINE_MESSAGE( SC_ID_TRACING_COMPRESSION_UNAVAILABLE_, 706,
+   "trace file compression not available, written uncompressed" )
+/* unused IDs 707-709 */
 SC_DEFINE_MESSAGE( SC_ID_TRACING_OBJECT_IGNORED_,       710,
                    "object cannot not be traced" )
 SC_DEFINE_MESSAGE( SC_ID_TRACING_OBJECT_NAME_FILTERED_, 711,
@@ -51,6 +51,7 @@
  *****************************************************************************/
 
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <limits>
@@ -105,20 +106,24 @@ public:
 
     // Needs to be pure virtual as has to be defined by the particular
     // type being traced
-    virtual void write(FILE* f) = 0;
+    virtual void write(sc_trace_output* f) = 0;
 
     virtual void set_width();
 
-    static const char* strip_leading_bits(const char* originalbuf);
+    static const char* strip_leading_bits(const char* begin, const char* end);
 
     // Comparison function needs to be pure virtual too
     virtual bool changed() = 0;
 
     // Make this virtual as some derived classes may overwrite
-    virtual void print_variable_declaration_line(FILE* f, const char* scoped_name);
+    virtual void print_variable_declaration_line(sc_trace_output* f, const char* scoped_name);
 
     void compose_data_line(char* rawdata, char* compdata);
-    std::string compose_line(const std::string& data);
+
+    // The bits of the value line "b<bits> <vcd_name>", kept with the trace,
+    // to be formatted in place and written with put_value_bits().
+    char* value_bits();
+    void put_value_bits(sc_trace_output* f);
 
     virtual ~vcd_trace();
 
@@ -126,6 +131,9 @@ public:
     const std::string vcd_name;
     vcd_trace_file::vcd_enum vcd_var_type;
     int bit_width;
+
+private:
+    std::vector<char> value_line;
 };
 
 
@@ -156,25 +164,48 @@ vcd_trace::compose_data_line(char* rawdata, char* compdata)
         }
         else
         {
-            const char* effective_begin = strip_leading_bits(rawdata);
+            const char* effective_begin =
+              strip_leading_bits(rawdata, rawdata + strlen(rawdata));
             std::sprintf(compdata, "b%s %s", effective_begin, vcd_name.c_str());
         }
     }
 }
 
-// same as above but not that ugly
-std::string
-vcd_trace::compose_line(const std::string& data)
+char*
+vcd_trace::value_bits()
 {
-  if(bit_width == 0)
-    return "";
-  if(bit_width == 1)
-    return data + vcd_name;
-  return std::string("b")+strip_leading_bits(data.c_str())+" "+vcd_name;
+    std::size_t width = bit_width > 0 ? bit_width : 0;
+    if( value_line.size() != width + vcd_name.size() + 2 )
+    {
+        value_line.assign( width + 2, 'b' );
+        value_line[width + 1] = ' ';
+        value_line.insert( value_line.end(), vcd_name.begin(), vcd_name.end() );
+    }
+    return &value_line[1];
 }
 
+// same as compose_data_line, but without copying the bits
 void
-vcd_trace::print_variable_declaration_line(FILE* f, const char* scoped_name)
+vcd_trace::put_value_bits(sc_trace_output* f)
+{
+    if( bit_width <= 0 )
+        return;
+
+    char* bits = &value_line[1];
+    if( bit_width == 1 )
+    {
+        f->put( bits[0] );
+        f->put( vcd_name.data(), vcd_name.size() );
+        return;
+    }
+
+    char* begin = bits + ( strip_leading_bits( bits, bits + bit_width ) - bits );
+    *--begin = 'b';
+    f->put( begin, &value_line[0] + value_line.size() - begin );
+}
+
+void
+vcd_trace::print_variable_declaration_line(sc_trace_output* f, const char* scoped_name)
 {
     char buf[2000];
 
@@ -204,7 +235,7 @@ vcd_trace::print_variable_declaration_line(FILE* f, const char* scoped_name)
                      bit_width-1);
     }
 
-    std::fputs(buf, f);
+    f->put(buf);
 }
 
 void
@@ -214,7 +245,7 @@ vcd_trace::set_width()
 }
 
 const char*
-vcd_trace::strip_leading_bits(const char* originalbuf)
+vcd_trace::strip_leading_bits(const char* begin, const char* end)
 {
     //*********************************************************************
     // - Remove multiple leading 0,z,x, and replace by only one
@@ -227,20 +258,20 @@ vcd_trace::strip_leading_bits(const char* originalbuf)
     // - For leading 0's followed by 1, remove all leading 0's
     //    b0000010101 -> b10101
 
-    const char* position = originalbuf;
+    const char* position = begin;
 
-    if( strlen(originalbuf) < 2 ||
-	(originalbuf[0] != 'z' && originalbuf[0] != 'x' &&
-	 originalbuf[0] != '0' ))
-      return originalbuf;
+    if( end - begin < 2 ||
+	(begin[0] != 'z' && begin[0] != 'x' &&
+	 begin[0] != '0' ))
+      return begin;
 
     char first_char = *position;
-    while(*position == first_char)
+    while(position != end && *position == first_char)
     {
         position++;
     }
 
-    if(first_char == '0' && *position == '1')
+    if(first_char == '0' && position != end && *position == '1')
         return position;
     // else
     return position-1;
@@ -251,6 +282,24 @@ vcd_trace::~vcd_trace()
   /* Intentionally Blank */
 }
 
+// Format the lowest n bits of a word, the most significant first, as '0'
+// and '1', four bits at a time from a table.
+static char*
+format_bits(char* p, sc_dt::uint64 word, int n)
+{
+    static const char nibbles[] = "0000000100100011010001010110011110001001"
+                                  "101010111100110111101111";
+    for( ; n % 4 != 0; --n )
+        *p++ = "01"[( word >> ( n - 1 ) ) & 1];
+    while( n > 0 )
+    {
+        n -= 4;
+        std::memcpy( p, &nibbles[4 * ( ( word >> n ) & 0xf )], 4 );
+        p += 4;
+    }
+    return p;
+}
+
 
 template <class T>
 class vcd_T_trace : public vcd_trace
@@ -269,9 +318,23 @@ class vcd_T_trace : public vcd_trace
         vcd_var_type = type_;
     }
 
-    void write( FILE* f )
+    void write( sc_trace_output* f )
     {
-        std::fprintf( f, "%s", compose_line( object.to_string() ).c_str() );
+        char* p = value_bits();
+        int n = object.length() - ( object.size() - 1 ) * sc_dt::SC_DIGIT_SIZE;
+        for( int wi = object.size() - 1; wi >= 0; --wi )
+        {
+            sc_dt::sc_digit data = object.get_word( wi );
+            sc_dt::sc_digit ctrl = object.get_cword( wi );
+            if( ctrl == 0 )
+                p = format_bits( p, data, n );
+            else
+                for( int bi = n - 1; bi >= 0; --bi )
+                    *p++ = sc_dt::sc_logic::logic_to_char[
+                        ( ( data >> bi ) & 1 ) | ( ( ( ctrl >> bi ) & 1 ) << 1 )];
+            n = sc_dt::SC_DIGIT_SIZE;
+        }
+        put_value_bits( f );
         old_value = object;
     }
 
@@ -313,7 +376,7 @@ public:
     vcd_sc_event_trace(const sc_dt::uint64& trigger_stamp_,
                        const std::string& name_,
                        const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -338,10 +401,10 @@ vcd_sc_event_trace::changed()
 }
 
 void
-vcd_sc_event_trace::write(FILE* f)
+vcd_sc_event_trace::write(sc_trace_output* f)
 {
     if(!changed()) return;
-    std::fprintf(f,"1%s", vcd_name.c_str());
+    f->print("1%s", vcd_name.c_str());
     old_trigger_stamp = trigger_stamp;
 }
 
@@ -352,7 +415,7 @@ public:
     vcd_bool_trace(const bool& object_,
 		   const std::string& name_,
 		   const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -375,12 +438,12 @@ vcd_bool_trace::changed()
 }
 
 void
-vcd_bool_trace::write(FILE* f)
+vcd_bool_trace::write(sc_trace_output* f)
 {
-    if (object == true) std::fputc('1', f);
-    else std::fputc('0', f);
+    if (object == true) f->put('1');
+    else f->put('0');
 
-    std::fprintf(f,"%s", vcd_name.c_str());
+    f->put(vcd_name.c_str());
 
     old_value = object;
 }
@@ -391,7 +454,7 @@ class vcd_sc_bit_trace : public vcd_trace {
 public:
     vcd_sc_bit_trace(const sc_dt::sc_bit& , const std::string& ,
     	const std::string& );
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -414,12 +477,12 @@ vcd_sc_bit_trace::changed()
 }
 
 void
-vcd_sc_bit_trace::write(FILE* f)
+vcd_sc_bit_trace::write(sc_trace_output* f)
 {
-    if (object == true) std::fputc('1', f);
-    else std::fputc('0', f);
+    if (object == true) f->put('1');
+    else f->put('0');
 
-    std::fprintf(f,"%s", vcd_name.c_str());
+    f->put(vcd_name.c_str());
 
     old_value = object;
 }
@@ -431,7 +494,7 @@ public:
     vcd_sc_logic_trace(const sc_dt::sc_logic& object_,
 		       const std::string& name_,
 		       const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -457,13 +520,13 @@ vcd_sc_logic_trace::changed()
 
 
 void
-vcd_sc_logic_trace::write(FILE* f)
+vcd_sc_logic_trace::write(sc_trace_output* f)
 {
     char out_char;
     out_char = map_sc_logic_state_to_vcd_state(object.to_char());
-    std::fputc(out_char, f);
+    f->put(out_char);
 
-    std::fprintf(f,"%s", vcd_name.c_str());
+    f->put(vcd_name.c_str());
 
     old_value = object;
 }
@@ -476,20 +539,22 @@ public:
     vcd_sc_unsigned_trace(const sc_dt::sc_unsigned& object_,
 			  const std::string& name_,
 			  const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
     void set_width();
 
 protected:
     const sc_dt::sc_unsigned& object;
     sc_dt::sc_unsigned old_value;
+    std::vector<sc_dt::sc_digit> digits;
 };
 
 
 vcd_sc_unsigned_trace::vcd_sc_unsigned_trace(const sc_dt::sc_unsigned& object_,
 					     const std::string& name_,
 					     const std::string& vcd_name_)
-: vcd_trace(name_, vcd_name_), object(object_), old_value(object_.length())
+: vcd_trace(name_, vcd_name_), object(object_), old_value(object_.length()),
+  digits(DIV_CEIL(object_.length()))
 // The last may look strange, but is correct
 {
     old_value = object;
@@ -502,25 +567,20 @@ vcd_sc_unsigned_trace::changed()
 }
 
 void
-vcd_sc_unsigned_trace::write(FILE* f)
-{
-    static std::vector<char> compdata(1024), rawdata(1024);
-    typedef std::vector<char>::size_type size_t;
-
-    if ( compdata.size() <= static_cast<size_t>(object.length()) ) { // include trailing \0
-        size_t sz = ( static_cast<size_t>(object.length()) + 4096 ) & (~static_cast<size_t>(4096-1));
-        std::vector<char>( sz ).swap( compdata ); // resize without copying values
-        std::vector<char>( sz ).swap( rawdata );
+vcd_sc_unsigned_trace::write(sc_trace_output* f)
+{
+    // the bits in two's complement, in digits of BITS_PER_DIGIT bits
+    std::fill( digits.begin(), digits.end(), 0 );
+    object.concat_get_data( &digits[0], 0 );
+
+    char* p = value_bits();
+    int di = static_cast<int>( digits.size() ) - 1;
+    int n = object.length() - di * BITS_PER_DIGIT;
+    for ( ; di >= 0; --di) {
+        p = format_bits( p, digits[di], n );
+        n = BITS_PER_DIGIT;
     }
-    char *rawdata_ptr  = &rawdata[0];
-
-    for (int bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[object[bitindex].to_bool()];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line(&rawdata[0], &compdata[0]);
-
-    std::fputs(&compdata[0], f);
+    put_value_bits(f);
     old_value = object;
 }
 
@@ -538,20 +598,22 @@ public:
     vcd_sc_signed_trace(const sc_dt::sc_signed& object_,
 			const std::string& name_,
 			const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
     void set_width();
 
 protected:
     const sc_dt::sc_signed& object;
     sc_dt::sc_signed old_value;
+    std::vector<sc_dt::sc_digit> digits;
 };
 
 
 vcd_sc_signed_trace::vcd_sc_signed_trace(const sc_dt::sc_signed& object_,
 					 const std::string& name_,
 					 const std::string& vcd_name_)
-: vcd_trace(name_, vcd_name_), object(object_), old_value(object_.length())
+: vcd_trace(name_, vcd_name_), object(object_), old_value(object_.length()),
+  digits(DIV_CEIL(object_.length()))
 {
     old_value = object;
 }
@@ -563,25 +625,20 @@ vcd_sc_signed_trace::changed()
 }
 
 void
-vcd_sc_signed_trace::write(FILE* f)
-{
-    static std::vector<char> compdata(1024), rawdata(1024);
-    typedef std::vector<char>::size_type size_t;
-
-    if ( compdata.size() <= static_cast<size_t>(object.length()) ) { // include trailing \0
-        size_t sz = ( static_cast<size_t>(object.length()) + 4096 ) & (~static_cast<size_t>(4096-1));
-        std::vector<char>( sz ).swap( compdata ); // resize without copying values
-        std::vector<char>( sz ).swap( rawdata );
-    }
-    char *rawdata_ptr  = &rawdata[0];
-
-    for (int bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[object[bitindex].to_bool()];
+vcd_sc_signed_trace::write(sc_trace_output* f)
+{
+    // the bits in two's complement, in digits of BITS_PER_DIGIT bits
+    std::fill( digits.begin(), digits.end(), 0 );
+    object.concat_get_data( &digits[0], 0 );
+
+    char* p = value_bits();
+    int di = static_cast<int>( digits.size() ) - 1;
+    int n = object.length() - di * BITS_PER_DIGIT;
+    for ( ; di >= 0; --di) {
+        p = format_bits( p, digits[di], n );
+        n = BITS_PER_DIGIT;
     }
-    *rawdata_ptr = '\0';
-    compose_data_line(&rawdata[0], &compdata[0]);
-
-    std::fputs(&compdata[0], f);
+    put_value_bits(f);
     old_value = object;
 }
 
@@ -598,7 +655,7 @@ public:
     vcd_sc_uint_base_trace(const sc_dt::sc_uint_base& object_,
 			   const std::string& name_,
 			   const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
     void set_width();
 
@@ -625,19 +682,10 @@ vcd_sc_uint_base_trace::changed()
 }
 
 void
-vcd_sc_uint_base_trace::write(FILE* f)
+vcd_sc_uint_base_trace::write(sc_trace_output* f)
 {
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for (bitindex = object.length()-1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[object[bitindex].to_bool()];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line(rawdata, compdata);
-
-    std::fputs(compdata, f);
+    format_bits( value_bits(), object.value(), object.length() );
+    put_value_bits(f);
     old_value = object;
 }
 
@@ -655,7 +703,7 @@ public:
     vcd_sc_int_base_trace(const sc_dt::sc_int_base& object_,
 			  const std::string& name_,
 			  const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
     void set_width();
 
@@ -680,19 +728,10 @@ vcd_sc_int_base_trace::changed()
 }
 
 void
-vcd_sc_int_base_trace::write(FILE* f)
+vcd_sc_int_base_trace::write(sc_trace_output* f)
 {
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for (bitindex = object.length()-1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[object[bitindex].to_bool()];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line(rawdata, compdata);
-
-    std::fputs(compdata, f);
+    format_bits( value_bits(), object.value(), object.length() );
+    put_value_bits(f);
     old_value = object;
 }
 
@@ -712,7 +751,7 @@ public:
     vcd_sc_fxval_trace( const sc_dt::sc_fxval& object_,
 			const std::string& name_,
 			const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_output* f );
     bool changed();
 
 protected:
@@ -739,9 +778,9 @@ vcd_sc_fxval_trace::changed()
 }
 
 void
-vcd_sc_fxval_trace::write( FILE* f )
+vcd_sc_fxval_trace::write( sc_trace_output* f )
 {
-    std::fprintf( f, "r%.16g %s", object.to_double(), vcd_name.c_str() );
+    f->print( "r%.16g %s", object.to_double(), vcd_name.c_str() );
     old_value = object;
 }
 
@@ -754,7 +793,7 @@ public:
     vcd_sc_fxval_fast_trace( const sc_dt::sc_fxval_fast& object_,
 			     const std::string& name_,
 			     const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_output* f );
     bool changed();
 
 protected:
@@ -782,9 +821,9 @@ vcd_sc_fxval_fast_trace::changed()
 }
 
 void
-vcd_sc_fxval_fast_trace::write( FILE* f )
+vcd_sc_fxval_fast_trace::write( sc_trace_output* f )
 {
-    std::fprintf( f, "r%.16g %s", object.to_double(), vcd_name.c_str() );
+    f->print( "r%.16g %s", object.to_double(), vcd_name.c_str() );
     old_value = object;
 }
 
@@ -797,7 +836,7 @@ public:
     vcd_sc_fxnum_trace( const sc_dt::sc_fxnum& object_,
 			const std::string& name_,
 			const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_output* f );
     bool changed();
     void set_width();
 
@@ -828,26 +867,14 @@ vcd_sc_fxnum_trace::changed()
 }
 
 void
-vcd_sc_fxnum_trace::write( FILE* f )
+vcd_sc_fxnum_trace::write( sc_trace_output* f )
 {
-    static std::vector<char> compdata(1024), rawdata(1024);
-    typedef std::vector<char>::size_type size_t;
-
-    if ( compdata.size() <= static_cast<size_t>(object.wl()) ) { // include trailing \0
-        size_t sz = ( static_cast<size_t>(object.wl()) + 4096 ) & (~static_cast<size_t>(4096-1));
-        std::vector<char>( sz ).swap( compdata ); // resize without copying values
-        std::vector<char>( sz ).swap( rawdata );
-    }
-    char *rawdata_ptr  = &rawdata[0];
-
+    char* p = value_bits();
     for(int bitindex = object.wl() - 1; bitindex >= 0; -- bitindex )
     {
-        *rawdata_ptr ++ = "01"[object[bitindex]];
+        *p ++ = "01"[object[bitindex]];
     }
-    *rawdata_ptr = '\0';
-    compose_data_line( &rawdata[0], &compdata[0] );
-
-    std::fputs( &compdata[0], f );
+    put_value_bits( f );
     old_value = object;
 }
 
@@ -866,7 +893,7 @@ public:
     vcd_sc_fxnum_fast_trace( const sc_dt::sc_fxnum_fast& object_,
 			     const std::string& name_,
 			     const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_output* f );
     bool changed();
     void set_width();
 
@@ -898,26 +925,14 @@ vcd_sc_fxnum_fast_trace::changed()
 }
 
 void
-vcd_sc_fxnum_fast_trace::write( FILE* f )
+vcd_sc_fxnum_fast_trace::write( sc_trace_output* f )
 {
-    static std::vector<char> compdata(1024), rawdata(1024);
-    typedef std::vector<char>::size_type size_t;
-
-    if ( compdata.size() <= static_cast<size_t>(object.wl()) ) { // include trailing \0
-        size_t sz = ( static_cast<size_t>(object.wl()) + 4096 ) & (~static_cast<size_t>(4096-1));
-        std::vector<char>( sz ).swap( compdata ); // resize without copying values
-        std::vector<char>( sz ).swap( rawdata );
-    }
-    char *rawdata_ptr  = &rawdata[0];
-
+    char* p = value_bits();
     for(int bitindex = object.wl() - 1; bitindex >= 0; -- bitindex )
     {
-        *rawdata_ptr ++ = "01"[object[bitindex]];
+        *p ++ = "01"[object[bitindex]];
     }
-    *rawdata_ptr = '\0';
-    compose_data_line( &rawdata[0], &compdata[0] );
-
-    std::fputs( &compdata[0], f );
+    put_value_bits( f );
     old_value = object;
 }
 
@@ -936,7 +951,7 @@ public:
 			   const std::string& name_,
 			   const std::string& vcd_name_,
 			   int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -967,7 +982,7 @@ vcd_unsigned_int_trace::changed()
 
 
 void
-vcd_unsigned_int_trace::write(FILE* f)
+vcd_unsigned_int_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -988,7 +1003,7 @@ vcd_unsigned_int_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1000,7 +1015,7 @@ public:
 			     const std::string& name_,
 			     const std::string& vcd_name_,
 			     int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1030,7 +1045,7 @@ vcd_unsigned_short_trace::changed()
 
 
 void
-vcd_unsigned_short_trace::write(FILE* f)
+vcd_unsigned_short_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -1051,7 +1066,7 @@ vcd_unsigned_short_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1063,7 +1078,7 @@ public:
 			    const std::string& name_,
 			    const std::string& vcd_name_,
 			    int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1091,7 +1106,7 @@ bool vcd_unsigned_char_trace::changed()
 }
 
 
-void vcd_unsigned_char_trace::write(FILE* f)
+void vcd_unsigned_char_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -1112,7 +1127,7 @@ void vcd_unsigned_char_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1124,7 +1139,7 @@ public:
 			    const std::string& name_,
 			    const std::string& vcd_name_,
 			    int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1154,7 +1169,7 @@ bool vcd_unsigned_long_trace::changed()
 }
 
 
-void vcd_unsigned_long_trace::write(FILE* f)
+void vcd_unsigned_long_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -1175,7 +1190,7 @@ void vcd_unsigned_long_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1187,7 +1202,7 @@ public:
 			 const std::string& name_,
 			 const std::string& vcd_name_,
 			 int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1214,7 +1229,7 @@ bool vcd_signed_int_trace::changed()
 }
 
 
-void vcd_signed_int_trace::write(FILE* f)
+void vcd_signed_int_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -1235,7 +1250,7 @@ void vcd_signed_int_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1247,7 +1262,7 @@ public:
 			   const std::string& name_,
 			   const std::string& vcd_name_,
 			   int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1274,7 +1289,7 @@ bool vcd_signed_short_trace::changed()
 }
 
 
-void vcd_signed_short_trace::write(FILE* f)
+void vcd_signed_short_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -1295,7 +1310,7 @@ void vcd_signed_short_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1307,7 +1322,7 @@ public:
 			  const std::string& name_,
 			  const std::string& vcd_name_,
 			  int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1333,7 +1348,7 @@ bool vcd_signed_char_trace::changed()
 }
 
 
-void vcd_signed_char_trace::write(FILE* f)
+void vcd_signed_char_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -1354,7 +1369,7 @@ void vcd_signed_char_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1366,7 +1381,7 @@ public:
 			  const std::string& name_,
 			  const std::string& vcd_name_,
 			  int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1393,7 +1408,7 @@ bool vcd_int64_trace::changed()
 }
 
 
-void vcd_int64_trace::write(FILE* f)
+void vcd_int64_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -1417,7 +1432,7 @@ void vcd_int64_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1430,7 +1445,7 @@ public:
 		     const std::string& name_,
 		     const std::string& vcd_name_,
 		     int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1458,7 +1473,7 @@ bool vcd_uint64_trace::changed()
 }
 
 
-void vcd_uint64_trace::write(FILE* f)
+void vcd_uint64_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -1482,7 +1497,7 @@ void vcd_uint64_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1525,7 +1540,7 @@ public:
 			  const std::string& name_,
 			  const std::string& vcd_name_,
 			  int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1552,7 +1567,7 @@ bool vcd_signed_long_trace::changed()
 }
 
 
-void vcd_signed_long_trace::write(FILE* f)
+void vcd_signed_long_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -1573,7 +1588,7 @@ void vcd_signed_long_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1585,7 +1600,7 @@ public:
     vcd_float_trace(const float& object_,
 		    const std::string& name_,
 		    const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1608,9 +1623,9 @@ bool vcd_float_trace::changed()
     return object != old_value;
 }
 
-void vcd_float_trace::write(FILE* f)
+void vcd_float_trace::write(sc_trace_output* f)
 {
-    std::fprintf(f, "r%.16g %s", object, vcd_name.c_str());
+    f->print("r%.16g %s", object, vcd_name.c_str());
     old_value = object;
 }
 
@@ -1621,7 +1636,7 @@ public:
     vcd_double_trace(const double& object_,
 		     const std::string& name_,
 		     const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1643,9 +1658,9 @@ bool vcd_double_trace::changed()
     return object != old_value;
 }
 
-void vcd_double_trace::write(FILE* f)
+void vcd_double_trace::write(sc_trace_output* f)
 {
-    std::fprintf(f, "r%.16g %s", object, vcd_name.c_str());
+    f->print("r%.16g %s", object, vcd_name.c_str());
     old_value = object;
 }
 
@@ -1658,7 +1673,7 @@ public:
 		   const std::string& name_,
 		   const std::string& vcd_name_,
 		   const char** enum_literals);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1701,7 +1716,7 @@ bool vcd_enum_trace::changed()
     return object != old_value;
 }
 
-void vcd_enum_trace::write(FILE* f)
+void vcd_enum_trace::write(sc_trace_output* f)
 {
     char rawdata[1000];
     char compdata[1000];
@@ -1721,7 +1736,7 @@ void vcd_enum_trace::write(FILE* f)
     }
     rawdata[bitindex] = '\0';
     compose_data_line(rawdata, compdata);
-    std::fputs(compdata, f);
+    f->put(compdata);
     old_value = object;
 }
 
@@ -1732,7 +1747,7 @@ void vcd_enum_trace::write(FILE* f)
 struct vcd_scope {
 
     void add_trace(vcd_trace *trace, bool with_scopes);
-    void print(FILE *fp, const char *scope_name = "SystemC");
+    void print(sc_trace_output *fp, const char *scope_name = "SystemC");
 
     ~vcd_scope();
 private:
@@ -1776,18 +1791,17 @@ void vcd_scope::add_trace_rec(std::stringstream &ss, const std::string &cur_name
     }
 }
 
-void vcd_scope::print(FILE *fp, const char *scope_name) {
-    fprintf(fp,"$scope module %s $end\n", scope_name);
+void vcd_scope::print(sc_trace_output *fp, const char *scope_name) {
+    fp->print("$scope module %s $end\n", scope_name);
 
     for (std::vector<std::pair<std::string,vcd_trace*> >::iterator it = m_traces.begin(); it != m_traces.end(); ++it) {
-        it->second->set_width();
         it->second->print_variable_declaration_line(fp, it->first.c_str());
     }
 
     for (std::map<std::string, vcd_scope*>::iterator it = m_scopes.begin(); it != m_scopes.end(); ++it)
         it->second->print(fp,it->first.c_str());
 
-    fprintf(fp,"$upscope $end\n");
+    fp->put("$upscope $end\n");
 }
 
 #ifdef SC_DISABLE_VCD_SCOPES
@@ -1796,7 +1810,7 @@ void vcd_scope::print(FILE *fp, const char *scope_name) {
 #  define VCD_SCOPES_DEFAULT_ true
 #endif
 
-void vcd_print_scopes(FILE *fp, std::vector<vcd_trace*>& traces) {
+void vcd_print_scopes(sc_trace_output *fp, std::vector<vcd_trace*>& traces) {
 
     vcd_scope top_scope;
 
@@ -1818,11 +1832,18 @@ void vcd_print_scopes(FILE *fp, std::vector<vcd_trace*>& traces) {
            vcd_trace_file functions
  *****************************************************************************/
 
-vcd_trace_file::vcd_trace_file(const char *name)
-  : sc_trace_file_base( name, "vcd" )
+vcd_trace_file::vcd_trace_file(const char *name, const char* extension)
+  : sc_trace_file_base( name, extension )
   , vcd_name_index(0)
   , previous_time_units_low(0)
   , previous_time_units_high(0)
+  , polled_traces()
+  , enabled_traces()
+  , toggled_traces()
+  , ring_text(0)
+  , ring_steps()
+  , ring_changes()
+  , ring_values()
   , traces()
 {}
 
@@ -1830,39 +1851,70 @@ vcd_trace_file::vcd_trace_file(const char *name)
 void
 vcd_trace_file::do_initialize()
 {
-    //date:
-    std::fprintf(fp, "$date\n     %s\n$end\n\n", localtime_string().c_str() );
+    for (int i = 0; i < (int)traces.size(); i++)
+        traces[i]->set_width();
 
-    //version:
-    std::fprintf(fp, "$version\n %s\n$end\n\n", sc_version());
+    write_header();
 
-    //timescale:
-    std::fprintf(fp,"$timescale\n     %s\n$end\n\n", fs_unit_to_str(trace_unit_fs).c_str());
+    timestamp_in_trace_units(previous_time_units_high, previous_time_units_low);
 
-    vcd_print_scopes(fp, traces);
+    // The traces disabled from the start are dumped as unknown
+    enabled_traces.assign(traces.size(), true);
+    apply_trace_rules();
+
+    if (ring_buffered()) {
+        // The initial values start the window of the ring buffer
+        ring_text = new sc_trace_output(0, 1 << 16, 0);
+        ring_values.resize(traces.size());
+        for (int i = 0; i < (int)traces.size(); i++) {
+            ring_text->clear();
+            if (write_value(ring_text, i))
+                ring_values[i].assign(ring_text->data(), ring_text->size());
+        }
+        ring_text->clear();
+    } else {
+        std::stringstream ss;
 
-    std::fputs("$enddefinitions  $end\n\n", fp);
+        ss << "All initial values are dumped below at time "
+           << sc_time_stamp().to_seconds() <<" sec = ";
+        if(has_low_units())
+            ss << previous_time_units_high << std::setfill('0') << std::setw(low_units_len()) << previous_time_units_low;
+        else
+            ss << previous_time_units_high;
+        ss << " timescale units.";
 
-    timestamp_in_trace_units(previous_time_units_high, previous_time_units_low);
+        write_comment(ss.str());
 
-    std::stringstream ss;
+        write_text("$dumpvars\n");
+        for (int i = 0; i < (int)traces.size(); i++)
+            write_change(i);
+        write_text("$end\n\n");
+    }
 
-    ss << "All initial values are dumped below at time "
-       << sc_time_stamp().to_seconds() <<" sec = ";
-    if(has_low_units())
-        ss << previous_time_units_high << std::setfill('0') << std::setw(low_units_len()) << previous_time_units_low;
-    else
-        ss << previous_time_units_high;
-    ss << " timescale units.";
+    // Traces not driven by the updates of a channel are polled
+    if (change_driven()) {
+        for (int i = 0; i < (int)traces.size(); i++) {
+            if (!trace_driven(i))
+                polled_traces.push_back(i);
+        }
+    }
+}
 
-    write_comment(ss.str());
+void
+vcd_trace_file::write_header()
+{
+    //date:
+    fp->print("$date\n     %s\n$end\n\n", localtime_string().c_str() );
 
-    std::fputs("$dumpvars\n",fp);
-    for (int i = 0; i < (int)traces.size(); i++) {
-        traces[i]->write(fp);
-        std::fputc('\n', fp);
-    }
-    std::fputs("$end\n\n", fp);
+    //version:
+    fp->print("$version\n %s\n$end\n\n", sc_version());
+
+    //timescale:
+    fp->print("$timescale\n     %s\n$end\n\n", fs_unit_to_str(trace_unit_fs).c_str());
+
+    vcd_print_scopes(fp, traces);
+
+    fp->put("$enddefinitions  $end\n\n");
 }
 
 #if SC_TRACING_PHASE_CALLBACKS_
@@ -1879,7 +1931,7 @@ void                                                                          \
 vcd_trace_file::trace(const tp& object_, const std::string& name_)            \
 {                                                                             \
     if( add_trace_check(name_) )                                              \
-        traces.push_back( new vcd_ ## tp ## _trace( extract_ref(object_),     \
+        push_trace( new vcd_ ## tp ## _trace( extract_ref(object_),     \
                                                     name_,                    \
                                                     obtain_name() ) );        \
 }
@@ -1897,7 +1949,7 @@ void                                                                          \
 vcd_trace_file::trace(const sc_dt::tp& object_, const std::string& name_)     \
 {                                                                             \
     if( add_trace_check(name_) )                                              \
-        traces.push_back( new vcd_ ## tp ## _trace( object_,                  \
+        push_trace( new vcd_ ## tp ## _trace( object_,                  \
                                                     name_,                    \
                                                     obtain_name() ) );        \
 }
@@ -1925,7 +1977,7 @@ vcd_trace_file::trace( const tp&          object_,                            \
                        int                width_ )                            \
 {                                                                             \
     if( add_trace_check(name_) )                                              \
-        traces.push_back( new vcd_signed_ ## tp ## _trace( object_,           \
+        push_trace( new vcd_signed_ ## tp ## _trace( object_,           \
                                                            name_,             \
                                                            obtain_name(),     \
                                                            width_ ) );        \
@@ -1938,7 +1990,7 @@ vcd_trace_file::trace( const unsigned tp& object_,                            \
                        int                width_ )                            \
 {                                                                             \
     if( add_trace_check(name_) )                                              \
-        traces.push_back( new vcd_unsigned_ ## tp ## _trace( object_,         \
+        push_trace( new vcd_unsigned_ ## tp ## _trace( object_,         \
                                                              name_,           \
                                                              obtain_name(),   \
                                                              width_ ) );      \
@@ -1964,7 +2016,7 @@ vcd_trace_file::trace( const sc_dt::tp&   object_,                            \
                        int                width_ )                            \
 {                                                                             \
     if( add_trace_check(name_) )                                              \
-        traces.push_back( new vcd_ ## tp ## _trace( object_,                  \
+        push_trace( new vcd_ ## tp ## _trace( object_,                  \
                                                     name_,                    \
                                                     obtain_name(),            \
                                                     width_ ) );               \
@@ -1981,7 +2033,7 @@ vcd_trace_file::trace( const unsigned&    object_,
                        const char**       enum_literals_ )
 {
     if( add_trace_check(name_) )
-        traces.push_back( new vcd_enum_trace( object_,
+        push_trace( new vcd_enum_trace( object_,
                                               name_,
                                               obtain_name(),
                                               enum_literals_ ) );
@@ -1993,9 +2045,9 @@ vcd_trace_file::write_comment(const std::string& comment)
 {
     if(!fp) open_fp();
     //no newline in comments allowed, as some viewers may crash
-    std::fputs("$comment\n", fp);
-    std::fputs(comment.c_str(), fp);
-    std::fputs("\n$end\n\n", fp);
+    fp->put("$comment\n");
+    fp->put(comment.c_str());
+    fp->put("\n$end\n\n");
 }
 
 void
@@ -2056,23 +2108,291 @@ vcd_trace_file::cycle(bool this_is_a_delta_cycle)
 
     // Now do the actual printing
     bool time_printed = false;
-    vcd_trace* const* const l_traces = &traces[0];
-    for (int i = 0; i < (int)traces.size(); i++) {
-        vcd_trace* t = l_traces[i];
-        if(t->changed()) {
-            if(!time_printed){
-                print_time_stamp(now_units_high, now_units_low);
-
-                time_printed = true;
-            }
+    const std::size_t ring_first = ring_changes.size();
+
+    // Write the traces toggled by the rules first, their values are
+    // current then
+    if (trace_rules_due()) {
+        apply_trace_rules();
+        for (int k = 0; k < (int)toggled_traces.size(); k++) {
+            int i = toggled_traces[k];
+            traces[i]->changed();
+            write_trace(i, time_printed, now_units_high, now_units_low);
+        }
+    }
+
+    if (change_driven()) {
+        // Visit the polled traces and the traces of the updated channels,
+        // in the same order as when polling all of them
+        const std::vector<int>& changed = changed_traces();
+        std::vector<int>::const_iterator p = polled_traces.begin();
+        std::vector<int>::const_iterator c = changed.begin();
+        while (p != polled_traces.end() || c != changed.end()) {
+            int i;
+            if (c == changed.end() || (p != polled_traces.end() && *p < *c))
+                i = *p++;
+            else
+                i = *c++;
+            write_if_changed(i, time_printed,
+                             now_units_high, now_units_low);
+        }
+        clear_changed_traces();
+    } else {
+        for (int i = 0; i < (int)traces.size(); i++) {
+            write_if_changed(i, time_printed,
+                             now_units_high, now_units_low);
+        }
+    }
 
-            // Write the variable
-            t->write(fp);
-            std::fputc('\n', fp);
+    if (ring_text) {
+        // Keep the time step, and write the window if triggered
+        if (time_printed) {
+            ring_step s;
+            s.time = sc_time_stamp();
+            s.units_high = now_units_high;
+            s.units_low = now_units_low;
+            s.changes = ring_changes.size() - ring_first;
+            ring_steps.push_back(s);
         }
+        expire_ring_steps(false);
+        if (ring_triggered())
+            dump_ring(now_units_high, now_units_low);
+        return;
     }
+
     // Put another newline after all values are printed
-    if(time_printed) std::fputc('\n', fp);
+    if(time_printed) write_text("\n");
+}
+
+void
+vcd_trace_file::write_if_changed(int i, bool& time_printed,
+                                 unit_type now_units_high,
+                                 unit_type now_units_low)
+{
+    if(traces[i]->changed() && enabled_traces[i])
+        write_trace(i, time_printed, now_units_high, now_units_low);
+}
+
+void
+vcd_trace_file::write_trace(int i, bool& time_printed,
+                            unit_type now_units_high,
+                            unit_type now_units_low)
+{
+    if(!time_printed){
+        if(!ring_text)
+            write_time_stamp(now_units_high, now_units_low);
+
+        time_printed = true;
+    }
+
+    // Write the variable, or keep it in the ring buffer
+    if(!ring_text) {
+        write_change(i);
+        return;
+    }
+    ring_change c;
+    c.trace = i;
+    c.begin = ring_text->size();
+    if(write_value(ring_text, i)) {
+        c.end = ring_text->size();
+        ring_changes.push_back(c);
+    }
+}
+
+bool
+vcd_trace_file::write_value(sc_trace_output* f, int i)
+{
+    vcd_trace* t = traces[i];
+    if(enabled_traces[i]) {
+        t->write(f);
+    } else if(t->vcd_var_type == VCD_REAL) {
+        return false;
+    } else {
+        f->put(t->bit_width == 1 ? "x" : "bx ");
+        f->put(t->vcd_name.c_str());
+    }
+    f->put('\n');
+    return true;
+}
+
+void
+vcd_trace_file::write_change(int i)
+{
+    write_value(fp, i);
+}
+
+void
+vcd_trace_file::write_kept_change(int, const char* value, std::size_t length)
+{
+    fp->put(value, length);
+}
+
+void
+vcd_trace_file::write_text(const char* text)
+{
+    fp->put(text);
+}
+
+bool
+vcd_trace_file::value_text(sc_trace_output* f, int i,
+                           const char*& value, std::size_t& length)
+{
+    const vcd_trace* t = traces[i];
+    f->clear();
+    if(!vcd_trace_file::write_value(f, i) ||
+       f->size() < t->vcd_name.size() + 2)
+        return false;
+
+    // Strip the name and the newline, and the b or r and the blank before
+    // the name of a vector or a real
+    value = f->data();
+    length = f->size() - t->vcd_name.size() - 1;
+    if(t->bit_width != 1 || t->vcd_var_type == VCD_REAL) {
+        value++;
+        length -= 2;
+    }
+    return true;
+}
+
+const std::string&
+vcd_trace_file::trace_name(int i) const
+{
+    return traces[i]->name;
+}
+
+vcd_trace_file::vcd_enum
+vcd_trace_file::trace_kind(int i) const
+{
+    return traces[i]->vcd_var_type;
+}
+
+int
+vcd_trace_file::trace_width(int i) const
+{
+    return traces[i]->bit_width;
+}
+
+void
+vcd_trace_file::apply_trace_rules()
+{
+    toggled_traces.clear();
+    std::string pattern;
+    bool enable;
+    while (next_trace_rule(pattern, enable)) {
+        for (int i = 0; i < (int)traces.size(); i++) {
+            if (enabled_traces[i] != enable &&
+                trace_name_matches(pattern, traces[i]->name)) {
+                enabled_traces[i] = enable;
+                toggled_traces.push_back(i);
+            }
+        }
+    }
+    std::sort(toggled_traces.begin(), toggled_traces.end());
+    toggled_traces.erase(std::unique(toggled_traces.begin(),
+                                     toggled_traces.end()),
+                         toggled_traces.end());
+}
+
+//------------------------------------------------------------------------------
+//"vcd_trace_file::expire_ring_steps"
+//
+// This method moves the time steps older than the window, or all of them,
+// into the values at the start of the window, and drops their value lines
+// once they make up half of the text.
+//------------------------------------------------------------------------------
+void
+vcd_trace_file::expire_ring_steps(bool all)
+{
+    const sc_time now = sc_time_stamp();
+    while (!ring_steps.empty() &&
+           (all || now - ring_steps.front().time > ring_window())) {
+        const char* text = ring_text->data();
+        for (std::size_t k = ring_steps.front().changes; k > 0; k--) {
+            const ring_change& c = ring_changes.front();
+            ring_values[c.trace].assign(text + c.begin, c.end - c.begin);
+            ring_changes.pop_front();
+        }
+        ring_steps.pop_front();
+    }
+
+    std::size_t begin = ring_changes.empty() ? ring_text->size()
+                                             : ring_changes.front().begin;
+    if (begin > 0 && 2 * begin >= ring_text->size()) {
+        ring_text->erase(begin);
+        for (std::size_t k = 0; k < ring_changes.size(); k++) {
+            ring_changes[k].begin -= begin;
+            ring_changes[k].end -= begin;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+//"vcd_trace_file::dump_ring"
+//
+// This method writes the values at the start of the window with $dumpall,
+// at the time of the first step kept or now, followed by the time steps
+// kept. The next window starts with the current values.
+//------------------------------------------------------------------------------
+void
+vcd_trace_file::dump_ring(unit_type now_units_high, unit_type now_units_low)
+{
+    std::stringstream ss;
+    ss << "Value changes of the last " << ring_window()
+       << " before " << sc_time_stamp();
+    write_comment(ss.str());
+
+    if (ring_steps.empty())
+        write_time_stamp(now_units_high, now_units_low);
+    else
+        write_time_stamp(ring_steps.front().units_high,
+                         ring_steps.front().units_low);
+    write_text("$dumpall\n");
+    for (std::size_t i = 0; i < ring_values.size(); i++) {
+        if (!ring_values[i].empty())
+            write_kept_change(static_cast<int>(i), ring_values[i].data(),
+                              ring_values[i].size());
+    }
+    write_text("$end\n");
+
+    const char* text = ring_text->data();
+    std::size_t c = 0;
+    for (std::size_t k = 0; k < ring_steps.size(); k++) {
+        if (k > 0)
+            write_time_stamp(ring_steps[k].units_high,
+                             ring_steps[k].units_low);
+        for (std::size_t n = ring_steps[k].changes; n > 0; n--, c++)
+            write_kept_change(ring_changes[c].trace,
+                              text + ring_changes[c].begin,
+                              ring_changes[c].end - ring_changes[c].begin);
+    }
+    write_text("\n");
+
+    expire_ring_steps(true);
+}
+
+void
+vcd_trace_file::dump_ring_if_triggered()
+{
+    if (!ring_text || !ring_triggered())
+        return;
+    unit_type now_units_high, now_units_low;
+    timestamp_in_trace_units(now_units_high, now_units_low);
+    dump_ring(now_units_high, now_units_low);
+}
+
+void
+vcd_trace_file::flush()
+{
+    if (fp)
+        dump_ring_if_triggered();
+    sc_trace_file_base::flush();
+}
+
+void
+vcd_trace_file::push_trace(vcd_trace* t)
+{
+    bind_trace_source(static_cast<int>(traces.size()));
+    traces.push_back(t);
 }
 
 bool vcd_trace_file::get_time_stamp(sc_trace_file_base::unit_type &now_units_high,
@@ -2085,8 +2405,8 @@ bool vcd_trace_file::get_time_stamp(sc_trace_file_base::unit_type &now_units_hig
 
 }
 
-void vcd_trace_file::print_time_stamp(sc_trace_file_base::unit_type now_units_high,
-                                      sc_trace_file_base::unit_type now_units_low) const
+void vcd_trace_file::write_time_stamp(sc_trace_file_base::unit_type now_units_high,
+                                      sc_trace_file_base::unit_type now_units_low)
 {
 
     std::stringstream ss;
@@ -2095,8 +2415,8 @@ void vcd_trace_file::print_time_stamp(sc_trace_file_base::unit_type now_units_hi
     else
         ss << "#" << now_units_high;
 
-    fputs(ss.str().c_str(), fp);
-    fputc('\n', fp);
+    fp->put(ss.str().c_str());
+    fp->put('\n');
 }
 
 
@@ -2136,10 +2456,14 @@ vcd_trace_file::obtain_name()
 
 vcd_trace_file::~vcd_trace_file()
 {
+    // The formats written from the traces have closed their file
     unit_type now_units_high, now_units_low;
-    if (is_initialized() && get_time_stamp(now_units_high,now_units_low)) {
-        print_time_stamp(now_units_high, now_units_low);
+    if (fp) {
+        dump_ring_if_triggered();
+        if (is_initialized() && get_time_stamp(now_units_high,now_units_low))
+            write_time_stamp(now_units_high, now_units_low);
     }
+    delete ring_text;
 
     for( int i = 0; i < (int)traces.size(); i++ ) {
         vcd_trace* t = traces[i];
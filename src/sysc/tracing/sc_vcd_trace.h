@@ -51,6 +51,8 @@
 
 #include "sysc/tracing/sc_trace_file_base.h"
 
+#include <deque>
+
 namespace sc_core {
 
 class sc_time;
@@ -80,7 +82,7 @@ public:
 
     // Create a Vcd trace file.
     // `Name' forms the base of the name to which `.vcd' is added.
-    vcd_trace_file(const char *name);
+    vcd_trace_file(const char *name, const char* extension = "vcd");
 
     // Flush results and close file.
     ~vcd_trace_file();
@@ -180,8 +182,8 @@ protected:
     	vcd_enum type=VCD_WIRE)
     {
         if( add_trace_check(name) )
-            traces.push_back(new vcd_T_trace<T>( object, name
-                                               , obtain_name(),type) );
+            push_trace(new vcd_T_trace<T>( object, name
+                                         , obtain_name(),type) );
     }
 
    // Trace sc_dt::sc_bv_base (sc_dt::sc_bv)
@@ -204,6 +206,51 @@ protected:
     // Write trace info for cycle.
      void cycle(bool delta_cycle);
 
+    // Initialize the VCD tracing
+    virtual void do_initialize();
+
+    // Write the value changes kept in ring buffer mode, if triggered
+    void dump_ring_if_triggered();
+
+    // Write them and the buffered output to the file
+    virtual void flush();
+
+    // The output of the traces, overridden by the formats written from
+    // the VCD traces and their change detection.
+
+    // Write the definitions of the traces
+    virtual void write_header();
+
+    // Write the time stamp of the value changes that follow
+    virtual void write_time_stamp(unit_type now_units_high,
+                                  unit_type now_units_low);
+
+    // Write the value of trace i, as unknown if disabled, returns false if
+    // there is none
+    virtual bool write_value(sc_trace_output* f, int i);
+
+    // Write a value change of trace i
+    virtual void write_change(int i);
+
+    // Write a value change of trace i, kept by write_value() in ring
+    // buffer mode
+    virtual void write_kept_change(int i, const char* value,
+                                   std::size_t length);
+
+    // Write VCD text between the values, such as $dumpvars
+    virtual void write_text(const char* text);
+
+    // The value of trace i, as written by vcd_trace_file::write_value() to
+    // f without the name: a character for a width of 1, the bits of a
+    // vector, or a real number. Returns false if there is none
+    bool value_text(sc_trace_output* f, int i,
+                    const char*& value, std::size_t& length);
+
+    // The name, kind and width of trace i, once initialized
+    const std::string& trace_name(int i) const;
+    vcd_enum trace_kind(int i) const;
+    int trace_width(int i) const;
+
 private:
 
     template<typename T> const T& extract_ref(const T& object) const
@@ -216,16 +263,63 @@ private:
     virtual void trace( sc_trace_file* ) const;
 #endif // SC_TRACING_PHASE_CALLBACKS_
 
-    // Initialize the VCD tracing
-    virtual void do_initialize();
-    void print_time_stamp(unit_type now_units_high, unit_type now_units_low) const;
     bool get_time_stamp(unit_type &now_units_high, unit_type &now_units_low) const;
 
+    // Write trace i and the time stamp, if not yet printed
+    void write_trace(int i, bool& time_printed,
+                     unit_type now_units_high, unit_type now_units_low);
+
+    // Write trace i, if it changed and is enabled
+    void write_if_changed(int i, bool& time_printed,
+                          unit_type now_units_high, unit_type now_units_low);
+
+    // Apply the rules of enable_traces() due, and list the traces toggled
+    void apply_trace_rules();
+
+    // Move the oldest time steps out of the window of the ring buffer
+    void expire_ring_steps(bool all);
+
+    // Write the value changes kept in ring buffer mode
+    void dump_ring(unit_type now_units_high, unit_type now_units_low);
+
+    // Add a trace, driven by the current trace source if any
+    void push_trace(vcd_trace* t);
+
     unsigned vcd_name_index;           // Number of variables traced
 
     unit_type previous_time_units_low;
     unit_type previous_time_units_high;
 
+    // Traces polled in change driven mode, in ascending order
+    std::vector<int> polled_traces;
+
+    // Traces enabled by the rules of enable_traces(), and those toggled by
+    // the rules of the current cycle
+    std::vector<bool> enabled_traces;
+    std::vector<int>  toggled_traces;
+
+    // a time step kept in ring buffer mode
+    struct ring_step
+    {
+        sc_time     time;
+        unit_type   units_high;
+        unit_type   units_low;
+        std::size_t changes;     // value lines of the step.
+    };
+
+    // a value line of a time step
+    struct ring_change
+    {
+        int         trace;
+        std::size_t begin;       // of the line in ring_text.
+        std::size_t end;
+    };
+
+    sc_trace_output*         ring_text;    // the value lines, or 0.
+    std::deque<ring_step>    ring_steps;   // in the window, in order.
+    std::deque<ring_change>  ring_changes; // of ring_steps, in order.
+    std::vector<std::string> ring_values;  // at the start of the window.
+
 public:
 
     // Array to store the variables traced
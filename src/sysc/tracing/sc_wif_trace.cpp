@@ -106,7 +106,7 @@ public:
 
     // Needs to be pure virtual as has to be defined by the particular
     // type being traced
-    virtual void write(FILE* f) = 0;
+    virtual void write(sc_trace_output* f) = 0;
 
     virtual void set_width();
 
@@ -115,7 +115,7 @@ public:
 
     // Got to declare this virtual as this will be overwritten
     // by one base class
-    virtual void print_variable_declaration_line(FILE* f);
+    virtual void print_variable_declaration_line(sc_trace_output* f);
 
     virtual ~wif_trace();
 
@@ -134,7 +134,7 @@ wif_trace::wif_trace(const std::string& name_,
 }
 
 void
-wif_trace::print_variable_declaration_line( FILE* f )
+wif_trace::print_variable_declaration_line( sc_trace_output* f )
 {
     if( bit_width < 0 )
     {
@@ -145,14 +145,14 @@ wif_trace::print_variable_declaration_line( FILE* f )
         return;
     }
 
-    std::fprintf( f, "declare  %s   \"%s\"  %s  ",
+    f->print( "declare  %s   \"%s\"  %s  ",
                   wif_name.c_str(), name.c_str(), wif_type );
 
     if( bit_width > 0 ) {
-        std::fprintf( f, "0 %d ", bit_width - 1 );
+        f->print( "0 %d ", bit_width - 1 );
     }
-    std::fprintf( f, "variable ;\n" );
-    std::fprintf( f, "start_trace %s ;\n", wif_name.c_str() );
+    f->put( "variable ;\n" );
+    f->print( "start_trace %s ;\n", wif_name.c_str() );
 }
 
 void
@@ -176,7 +176,7 @@ public:
                 const std::string& name_,
                 const std::string& wif_name_,
                 int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -206,7 +206,7 @@ bool wif_uint64_trace::changed()
 }
 
 
-void wif_uint64_trace::write(FILE* f)
+void wif_uint64_trace::write(sc_trace_output* f)
 {
     char buf[1000];
     int bitindex;
@@ -230,7 +230,7 @@ void wif_uint64_trace::write(FILE* f)
         }
     }
     buf[bitindex] = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -242,7 +242,7 @@ public:
                 const std::string& name_,
                 const std::string& wif_name_,
                 int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -270,7 +270,7 @@ bool wif_int64_trace::changed()
 }
 
 
-void wif_int64_trace::write(FILE* f)
+void wif_int64_trace::write(sc_trace_output* f)
 {
     char buf[1000];
     int bitindex;
@@ -294,7 +294,7 @@ void wif_int64_trace::write(FILE* f)
         }
     }
     buf[bitindex] = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -308,7 +308,7 @@ public:
     wif_bool_trace( const bool& object_,
 		    const std::string& name_,
 		    const std::string& wif_name_ );
-    void write( FILE* f );
+    void write( sc_trace_output* f );
     bool changed();
 
 protected:
@@ -333,12 +333,12 @@ wif_bool_trace::changed()
 }
 
 void
-wif_bool_trace::write( FILE* f )
+wif_bool_trace::write( sc_trace_output* f )
 {
     if( object == true ) {
-	std::fprintf( f, "assign %s \'1\' ;\n", wif_name.c_str() );
+	f->print( "assign %s \'1\' ;\n", wif_name.c_str() );
     } else {
-	std::fprintf( f, "assign %s \'0\' ;\n", wif_name.c_str() );
+	f->print( "assign %s \'0\' ;\n", wif_name.c_str() );
     }
     old_value = object;
 }
@@ -350,7 +350,7 @@ public:
     wif_sc_bit_trace(const sc_dt::sc_bit& object_,
                      const std::string& name_,
                      const std::string& wif_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -372,12 +372,12 @@ bool wif_sc_bit_trace::changed()
     return object != old_value;
 }
 
-void wif_sc_bit_trace::write(FILE* f)
+void wif_sc_bit_trace::write(sc_trace_output* f)
 {
     if (object == true) {
-        std::fprintf(f, "assign %s \'1\' ;\n", wif_name.c_str());
+        f->print("assign %s \'1\' ;\n", wif_name.c_str());
     } else {
-	std::fprintf(f, "assign %s \'0\' ;\n", wif_name.c_str());
+	f->print("assign %s \'0\' ;\n", wif_name.c_str());
     }
     old_value = object;
 }
@@ -389,7 +389,7 @@ public:
     wif_sc_logic_trace(const sc_dt::sc_logic& object_,
 		       const std::string& name_,
 		       const std::string& wif_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -414,13 +414,13 @@ bool wif_sc_logic_trace::changed()
 }
 
 
-void wif_sc_logic_trace::write(FILE* f)
+void wif_sc_logic_trace::write(sc_trace_output* f)
 {
     char wif_char;
-    std::fprintf(f, "assign %s \'", wif_name.c_str());
+    f->print("assign %s \'", wif_name.c_str());
     wif_char = map_sc_logic_state_to_wif_state(object.to_char());
-    std::fputc(wif_char, f);
-    std::fprintf(f,"\' ;\n");
+    f->put(wif_char);
+    f->put("\' ;\n");
     old_value = object;
 }
 
@@ -432,7 +432,7 @@ public:
     wif_sc_unsigned_trace(const sc_dt::sc_unsigned& object_,
 			  const std::string& name_,
 			  const std::string& wif_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
     void set_width();
 
@@ -456,7 +456,7 @@ bool wif_sc_unsigned_trace::changed()
     return object != old_value;
 }
 
-void wif_sc_unsigned_trace::write(FILE* f)
+void wif_sc_unsigned_trace::write(sc_trace_output* f)
 {
     static std::vector<char> buf(1024);
     typedef std::vector<char>::size_type size_t;
@@ -471,7 +471,7 @@ void wif_sc_unsigned_trace::write(FILE* f)
         *buf_ptr++ = "01"[object[bitindex].to_bool()];
     }
     *buf_ptr = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), &buf[0]);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), &buf[0]);
     old_value = object;
 }
 
@@ -488,7 +488,7 @@ public:
     wif_sc_signed_trace(const sc_dt::sc_signed& object_,
 			const std::string& name_,
 			const std::string& wif_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
     void set_width();
 
@@ -512,7 +512,7 @@ bool wif_sc_signed_trace::changed()
     return object != old_value;
 }
 
-void wif_sc_signed_trace::write(FILE* f)
+void wif_sc_signed_trace::write(sc_trace_output* f)
 {
     static std::vector<char> buf(1024);
     typedef std::vector<char>::size_type size_t;
@@ -528,7 +528,7 @@ void wif_sc_signed_trace::write(FILE* f)
     }
     *buf_ptr = '\0';
 
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), &buf[0]);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), &buf[0]);
     old_value = object;
 }
 
@@ -544,7 +544,7 @@ public:
     wif_sc_uint_base_trace(const sc_dt::sc_uint_base& object_,
 			   const std::string& name_,
 			   const std::string& wif_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
     void set_width();
 
@@ -569,7 +569,7 @@ bool wif_sc_uint_base_trace::changed()
     return object != old_value;
 }
 
-void wif_sc_uint_base_trace::write(FILE* f)
+void wif_sc_uint_base_trace::write(sc_trace_output* f)
 {
     char buf[1000], *buf_ptr = buf;
 
@@ -578,7 +578,7 @@ void wif_sc_uint_base_trace::write(FILE* f)
         *buf_ptr++ = "01"[object[bitindex].to_bool()];
     }
     *buf_ptr = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -595,7 +595,7 @@ public:
     wif_sc_int_base_trace(const sc_dt::sc_int_base& object_,
 			  const std::string& name_,
 			  const std::string& wif_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
     void set_width();
 
@@ -619,7 +619,7 @@ bool wif_sc_int_base_trace::changed()
     return object != old_value;
 }
 
-void wif_sc_int_base_trace::write(FILE* f)
+void wif_sc_int_base_trace::write(sc_trace_output* f)
 {
     char buf[1000], *buf_ptr = buf;
 
@@ -629,7 +629,7 @@ void wif_sc_int_base_trace::write(FILE* f)
     }
     *buf_ptr = '\0';
 
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -648,7 +648,7 @@ public:
     wif_sc_fxval_trace( const sc_dt::sc_fxval& object_,
 			const std::string& name_,
 			const std::string& wif_name_ );
-    void write( FILE* f );
+    void write( sc_trace_output* f );
     bool changed();
 
 protected:
@@ -674,9 +674,9 @@ wif_sc_fxval_trace::changed()
 }
 
 void
-wif_sc_fxval_trace::write( FILE* f )
+wif_sc_fxval_trace::write( sc_trace_output* f )
 {
-    std::fprintf( f, "assign  %s %f ; \n", wif_name.c_str(), object.to_double() );
+    f->print( "assign  %s %f ; \n", wif_name.c_str(), object.to_double() );
     old_value = object;
 }
 
@@ -689,7 +689,7 @@ public:
     wif_sc_fxval_fast_trace( const sc_dt::sc_fxval_fast& object_,
 			     const std::string& name_,
 			     const std::string& wif_name_ );
-    void write( FILE* f );
+    void write( sc_trace_output* f );
     bool changed();
 
 protected:
@@ -716,9 +716,9 @@ wif_sc_fxval_fast_trace::changed()
 }
 
 void
-wif_sc_fxval_fast_trace::write( FILE* f )
+wif_sc_fxval_fast_trace::write( sc_trace_output* f )
 {
-    std::fprintf( f, "assign  %s %f ; \n", wif_name.c_str(), object.to_double() );
+    f->print( "assign  %s %f ; \n", wif_name.c_str(), object.to_double() );
     old_value = object;
 }
 
@@ -731,7 +731,7 @@ public:
     wif_sc_fxnum_trace( const sc_dt::sc_fxnum& object_,
 			const std::string& name_,
 			const std::string& wif_name_ );
-    void write( FILE* f );
+    void write( sc_trace_output* f );
     bool changed();
     void set_width();
 
@@ -763,7 +763,7 @@ wif_sc_fxnum_trace::changed()
 }
 
 void
-wif_sc_fxnum_trace::write( FILE* f )
+wif_sc_fxnum_trace::write( sc_trace_output* f )
 {
     static std::vector<char> buf(1024);
     typedef std::vector<char>::size_type size_t;
@@ -780,7 +780,7 @@ wif_sc_fxnum_trace::write( FILE* f )
     }
     *buf_ptr = '\0';
 
-    std::fprintf( f, "assign %s \"%s\" ;\n", wif_name.c_str(), &buf[0]);
+    f->print( "assign %s \"%s\" ;\n", wif_name.c_str(), &buf[0]);
     old_value = object;
 }
 
@@ -799,7 +799,7 @@ public:
     wif_sc_fxnum_fast_trace( const sc_dt::sc_fxnum_fast& object_,
 			     const std::string& name_,
 			     const std::string& wif_name_ );
-    void write( FILE* f );
+    void write( sc_trace_output* f );
     bool changed();
     void set_width();
 
@@ -832,7 +832,7 @@ wif_sc_fxnum_fast_trace::changed()
 }
 
 void
-wif_sc_fxnum_fast_trace::write( FILE* f )
+wif_sc_fxnum_fast_trace::write( sc_trace_output* f )
 {
     static std::vector<char> buf(1024);
     typedef std::vector<char>::size_type size_t;
@@ -849,7 +849,7 @@ wif_sc_fxnum_fast_trace::write( FILE* f )
     }
     *buf_ptr = '\0';
 
-    std::fprintf( f, "assign %s \"%s\" ;\n", wif_name.c_str(), &buf[0]);
+    f->print( "assign %s \"%s\" ;\n", wif_name.c_str(), &buf[0]);
     old_value = object;
 }
 
@@ -867,7 +867,7 @@ public:
     wif_unsigned_int_trace(const unsigned& object_,
 			   const std::string& name_,
 			   const std::string& wif_name_, int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -899,7 +899,7 @@ bool wif_unsigned_int_trace::changed()
 }
 
 
-void wif_unsigned_int_trace::write(FILE* f)
+void wif_unsigned_int_trace::write(sc_trace_output* f)
 {
     char buf[1000];
     int bitindex;
@@ -918,7 +918,7 @@ void wif_unsigned_int_trace::write(FILE* f)
         }
     }
     buf[bitindex] = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -931,7 +931,7 @@ public:
 			     const std::string& name_,
 			     const std::string& wif_name_,
 			     int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -963,7 +963,7 @@ bool wif_unsigned_short_trace::changed()
 }
 
 
-void wif_unsigned_short_trace::write(FILE* f)
+void wif_unsigned_short_trace::write(sc_trace_output* f)
 {
     char buf[1000];
     int bitindex;
@@ -982,7 +982,7 @@ void wif_unsigned_short_trace::write(FILE* f)
         }
     }
     buf[bitindex] = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -994,7 +994,7 @@ public:
 			    const std::string& name_,
 			    const std::string& wif_name_,
 			    int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1025,7 +1025,7 @@ bool wif_unsigned_char_trace::changed()
 }
 
 
-void wif_unsigned_char_trace::write(FILE* f)
+void wif_unsigned_char_trace::write(sc_trace_output* f)
 {
     char buf[1000];
     int bitindex;
@@ -1044,7 +1044,7 @@ void wif_unsigned_char_trace::write(FILE* f)
         }
     }
     buf[bitindex] = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -1056,7 +1056,7 @@ public:
 			    const std::string& name_,
 			    const std::string& wif_name_,
 			    int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1088,7 +1088,7 @@ bool wif_unsigned_long_trace::changed()
 }
 
 
-void wif_unsigned_long_trace::write(FILE* f)
+void wif_unsigned_long_trace::write(sc_trace_output* f)
 {
     char buf[1000];
     int bitindex;
@@ -1107,7 +1107,7 @@ void wif_unsigned_long_trace::write(FILE* f)
         }
     }
     buf[bitindex] = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -1119,7 +1119,7 @@ public:
 			 const std::string& name_,
 			 const std::string& wif_name_,
 			 int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1147,7 +1147,7 @@ bool wif_signed_int_trace::changed()
 }
 
 
-void wif_signed_int_trace::write(FILE* f)
+void wif_signed_int_trace::write(sc_trace_output* f)
 {
     char buf[1000];
     int bitindex;
@@ -1166,7 +1166,7 @@ void wif_signed_int_trace::write(FILE* f)
         }
     }
     buf[bitindex] = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -1178,7 +1178,7 @@ public:
 			   const std::string& name_,
 			   const std::string& wif_name_,
 			   int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1205,7 +1205,7 @@ bool wif_signed_short_trace::changed()
 }
 
 
-void wif_signed_short_trace::write(FILE* f)
+void wif_signed_short_trace::write(sc_trace_output* f)
 {
     char buf[1000];
     int bitindex;
@@ -1224,7 +1224,7 @@ void wif_signed_short_trace::write(FILE* f)
         }
     }
     buf[bitindex] = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -1236,7 +1236,7 @@ public:
 			  const std::string& name_,
 			  const std::string& wif_name_,
 			  int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1263,7 +1263,7 @@ bool wif_signed_char_trace::changed()
 }
 
 
-void wif_signed_char_trace::write(FILE* f)
+void wif_signed_char_trace::write(sc_trace_output* f)
 {
     char buf[1000];
     int bitindex;
@@ -1282,7 +1282,7 @@ void wif_signed_char_trace::write(FILE* f)
         }
     }
     buf[bitindex] = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -1294,7 +1294,7 @@ public:
 			  const std::string& name_,
 			  const std::string& wif_name_,
 			  int width_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1322,7 +1322,7 @@ bool wif_signed_long_trace::changed()
 }
 
 
-void wif_signed_long_trace::write(FILE* f)
+void wif_signed_long_trace::write(sc_trace_output* f)
 {
     char buf[1000];
     int bitindex;
@@ -1340,7 +1340,7 @@ void wif_signed_long_trace::write(FILE* f)
         }
     }
     buf[bitindex] = '\0';
-    std::fprintf(f, "assign %s \"%s\" ;\n", wif_name.c_str(), buf);
+    f->print("assign %s \"%s\" ;\n", wif_name.c_str(), buf);
     old_value = object;
 }
 
@@ -1352,7 +1352,7 @@ public:
     wif_float_trace(const float& object_,
 		    const std::string& name_,
 		    const std::string& wif_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1374,9 +1374,9 @@ bool wif_float_trace::changed()
     return object != old_value;
 }
 
-void wif_float_trace::write(FILE* f)
+void wif_float_trace::write(sc_trace_output* f)
 {
-    std::fprintf(f,"assign  %s %f ; \n", wif_name.c_str(), object);
+    f->print("assign  %s %f ; \n", wif_name.c_str(), object);
     old_value = object;
 }
 
@@ -1387,7 +1387,7 @@ public:
     wif_double_trace(const double& object_,
 		     const std::string& name_,
 		     const std::string& wif_name_);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
 
 protected:
@@ -1409,9 +1409,9 @@ bool wif_double_trace::changed()
     return object != old_value;
 }
 
-void wif_double_trace::write(FILE* f)
+void wif_double_trace::write(sc_trace_output* f)
 {
-    std::fprintf(f,"assign  %s %f ; \n", wif_name.c_str(), object);
+    f->print("assign  %s %f ; \n", wif_name.c_str(), object);
     old_value = object;
 }
 
@@ -1424,10 +1424,10 @@ public:
 		   const std::string& name_,
 		   const std::string& wif_name_,
 		   const char** enum_literals);
-    void write(FILE* f);
+    void write(sc_trace_output* f);
     bool changed();
     // Hides the definition of the same (virtual) function in wif_trace
-    void print_variable_declaration_line(FILE* f);
+    void print_variable_declaration_line(sc_trace_output* f);
 
 protected:
     const unsigned& object;
@@ -1455,18 +1455,18 @@ wif_enum_trace::wif_enum_trace(const unsigned& object_,
     wif_type = type_name.c_str();
 }
 
-void wif_enum_trace::print_variable_declaration_line(FILE* f)
+void wif_enum_trace::print_variable_declaration_line(sc_trace_output* f)
 {
-    std::fprintf(f, "type scalar \"%s\" enum ", wif_type);
+    f->print("type scalar \"%s\" enum ", wif_type);
 
     for (unsigned i = 0; i < nliterals; i++)
-      std::fprintf(f, "\"%s\", ", literals[i]);
-    std::fprintf(f, "\"SC_WIF_UNDEF\" ;\n");
+      f->print("\"%s\", ", literals[i]);
+    f->print("\"SC_WIF_UNDEF\" ;\n");
 
-    std::fprintf(f, "declare  %s   \"%s\"  \"%s\" ",
+    f->print("declare  %s   \"%s\"  \"%s\" ",
 	    wif_name.c_str(), name.c_str(), wif_type);
-    std::fprintf(f, "variable ;\n");
-    std::fprintf(f, "start_trace %s ;\n", wif_name.c_str());
+    f->put("variable ;\n");
+    f->print("start_trace %s ;\n", wif_name.c_str());
 }
 
 bool wif_enum_trace::changed()
@@ -1474,7 +1474,7 @@ bool wif_enum_trace::changed()
     return object != old_value;
 }
 
-void wif_enum_trace::write(FILE* f)
+void wif_enum_trace::write(sc_trace_output* f)
 {
     static bool warning_issued = false;
     const char* lit;
@@ -1491,7 +1491,7 @@ void wif_enum_trace::write(FILE* f)
     {
         lit = literals[object];
     }
-    std::fprintf( f, "assign %s \"%s\" ;\n", wif_name.c_str(), lit );
+    f->print( "assign %s \"%s\" ;\n", wif_name.c_str(), lit );
     old_value = object;
 }
 
@@ -1516,10 +1516,9 @@ public:
       old_value( object_ )
     {  wif_type = wif_names[type_]; }
 
-    void write( FILE* f )
+    void write( sc_trace_output* f )
     {
-       std::fprintf( f,
-		"assign %s \"%s\" ;\n",
+       f->print( "assign %s \"%s\" ;\n",
 		wif_name.c_str(),
 		object.to_string().c_str() );
        old_value = object;
@@ -1560,24 +1559,24 @@ void wif_trace_file::do_initialize()
     char buf[2000];
 
     // init
-    std::fprintf(fp, "init ;\n\n");
+    fp->put("init ;\n\n");
 
     //timescale:
     std::sprintf(buf,"%d", static_cast<int>(log10(static_cast<double>(trace_unit_fs))));
-    std::fprintf(fp,"header  %s \"%s\" ;\n\n", buf, sc_version());
+    fp->print("header  %s \"%s\" ;\n\n", buf, sc_version());
 
-    std::fprintf(fp, "comment \"ASCII WIF file produced on date:  %s\" ;\n"
+    fp->print("comment \"ASCII WIF file produced on date:  %s\" ;\n"
                 , localtime_string().c_str());
 
     //version:
-    std::fprintf(fp, "comment \"Created by %s\" ;\n", sc_version());
+    fp->print("comment \"Created by %s\" ;\n", sc_version());
     //conversion info
-    std::fprintf(fp, "comment \"Convert this file to binary WIF format using a2wif\" ;\n\n");
+    fp->print("comment \"Convert this file to binary WIF format using a2wif\" ;\n\n");
 
     // Define the two types we need to represent bool and sc_logic
-    std::fprintf(fp, "type scalar \"BIT\" enum '0', '1' ;\n");
-    std::fprintf(fp, "type scalar \"MVL\" enum '0', '1', 'X', 'Z', '?' ;\n");
-    std::fprintf(fp, "\n");
+    fp->print("type scalar \"BIT\" enum '0', '1' ;\n");
+    fp->print("type scalar \"MVL\" enum '0', '1', 'X', 'Z', '?' ;\n");
+    fp->put("\n");
 
     //variable definitions:
     int i;
@@ -1605,7 +1604,7 @@ void wif_trace_file::do_initialize()
         wif_trace* t = traces[i];
         t->write(fp);
     }
-    std::fprintf(fp, "\n");
+    fp->put("\n");
 }
 
 #if SC_TRACING_PHASE_CALLBACKS_
@@ -1759,7 +1758,7 @@ wif_trace_file::write_comment(const std::string& comment)
 {
     if(!fp) open_fp();
     //no newline in comments allowed
-    std::fprintf(fp, "comment \"%s\" ;\n", comment.c_str());
+    fp->print("comment \"%s\" ;\n", comment.c_str());
 }
 
 
@@ -1823,7 +1822,7 @@ wif_trace_file::cycle(bool this_is_a_delta_cycle)
                 else
                     ss << "delta_time " << delta_units_high <<" ;\n";
 
-                std::fputs(ss.str().c_str(), fp);
+                fp->put(ss.str().c_str());
 
                 time_printed = true;
             }
@@ -1834,7 +1833,7 @@ wif_trace_file::cycle(bool this_is_a_delta_cycle)
     }
 
     if(time_printed) {
-        std::fprintf(fp, "\n");     // Put another newline
+        fp->put("\n");     // Put another newline
         // We update previous_time_units only when we print time because
         // this field stores the previous time that was printed, not the
         // previous time this function was called
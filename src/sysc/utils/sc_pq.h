@@ -58,6 +58,10 @@ public:
 
     void insert( void* elem );
 
+    // the i-th element in heap order, 0 <= i < size()
+    void* get( int i ) const
+	{ return m_heap[i + 1]; }
+
     int size() const
 	{ return m_heap_size; }
 
@@ -124,6 +128,11 @@ public:
     void insert( T elem )
 	{ sc_ppq_base::insert( (void*) elem ); }
 
+    // the i-th element in heap order, without changing the queue.
+
+    T get( int i ) const
+	{ return (T) sc_ppq_base::get( i ); }
+
     // size() and empty() are inherited.
 };
 
@@ -203,10 +203,15 @@ typedef std::exception sc_exception;
     ::sc_core::sc_report_handler::report(  \
             ::sc_core::SC_INFO, msg_type, msg, __FILE__, __LINE__ )
 
-#define SC_REPORT_INFO_VERB( msg_type, msg, verbosity )   \
-    ::sc_core::sc_report_handler::report(                 \
-            ::sc_core::SC_INFO, msg_type, msg, verbosity, \
-                               __FILE__ , __LINE__ )
+// The verbosity is checked in place, so that a filtered report neither
+// evaluates its message nor calls the report handler. The verbosity is
+// evaluated once, and kept by the filter for the report.
+
+#define SC_REPORT_INFO_VERB( msg_type, msg, verbosity )                     \
+    ( ::sc_core::sc_report_handler::verbosity_passes( verbosity )           \
+      ? ::sc_core::sc_report_handler::report_verbose(                       \
+            msg_type, msg, __FILE__ , __LINE__ )                            \
+      : (void) 0 )
 
 #define SC_REPORT_WARNING( msg_type, msg ) \
     ::sc_core::sc_report_handler::report(  \
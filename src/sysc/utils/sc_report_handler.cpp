@@ -31,12 +31,25 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <vector>
 
+#include "sysc/kernel/sc_parallel.h"
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/utils/sc_stop_here.h"
+#include "sysc/utils/sc_hash.h"
 #include "sysc/utils/sc_report_handler.h"
 #include "sysc/utils/sc_report.h"
+#include "sysc/utils/sc_report_writer.h"
+#include "sysc/communication/sc_host_mutex.h"
+
+#if SC_CPLUSPLUS >= 201103L
+# define SC_THREAD_LOCAL_ thread_local
+#elif defined(_MSC_VER)
+# define SC_THREAD_LOCAL_ __declspec(thread)
+#else
+# define SC_THREAD_LOCAL_ __thread
+#endif
 
 namespace std {}
 
@@ -180,6 +193,27 @@ sc_log_file_handle::operator*()
 
 static sc_log_file_handle log_stream;
 
+//
+// Private class to serialize reports issued by processes running on the
+// parallel worker pool (see sc_parallel.h)
+//
+
+class sc_parallel_report_lock
+{
+public:
+    explicit sc_parallel_report_lock( bool active )
+      : m_mutex_p( active ? &sc_parallel_engine::report_mutex() : 0 )
+        { if ( m_mutex_p ) m_mutex_p->lock(); }
+    ~sc_parallel_report_lock()
+        { if ( m_mutex_p ) m_mutex_p->unlock(); }
+private:
+    sc_host_mutex* m_mutex_p;
+private:
+    // disabled
+    sc_parallel_report_lock( const sc_parallel_report_lock& );
+    sc_parallel_report_lock& operator = ( const sc_parallel_report_lock& );
+};
+
 
 //
 // The official handler of the exception reporting
@@ -221,12 +255,23 @@ void sc_report_handler::default_handler(const sc_report& rep,
 // not documented, but available
 bool sc_report_close_default_log()
 {
+    sc_report_writer::flush();
     bool ret = log_stream.release();
     sc_report_handler::set_log_file_name(NULL);
 
     return ret;
 }
 
+// not documented, used by sc_report_writer
+std::ostream* sc_report_log_stream()
+{
+    const char* name = sc_report_handler::get_log_file_name();
+    if ( !name )
+	return 0;
+    log_stream.update_file_name(name);
+    return &*log_stream;
+}
+
 int sc_report_handler::get_count(sc_severity severity_) 
 { 
    return sev_call_count[severity_]; 
@@ -258,18 +303,46 @@ int sc_report_handler::get_count(const char* msg_type_, sc_severity severity_)
 // implementation
 //
 
+// The message definitions are indexed by their message types. Items are
+// only ever added at the head of the list, so the index is brought up to
+// date by adding the items in front of the last indexed one, oldest first,
+// which lets a later definition of a message type hide an earlier one as
+// with a search of the list. release() drops the index.
+
+typedef sc_strhash<sc_msg_def*> msg_index_type;
+
+static msg_index_type*                    msg_index = 0;
+static sc_report_handler::msg_def_items*  msg_index_head = 0;
+
 sc_msg_def * sc_report_handler::mdlookup(const char * msg_type_)
 {
     if( !msg_type_ ) // if msg_type is NULL, report unknown error
         msg_type_ = SC_ID_UNKNOWN_ERROR_;
 
-    for ( msg_def_items * item = messages; item; item = item->next )
+    if ( messages != msg_index_head )
     {
-	for ( int i = 0; i < item->count; ++i )
-	    if ( !strcmp(msg_type_, item->md[i].msg_type) )
-		return item->md + i;
+	if ( !msg_index )
+	    msg_index = new msg_index_type( 0, 512, PHASH_DEFAULT_MAX_DENSITY,
+	                                    PHASH_DEFAULT_GROW_FACTOR, false );
+
+	std::vector<msg_def_items*> added;
+	for ( msg_def_items * item = messages; item && item != msg_index_head;
+	      item = item->next )
+	    added.push_back( item );
+
+	for ( std::size_t j = added.size(); j-- > 0; )
+	{
+	    msg_def_items * item = added[j];
+	    for ( int i = item->count - 1; i >= 0; --i )
+		msg_index->insert( const_cast<char*>( item->md[i].msg_type ),
+		                   item->md + i );
+	}
+	msg_index_head = messages;
     }
-    return 0;
+
+    sc_msg_def * md = 0;
+    msg_index->lookup( msg_type_, &md );
+    return md;
 }
 
 // The calculation of actions to be executed
@@ -331,16 +404,24 @@ void sc_report_handler::report( sc_severity severity_,
 				const char* file_, 
 				int line_ )
 {
-    sc_msg_def * md = mdlookup(msg_type_);
-
     // If the severity of the report is SC_INFO and the specified verbosity 
     // level is greater than the maximum verbosity level of the simulator then 
     // return without any action.
 
     if ( (severity_ == SC_INFO) && (verbosity_ > verbosity_level) ) return;
 
+    sc_parallel_frame* frame_p = sc_parallel_frame::current();
+    if ( SC_UNLIKELY_( frame_p != 0 ) && severity_ < SC_ERROR )
+    {
+        frame_p->record_report( severity_, msg_type_, msg_, verbosity_,
+                                file_, line_ );
+        return;
+    }
+    sc_parallel_report_lock lock( frame_p != 0 );
+
     // Process the report:
 
+    sc_msg_def * md = mdlookup(msg_type_);
     if ( !md )
 	md = add_msg_type(msg_type_);
 
@@ -359,16 +440,23 @@ void sc_report_handler::report(sc_severity severity_,
 			       const char * file_,
 			       int line_)
 {
-    sc_msg_def * md = mdlookup(msg_type_);
-
     // If the severity of the report is SC_INFO and the maximum verbosity
     // level is less than SC_MEDIUM return without any action.
 
     if ( (severity_ == SC_INFO) && (SC_MEDIUM > verbosity_level) ) return;
 
-    // Process the report:
+    sc_parallel_frame* frame_p = sc_parallel_frame::current();
+    if ( SC_UNLIKELY_( frame_p != 0 ) && severity_ < SC_ERROR )
+    {
+        frame_p->record_report( severity_, msg_type_, msg_, -1,
+                                file_, line_ );
+        return;
+    }
+    sc_parallel_report_lock lock( frame_p != 0 );
 
+    // Process the report:
 
+    sc_msg_def * md = mdlookup(msg_type_);
     if ( !md )
 	md = add_msg_type(msg_type_);
 
@@ -381,6 +469,34 @@ void sc_report_handler::report(sc_severity severity_,
     handler(rep, actions);
 }
 
+// The verbosities of the SC_REPORT_INFO_VERB reports passing the filter,
+// per host thread, until they are reported. They are nested while the
+// message of such a report issues another one.
+
+static const int verbosity_stack_size = 16;
+static SC_THREAD_LOCAL_ int verbosity_stack[verbosity_stack_size];
+static SC_THREAD_LOCAL_ int verbosity_stack_n = 0;
+
+bool sc_report_handler::keep_verbosity( int verbosity_ )
+{
+    if ( verbosity_stack_n < verbosity_stack_size )
+	verbosity_stack[verbosity_stack_n] = verbosity_;
+    ++verbosity_stack_n;
+    return true;
+}
+
+void sc_report_handler::report_verbose( const char* msg_type_,
+					const char* msg_,
+					const char* file_,
+					int line_ )
+{
+    int verbosity_ = SC_NONE; // not kept, passes anyway
+    if ( verbosity_stack_n > 0
+	 && --verbosity_stack_n < verbosity_stack_size )
+	verbosity_ = verbosity_stack[verbosity_stack_n];
+    report( SC_INFO, msg_type_, msg_, verbosity_, file_, line_ );
+}
+
 // The following method is never called by the simulator.
 
 void sc_report_handler::initialize()
@@ -432,6 +548,10 @@ void sc_report_handler::release()
     last_global_report = 0;
     sc_report_close_default_log();
 
+    delete msg_index;
+    msg_index = 0;
+    msg_index_head = 0;
+
     msg_def_items * items = messages, * newitems = &msg_terminator;
     messages = &msg_terminator;
 
@@ -672,6 +792,9 @@ bool sc_report_handler::set_log_file_name(const char* name_)
 {
     if ( !name_ )
     {
+	// the buffered reports still log to the file, which may be
+	// reopened under another name with the next report
+	sc_report_writer::flush();
 	free(log_file_name);
 	log_file_name = 0;
 	return false;
@@ -716,8 +839,6 @@ sc_msg_def * sc_report_handler::mdlookup(int id)
     return 0;
 }
 
-int sc_report_handler::get_verbosity_level() { return verbosity_level; }
-
 int sc_report_handler::set_verbosity_level( int level )
 {
     int result = verbosity_level;
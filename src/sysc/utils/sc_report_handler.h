@@ -56,6 +56,7 @@ struct SC_API sc_msg_def
 typedef void (* sc_report_handler_proc)(const sc_report&, const sc_actions &);
 class sc_report;
 extern SC_API bool sc_report_close_default_log();
+extern std::ostream* sc_report_log_stream(); // see sc_report_writer
 class SC_API sc_report_handler
 {
 public:
@@ -95,9 +96,19 @@ public:
     static int get_count(const char* msg_type_);
     static int get_count(const char* msg_type_, sc_severity severity_);
 
-    static int get_verbosity_level();
+    static int get_verbosity_level()
+        { return verbosity_level; }
     static int set_verbosity_level( int level );
 
+    // filter an info report of SC_REPORT_INFO_VERB by its verbosity, which
+    // is kept for report_verbose() if the report passes
+    static bool verbosity_passes( int verbosity )
+        { return verbosity <= verbosity_level && keep_verbosity( verbosity ); }
+    static void report_verbose( const char* msg_type,
+                                const char* msg,
+                                const char* file,
+                                int line );
+
 
     static void initialize(); // just reset counters
     static void release(); // initialize() needed for reports after it
@@ -139,6 +150,7 @@ protected:
 
     static void cache_report(const sc_report&);
     static sc_actions execute(sc_msg_def*, sc_severity);
+    static bool keep_verbosity(int verbosity);
 
     static sc_actions   suppress_mask;
     static sc_actions   force_mask;
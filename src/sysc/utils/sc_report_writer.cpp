@@ -0,0 +1,478 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_report_writer.cpp -- Report handler displaying and logging the reports
+                          on a host thread.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/utils/sc_report_writer.h"
+#include "sysc/utils/sc_report.h"
+#include "sysc/kernel/sc_host_thread.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_time.h"
+#include "sysc/communication/sc_host_mutex.h"
+#include "sysc/communication/sc_host_semaphore.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// The host threads are only linked in with parallel simulation, async
+// updates or POSIX threads; otherwise the reports are written right away.
+#if !defined(SC_DISABLE_PARALLEL_SIMULATION) || \
+    !defined(SC_DISABLE_ASYNC_UPDATES) || defined(SC_USE_PTHREADS)
+#   define SC_REPORT_WRITER_THREAD_
+#endif
+
+namespace sc_core {
+
+namespace {
+
+const sc_actions output_actions = SC_DISPLAY | SC_LOG;
+
+const sc_actions control_actions =
+    SC_STOP | SC_INTERRUPT | SC_ABORT | SC_THROW;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_report_record
+//
+//  A report in the buffer, followed by its message type, message, file
+//  name and process name. A record with a negative severity wraps the
+//  buffer around.
+// ----------------------------------------------------------------------------
+
+struct sc_report_record
+{
+    std::size_t   size;       // of the record, including the strings.
+    int           severity;   // -1 to wrap around.
+    sc_actions    actions;    // SC_DISPLAY and/or SC_LOG.
+    int           id;
+    int           line;
+    sc_dt::uint64 time;
+    std::ostream* log_p;      // log stream, if logged.
+    std::size_t   msg_type_n; // lengths, including the terminating zeros;
+    std::size_t   msg_n;
+    std::size_t   file_n;
+    std::size_t   process_n;  // zero if there is no process.
+
+    const char* msg_type() const
+        { return reinterpret_cast<const char*>( this + 1 ); }
+    const char* msg() const
+        { return msg_type() + msg_type_n; }
+    const char* file() const
+        { return msg() + msg_n; }
+    const char* process() const
+        { return process_n ? file() + file_n : 0; }
+};
+
+const std::size_t record_align = sizeof(sc_dt::uint64);
+
+std::size_t aligned( std::size_t n )
+{
+    return ( n + record_align - 1 ) / record_align * record_align;
+}
+
+// formats like sc_report_compose_message()
+std::string compose( const sc_report_record& rec )
+{
+    static const char * severity_names[] = {
+	"Info", "Warning", "Error", "Fatal"
+    };
+    std::string str;
+
+    str += severity_names[rec.severity];
+    str += ": ";
+
+    if ( rec.id >= 0 ) // backward compatibility with 2.0+
+    {
+	char idstr[64];
+	std::sprintf(idstr, "(%c%d) ", "IWEF"[rec.severity], rec.id);
+	str += idstr;
+    }
+    str += rec.msg_type();
+
+    if( *rec.msg() )
+    {
+	str += ": ";
+	str += rec.msg();
+    }
+    if( rec.severity > SC_INFO )
+    {
+        char line_number_str[16];
+	str += "\nIn file: ";
+	str += rec.file();
+	str += ":";
+	std::sprintf(line_number_str, "%d", rec.line);
+	str += line_number_str;
+
+	if( rec.process() )
+	{
+	    str += "\nIn process: ";
+	    str += rec.process();
+	    str += " @ ";
+	    str += sc_time::from_value( rec.time ).to_string();
+	}
+    }
+    return str;
+}
+
+void write_record( const sc_report_record& rec )
+{
+    std::string msg = compose( rec );
+    if ( rec.actions & SC_DISPLAY )
+	::std::cout << '\n' << msg << '\n';
+    if ( rec.actions & SC_LOG )
+	*rec.log_p << sc_time::from_value( rec.time ) << ": " << msg << '\n';
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_report_buffer
+//
+//  The ring buffer of the records and the host thread writing them.
+// ----------------------------------------------------------------------------
+
+class sc_report_buffer
+{
+public:
+
+    sc_report_buffer( std::size_t size, sc_report_handler_proc previous );
+    ~sc_report_buffer();
+
+    // copy a report into the buffer, false if it does not fit
+    bool put( const sc_report& rep, sc_actions actions );
+    void flush();
+
+    sc_report_handler_proc previous_handler() const
+        { return m_previous; }
+
+private:
+
+    static void thread_main( void* buffer_p );
+    void run();
+
+    sc_report_record* record_at( std::size_t pos )
+        { return reinterpret_cast<sc_report_record*>(
+                     reinterpret_cast<char*>( &m_data[0] ) + pos ); }
+
+private:
+    std::vector<sc_dt::uint64> m_data;      // the ring, aligned.
+    std::size_t            m_size;          // of the ring in bytes.
+    std::size_t            m_head;          // where the next record goes.
+    std::size_t            m_tail;          // the oldest record.
+    std::size_t            m_used;          // bytes between tail and head.
+    bool                   m_idle;          // the thread waits for work.
+    bool                   m_space_waiting; // put() waits for space.
+    int                    m_flush_waiting; // flush() calls waiting.
+    bool                   m_shutdown;
+    sc_report_handler_proc m_previous;      // handler before start().
+    std::vector<std::ostream*> m_logs;      // log streams to flush.
+
+    sc_host_mutex          m_mutex;         // protects the above.
+    sc_host_semaphore      m_work;
+    sc_host_semaphore      m_space;
+    sc_host_semaphore      m_flushed;
+    sc_host_thread         m_thread;
+};
+
+sc_report_buffer::sc_report_buffer( std::size_t size,
+                                    sc_report_handler_proc previous )
+  : m_data( aligned( size ) / record_align ),
+    m_size( aligned( size ) ), m_head( 0 ), m_tail( 0 ), m_used( 0 ),
+    m_idle( true ), m_space_waiting( false ), m_flush_waiting( 0 ),
+    m_shutdown( false ), m_previous( previous ), m_logs(),
+    m_mutex(), m_work( 0 ), m_space( 0 ), m_flushed( 0 ), m_thread()
+{
+    m_thread.start( &thread_main, this );
+}
+
+sc_report_buffer::~sc_report_buffer()
+{
+    flush();
+    {
+        sc_scoped_lock lock( m_mutex );
+        m_shutdown = true;
+        m_idle = false;
+    }
+    m_work.post();
+    m_thread.join();
+}
+
+//------------------------------------------------------------------------------
+//"sc_report_buffer::put"
+//
+// This method copies the report into the buffer, waiting for the writer to
+// make space if needed. A record that does not fit at the end of the ring
+// is preceded by a wrapping record, or, if not even its header fits, by an
+// implicit gap the writer skips as well. An empty ring starts over at its
+// beginning, so every record fitting the ring finds space eventually.
+//------------------------------------------------------------------------------
+bool sc_report_buffer::put( const sc_report& rep, sc_actions actions )
+{
+    const char* process = 0;
+    if ( rep.get_severity() > SC_INFO && sc_is_running() )
+        process = rep.get_process_name();
+
+    std::size_t msg_type_n = std::strlen( rep.get_msg_type() ) + 1;
+    std::size_t msg_n = std::strlen( rep.get_msg() ) + 1;
+    std::size_t file_n = std::strlen( rep.get_file_name() ) + 1;
+    std::size_t process_n = process ? std::strlen( process ) + 1 : 0;
+    std::size_t n = aligned( sizeof(sc_report_record) + msg_type_n + msg_n
+                             + file_n + process_n );
+    if ( n > m_size )
+        return false;
+
+    std::ostream* log_p = 0;
+    if ( actions & SC_LOG )
+        log_p = sc_report_log_stream();
+    if ( !log_p )
+        actions &= ~SC_LOG;
+    if ( !actions )
+        return true;
+
+    sc_scoped_lock lock( m_mutex );
+
+    if ( m_used == 0 )
+        m_head = m_tail = 0;
+    std::size_t gap = m_size - m_head;
+    if ( gap >= n )
+        gap = 0;
+    while ( m_used + gap + n > m_size )
+    {
+        m_space_waiting = true;
+        m_mutex.unlock();
+        m_space.wait();
+        m_mutex.lock();
+        if ( m_used == 0 )
+            m_head = m_tail = 0;
+        gap = m_size - m_head;
+        if ( gap >= n )
+            gap = 0;
+    }
+
+    if ( gap != 0 )
+    {
+        if ( gap >= sizeof(sc_report_record) )
+        {
+            record_at( m_head )->size = gap;
+            record_at( m_head )->severity = -1;
+        }
+        m_used += gap;
+        m_head = 0;
+    }
+
+    sc_report_record* rec = record_at( m_head );
+    rec->size = n;
+    rec->severity = rep.get_severity();
+    rec->actions = actions;
+    rec->id = rep.get_id();
+    rec->line = rep.get_line_number();
+    rec->time = rep.get_time().value();
+    rec->log_p = log_p;
+    rec->msg_type_n = msg_type_n;
+    rec->msg_n = msg_n;
+    rec->file_n = file_n;
+    rec->process_n = process_n;
+    std::memcpy( const_cast<char*>( rec->msg_type() ), rep.get_msg_type(),
+                 msg_type_n );
+    std::memcpy( const_cast<char*>( rec->msg() ), rep.get_msg(), msg_n );
+    std::memcpy( const_cast<char*>( rec->file() ), rep.get_file_name(),
+                 file_n );
+    if ( process )
+        std::memcpy( const_cast<char*>( rec->process() ), process,
+                     process_n );
+
+    m_head = ( m_head + n ) % m_size;
+    m_used += n;
+    if ( m_idle )
+    {
+        m_idle = false;
+        m_work.post();
+    }
+    return true;
+}
+
+void sc_report_buffer::flush()
+{
+    {
+        sc_scoped_lock lock( m_mutex );
+        if ( m_idle )
+            return;
+        ++m_flush_waiting;
+    }
+    m_flushed.wait();
+}
+
+void sc_report_buffer::thread_main( void* buffer_p )
+{
+    static_cast<sc_report_buffer*>( buffer_p )->run();
+}
+
+//------------------------------------------------------------------------------
+//"sc_report_buffer::run"
+//
+// This method is the writer thread. It formats and writes the records
+// without holding the lock, since put() does not touch the used part of
+// the ring, and flushes the streams whenever the buffer runs empty.
+//------------------------------------------------------------------------------
+void sc_report_buffer::run()
+{
+    for ( ;; )
+    {
+        m_work.wait();
+        for ( ;; )
+        {
+            sc_report_record* rec = 0;
+            {
+                sc_scoped_lock lock( m_mutex );
+                while ( m_used != 0 && rec == 0 )
+                {
+                    std::size_t gap = m_size - m_tail;
+                    if ( gap < sizeof(sc_report_record)
+                         || record_at( m_tail )->severity < 0 )
+                    {
+                        m_used -= gap;
+                        m_tail = 0;
+                    }
+                    else
+                        rec = record_at( m_tail );
+                }
+                if ( rec == 0 )
+                {
+                    ::std::cout.flush();
+                    for ( std::size_t i = 0; i < m_logs.size(); ++i )
+                        m_logs[i]->flush();
+                    m_logs.clear();
+
+                    m_idle = true;
+                    for ( ; m_flush_waiting > 0; --m_flush_waiting )
+                        m_flushed.post();
+                    if ( m_space_waiting )
+                    {
+                        m_space_waiting = false;
+                        m_space.post();
+                    }
+                    if ( m_shutdown )
+                        return;
+                    break;
+                }
+            }
+
+            write_record( *rec );
+
+            sc_scoped_lock lock( m_mutex );
+            if ( rec->log_p && ( m_logs.empty() || m_logs.back() != rec->log_p ) )
+                m_logs.push_back( rec->log_p );
+            m_tail = ( m_tail + rec->size ) % m_size;
+            m_used -= rec->size;
+            if ( m_space_waiting )
+            {
+                m_space_waiting = false;
+                m_space.post();
+            }
+        }
+    }
+}
+
+sc_report_buffer* report_buffer = 0;
+
+// stops the writer at the exit of the program
+struct sc_report_writer_guard
+{
+    ~sc_report_writer_guard()
+        { sc_report_writer::stop(); }
+};
+
+sc_report_writer_guard report_writer_guard;
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_report_writer
+//
+//  Report handler displaying and logging the reports on a host thread.
+// ----------------------------------------------------------------------------
+
+void sc_report_writer::start( std::size_t buffer_size )
+{
+#if defined(SC_REPORT_WRITER_THREAD_)
+    if ( report_buffer )
+        return;
+    report_buffer = new sc_report_buffer( buffer_size,
+        sc_report_handler::set_handler( &sc_report_writer::handler ) );
+#else
+    (void) buffer_size;
+#endif
+}
+
+void sc_report_writer::stop()
+{
+    if ( !report_buffer )
+        return;
+    sc_report_handler::set_handler( report_buffer->previous_handler() );
+    delete report_buffer;
+    report_buffer = 0;
+}
+
+bool sc_report_writer::is_running()
+{
+    return report_buffer != 0;
+}
+
+void sc_report_writer::flush()
+{
+    if ( report_buffer )
+        report_buffer->flush();
+}
+
+void sc_report_writer::handler( const sc_report& rep,
+                                const sc_actions& actions )
+{
+    sc_actions remaining = actions;
+    if ( report_buffer && ( actions & output_actions ) )
+    {
+        if ( report_buffer->put( rep, actions & output_actions ) )
+            remaining &= ~output_actions;
+        else
+            report_buffer->flush(); // written right away, in order
+    }
+
+    if ( report_buffer && ( rep.get_severity() >= SC_ERROR
+                            || ( remaining & control_actions ) ) )
+        report_buffer->flush();
+
+    sc_report_handler::default_handler( rep, remaining );
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,85 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_report_writer.h -- Report handler displaying and logging the reports
+                        on a host thread.
+
+  While the writer is started, its handler() replaces the report handler.
+  It copies the displayed and logged reports as compact records into a
+  buffer, from which a host thread formats and writes them like
+  sc_report_handler::default_handler() would. The remaining actions are
+  executed by the default handler on the calling thread.
+
+  The buffer is flushed before an error or fatal report, or any report
+  stopping, interrupting, aborting or throwing, takes effect, by sc_stop(),
+  and when the log file is closed, so that no report is lost. Other output
+  of the program may overtake the reports in the buffer; call flush() to
+  order them.
+
+ CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_REPORT_WRITER_H_INCLUDED_
+#define SC_REPORT_WRITER_H_INCLUDED_
+
+#include "sysc/utils/sc_report.h"
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_report_writer
+//
+//  Report handler displaying and logging the reports on a host thread.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_report_writer
+{
+public:
+
+    // install handler() with a buffer of the given size in bytes
+    static void start( std::size_t buffer_size = 1 << 20 );
+
+    // write the buffered reports and restore the previous report handler
+    static void stop();
+
+    static bool is_running();
+
+    // wait until the buffered reports are written
+    static void flush();
+
+    // the report handler installed by start()
+    static void handler( const sc_report&, const sc_actions& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_REPORT_WRITER_H_INCLUDED_
+// Taf!
@@ -121,6 +121,14 @@ sc_vector_do_bind( Container & cont
                  , ArgumentIterator  last
                  , typename Container::iterator from );
 
+// implementation-defined
+template< typename Container, typename ArgumentIterator >
+typename Container::iterator
+sc_vector_do_batch_bind( Container & cont
+                       , ArgumentIterator  first
+                       , ArgumentIterator  last
+                       , typename Container::iterator from );
+
 // implementation-defined
 template< typename Container, typename ArgumentIterator >
 typename Container::iterator
@@ -477,6 +485,26 @@ public:
                , iterator from )
     { return sc_vector_do_bind( *this, first, last, from ); }
 
+  // like bind(), but calls bind() of element_type without virtual
+  // dispatch, i.e. ignores overrides in classes derived from element_type
+
+  template< typename ContainerType, typename ArgumentType >
+  iterator batch_bind( sc_vector_assembly<ContainerType,ArgumentType> c )
+    { return batch_bind( c.begin(), c.end() ); }
+
+  template< typename BindableContainer >
+  iterator batch_bind( BindableContainer & c )
+    { return batch_bind( c.begin(), c.end() ); }
+
+  template< typename BindableIterator >
+  iterator batch_bind( BindableIterator first, BindableIterator last )
+    { return batch_bind( first, last, this->begin() ); }
+
+  template< typename BindableIterator >
+  iterator batch_bind( BindableIterator first, BindableIterator last
+                     , iterator from )
+    { return sc_vector_do_batch_bind( *this, first, last, from ); }
+
   template< typename ContainerType, typename ArgumentType >
   iterator operator()( sc_vector_assembly<ContainerType,ArgumentType> c )
     { return operator()( c.begin(), c.end() ); }
@@ -587,6 +615,31 @@ public:
                , typename base_type::iterator from )
     { return bind( first, last, iterator(from.it_, ptr_) ); }
 
+  // like bind(), but calls bind() of access_type without virtual
+  // dispatch, i.e. ignores overrides in classes derived from access_type
+
+  template< typename ContainerType, typename ArgumentType >
+  iterator batch_bind( sc_vector_assembly<ContainerType,ArgumentType> c )
+    { return batch_bind( c.begin(), c.end() ); }
+
+  template< typename BindableContainer >
+  iterator batch_bind( BindableContainer & c )
+    { return batch_bind( c.begin(), c.end() ); }
+
+  template< typename BindableIterator >
+  iterator batch_bind( BindableIterator first, BindableIterator last )
+    { return batch_bind( first, last, this->begin() ); }
+
+  template< typename BindableIterator >
+  iterator batch_bind( BindableIterator first, BindableIterator last
+                     , iterator from )
+    { return sc_vector_do_batch_bind( *this, first, last, from ); }
+
+  template< typename BindableIterator >
+  iterator batch_bind( BindableIterator first, BindableIterator last
+                     , typename base_type::iterator from )
+    { return batch_bind( first, last, iterator(from.it_, ptr_) ); }
+
   template< typename ContainerType, typename ArgumentType >
   iterator operator()( sc_vector_assembly<ContainerType,ArgumentType> c )
     { return operator()( c.begin(), c.end() ); }
@@ -726,6 +779,29 @@ sc_vector_do_bind( Container & cont
   return from;
 }
 
+template< typename Container, typename ArgumentIterator >
+typename Container::iterator
+sc_vector_do_batch_bind( Container & cont
+                       , ArgumentIterator  first
+                       , ArgumentIterator  last
+                       , typename Container::iterator from )
+{
+  // a name the elements themselves are unlikely to declare
+  typedef typename Container::iterator::value_type sc_batch_element_type;
+
+  typename Container::iterator end = cont.end();
+
+  if( !cont.size() || from == end || first == last )
+      cont.report_empty_bind( cont.kind(), from == end );
+
+  while( from!=end && first != last )
+  {
+    sc_batch_element_type& element = *from++;
+    element.sc_batch_element_type::bind( *first++ );
+  }
+  return from;
+}
+
 template< typename Container, typename ArgumentIterator >
 typename Container::iterator
 sc_vector_do_operator_paren( Container& cont